@@ -0,0 +1,147 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypeop Constructor {@@affineform} {@var{A} =} affineform (@var{X})
+##
+## Create an affine form of the bare interval array @var{X}.
+##
+## Each element of an affine form is a linear combination
+## @tex
+## $c + a_1 \varepsilon_1 + \ldots + a_n \varepsilon_n + e \varepsilon$
+## @end tex
+## @ifnottex
+## c + a_1 ε_1 + … + a_n ε_n + e ε
+## @end ifnottex
+## of noise symbols, which independently range over [-1, 1].  The noise
+## symbols @code{ε_k} are shared between affine forms and describe
+## the dependency of intermediate results on the inputs.  The error term
+## @code{e ε} is specific to each element and encloses all rounding errors
+## and the errors of nonlinear approximations, such that the range of an
+## affine form is a valid enclosure of the exact result.
+##
+## The constructor assigns a new noise symbol to each element of @var{X}.
+## Numbers are converted into exact constants without noise symbols.
+## Unbounded intervals are converted into affine forms of the entire set of
+## reals.
+##
+## Supported operations are @code{+}, @code{-}, @code{.*}, @code{./},
+## @code{.^} with integral exponent, the matrix operators for scalar
+## operands, and the functions @code{exp}, @code{log}, @code{realsqrt},
+## @code{sqr}, and @code{sqrt}, which use Chebyshev approximations.  The
+## functions @code{cos} and @code{sin} are evaluated in interval arithmetic
+## and lose the dependency on the inputs.  @code{infsup (@var{A})} computes
+## the range of @var{A}.
+##
+## In contrast to interval arithmetic, affine arithmetic keeps track of
+## first-order dependencies between subexpressions, which reduces the
+## overestimation of expressions with multiple occurrences of a variable.
+## For example, the function of a solver, e.g., @code{fsolve}, may
+## evaluate its expression with
+## @code{@@(x) infsup (g (affineform (x)))}, which often needs fewer
+## bisections.
+##
+## @example
+## @group
+## x = infsup (0, 1);
+## x .* (1 - x)
+##   @result{} ans = [0, 1]
+## a = affineform (x);
+## infsup (a .* (1 - a))
+##   @result{} ans = [0, 0.5]
+## @end group
+## @end example
+## @seealso{@@affineform/infsup}
+## @end deftypeop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function A = affineform (x)
+
+  ## Mixed operations with intervals use the methods of this class
+  superiorto ("infsup", "infsupdec");
+
+  ## Noise symbols must never be reused while affine forms exist.  The
+  ## constructor is locked in memory, such that clearing functions does not
+  ## reset the counter.
+  persistent next_symbol = 0;
+  mlock ();
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  if (isa (x, "affineform"))
+    A = x;
+    return
+  endif
+  if (isa (x, "infsupdec"))
+    error ("interval:InvalidOperand", ...
+           "affineform: decorated intervals are not supported");
+  endif
+  if (not (isa (x, "infsup")))
+    x = infsup (x);
+  endif
+
+  [center, radius] = rad (x);
+  err = zeros (size (x));
+
+  ## Unbounded elements have an infinite error term, empty elements have
+  ## center NaN
+  unbounded = isinf (radius);
+  center(unbounded) = 0;
+  err(unbounded) = inf;
+
+  ## A new noise symbol for each nonsingleton element
+  bounded = find (radius > 0 & not (unbounded));
+  k = numel (bounded);
+  coef = sparse (next_symbol + (1 : k)', bounded, radius(bounded), ...
+                 next_symbol + k, numel (x));
+  next_symbol += k;
+
+  A = class (struct ("center", center, ...
+                     "coef", coef, ...
+                     "err", err), ...
+             "affineform");
+
+endfunction
+
+%!# from the documentation string
+%!test
+%! a = affineform (infsup (0, 1));
+%! assert (isequal (infsup (a .* (1 - a)), infsup (0, 0.5)));
+
+%!test
+%! x = infsup ([-1, 0, 2; 1, -inf, 3], [1, 0, 4; 1, inf, 3]);
+%! x(2, 2) = empty ();
+%! a = affineform (x);
+%! assert (size (a), [2, 3]);
+%! assert (isequal (infsup (a), x));
+%!test
+%! a = affineform (infsup (1, 2));
+%! b = affineform (infsup (1, 2));
+%! assert (isequal (infsup (a - a), infsup (0)));
+%! assert (isequal (infsup (a - b), infsup (-1, 1)));
+%!test
+%! a = affineform (infsup (1, 2));
+%! clear affineform
+%! clear functions
+%! b = affineform (infsup (1, 2));
+%! assert (isequal (infsup (a - b), infsup (-1, 1)));
+%!error affineform (infsupdec (1))
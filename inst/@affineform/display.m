@@ -0,0 +1,51 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} display (@var{A})
+##
+## Display the variable name and the range of the affine form @var{A}.
+##
+## @example
+## @group
+## a = affineform (infsup (2, 3))
+##   @result{} a = affine form with range
+##      [2, 3]
+## @end group
+## @end example
+## @seealso{@@affineform/infsup}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function display (A)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  label = inputname (1);
+  if (isempty (label))
+    label = "ans";
+  endif
+
+  printf ("%s = affine form with range\n", label);
+  disp (infsup (A));
+
+endfunction
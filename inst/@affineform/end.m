@@ -0,0 +1,40 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} end (@var{A}, @var{k}, @var{n})
+##
+## The magic index @code{end} refers to the last valid entry in an indexing
+## operation of the affine form @var{A}.
+##
+## @seealso{@@affineform/size, @@affineform/subsref}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function ret = end (A, k, n)
+
+  if (n == k)
+    ret = prod (size (A.center)(n:ndims (A.center)));
+  else
+    ret = size (A.center, k);
+  endif
+
+endfunction
+
+%!assert (isequal (infsup (affineform (infsup (1 : 3))(end)), infsup (3)));
@@ -0,0 +1,45 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} exp (@var{X})
+##
+## Compute the exponential function of each element of the affine form
+## @var{X} with a Chebyshev approximation.
+## @seealso{@@infsup/exp}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = exp (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = unary ("exp", x);
+
+endfunction
+
+%!test
+%! x = infsup ([-1, 0, 2], [1, 0, 2.5]);
+%! assert (all (subset (exp (x), infsup (exp (affineform (x))))));
+%!test
+%! a = affineform (infsup (0, 1));
+%! assert (wid (infsup (exp (a) - a)) < 1);
@@ -0,0 +1,62 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} infsup (@var{A})
+##
+## Return the range of each element of the affine form @var{A} as a bare
+## interval.
+##
+## The range is computed with upward rounded sums of the absolute values of
+## all coefficients and encloses the exact result of the operations, which
+## have produced @var{A}.
+##
+## @example
+## @group
+## a = affineform (infsup (1, 3));
+## infsup (2 * a - a)
+##   @result{} ans = [1, 3]
+## @end group
+## @end example
+## @seealso{@@affineform/affineform}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function x = infsup (A)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  [l, u] = __affine__ ("range", A.center(:), A.coef, A.err(:));
+  x = __infsup__ (reshape (l, size (A.center)), ...
+                       reshape (u, size (A.center)));
+
+endfunction
+
+%!# from the documentation string
+%!test
+%! a = affineform (infsup (1, 3));
+%! assert (isequal (infsup (2 * a - a), infsup (1, 3)));
+
+%!test
+%! x = infsup ([1, -inf; 0, 2], [2, inf; 0, 2]);
+%! assert (isequal (infsup (affineform (x)), x));
+%!assert (isempty (infsup (affineform (empty ()))));
@@ -0,0 +1,48 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} log (@var{X})
+##
+## Compute the natural logarithm of each element of the affine form @var{X}
+## with a Chebyshev approximation.
+##
+## Where @var{X} is not strictly positive, the logarithm is computed in
+## interval arithmetic.
+## @seealso{@@infsup/log}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = log (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = unary ("log", x);
+
+endfunction
+
+%!test
+%! x = infsup ([0.5, 2, -1], [1, 10, 1]);
+%! y = infsup (log (affineform (x)));
+%! assert (all (subset (log (x), y)));
+%! assert (isequal (y(3), infsup (-inf, inf)));
+%!assert (isempty (infsup (log (affineform (infsup (-2, -1))))));
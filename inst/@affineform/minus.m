@@ -0,0 +1,47 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} minus (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} - @var{Y}}
+##
+## Compute the element-wise difference of the affine forms @var{X} and @var{Y}.
+##
+## Shared noise symbols cancel out, such that @code{@var{X} - @var{X}} is
+## exactly zero.
+## @seealso{@@infsup/minus}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = minus (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  result = binary ("minus", x, y);
+
+endfunction
+
+%!test
+%! a = affineform (infsup ([1, 2], [3, 4]));
+%! assert (isequal (infsup (a - a), infsup ([0, 0])));
+%! assert (isequal (infsup (a - 1), infsup ([0, 1], [2, 3])));
+%! assert (isequal (infsup (1 - a), infsup ([-2, -3], [0, -1])));
@@ -0,0 +1,48 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} mpower (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} ^ @var{Y}}
+##
+## Compute the power of the scalar affine form @var{X} and @var{Y}.
+##
+## The exponent @var{Y} must be a nonzero integral number.
+## @seealso{@@affineform/power}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = mpower (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (numel (x) ~= 1)
+    error ("interval:InvalidOperand", ...
+           "affineform: matrix power is not supported");
+  endif
+
+  result = power (x, y);
+
+endfunction
+
+%!assert (subset (infsup (-1, 8), infsup (affineform (infsup (-1, 2)) ^ 3)));
+%!error affineform (infsup (1 : 2)) ^ 2
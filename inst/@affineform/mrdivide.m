@@ -0,0 +1,48 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} mrdivide (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} / @var{Y}}
+##
+## Compute the quotient of the affine forms @var{X} and @var{Y}.
+##
+## The divisor @var{Y} must be scalar.
+## @seealso{@@affineform/rdivide}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = mrdivide (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (numel (y) ~= 1)
+    error ("interval:InvalidOperand", ...
+           "affineform: matrix division is not supported");
+  endif
+
+  result = rdivide (x, y);
+
+endfunction
+
+%!assert (isequal (infsup (affineform (infsup ([2, 4], [6, 8])) / 2), infsup ([1, 2], [3, 4])));
+%!error affineform (infsup (1)) / infsup ([1, 2])
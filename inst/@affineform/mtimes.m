@@ -0,0 +1,52 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} mtimes (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} * @var{Y}}
+##
+## Compute the product of the affine forms @var{X} and @var{Y}.
+##
+## Matrix multiplication is not supported, one of the operands must be
+## scalar.
+## @seealso{@@affineform/times}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = mtimes (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (numel (x) ~= 1 && numel (y) ~= 1)
+    error ("interval:InvalidOperand", ...
+           "affineform: matrix multiplication is not supported");
+  endif
+
+  result = times (x, y);
+
+endfunction
+
+%!test
+%! a = affineform (infsup ([1, 2], [3, 4]));
+%! assert (isequal (infsup (2 * a), infsup ([2, 4], [6, 8])));
+%! assert (isequal (infsup (a * 2 - 2 * a), infsup ([0, 0])));
+%!error affineform (infsup ([1, 2])) * infsup ([1; 2])
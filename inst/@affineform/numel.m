@@ -0,0 +1,46 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} numel (@var{A})
+##
+## Return the number of elements in the affine form @var{A}.
+##
+## @seealso{@@affineform/size}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = numel (A, varargin)
+
+  if (not (isa (A, "affineform")))
+    error ("invalid use of affineform as indexing parameter to numel ()")
+  endif
+
+  if (not (isempty (varargin)))
+    ## Indexing produces a single affine form (see bug #53375)
+    result = 1;
+    return
+  endif
+
+  result = numel (A.center);
+
+endfunction
+
+%!assert (numel (affineform (infsup (1 : 3))), 3);
+%!assert (numel (affineform (zeros (2, 0))), 0);
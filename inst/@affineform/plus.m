@@ -0,0 +1,50 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} plus (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} + @var{Y}}
+##
+## Compute the element-wise sum of the affine forms @var{X} and @var{Y}.
+##
+## The coefficients of shared noise symbols are added exactly, where
+## possible, and the rounding errors are added to the error term.
+## @seealso{@@infsup/plus}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = plus (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  result = binary ("plus", x, y);
+
+endfunction
+
+%!test
+%! a = affineform (infsup ([1, 2], [3, 4]));
+%! assert (isequal (infsup (a + a), infsup ([2, 4], [6, 8])));
+%! assert (isequal (infsup (a + infsup (1, 2)), infsup ([2, 3], [5, 6])));
+%! assert (isequal (infsup (a + [1; 2]), infsup ([2, 3; 3, 4], [4, 5; 5, 6])));
+%!test
+%! a = affineform (infsup (0.1));
+%! assert (subset (infsup (0.1) + 0.2, infsup (a + 0.2)));
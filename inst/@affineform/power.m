@@ -0,0 +1,73 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} power (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} .^ @var{Y}}
+##
+## Compute the element-wise power of the affine form @var{X} and @var{Y}.
+##
+## The exponent @var{Y} must be a nonzero integral number.  The power is
+## computed by repeated squaring and multiplication, and negative exponents
+## use the reciprocal of the result.
+## @seealso{@@affineform/sqr, @@infsup/pown}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = power (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (isa (y, "affineform") || not (isnumeric (y)) || not (isscalar (y)) ...
+      || y == 0 || fix (y) ~= y)
+    error ("interval:InvalidOperand", ...
+           "affineform: exponent must be a nonzero integral number");
+  endif
+
+  ## Multiplication with the exact constant 1 is exact
+  p = abs (y);
+  result = 1;
+  while (p > 0)
+    if (mod (p, 2) == 1)
+      result = times (result, x);
+    endif
+    p = floor (p / 2);
+    if (p > 0)
+      x = sqr (x);
+    endif
+  endwhile
+
+  if (y < 0)
+    result = unary ("inv", result);
+  endif
+
+endfunction
+
+%!test
+%! x = infsup ([-2, -1, 0, 1, 0], [-1, 1, 0, 2, 3]);
+%! a = affineform (x);
+%! for p = [1, 2, 3, 5, -1, -2]
+%!   assert (all (subset (x .^ p, infsup (a .^ p))));
+%! endfor
+%!error affineform (infsup (1)) .^ 0
+%!error affineform (infsup (1)) .^ 0.5
+%!error 2 .^ affineform (infsup (1))
@@ -0,0 +1,53 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{Z} =} binary (@var{OP}, @var{X}, @var{Y})
+##
+## Compute the element-wise operation @var{OP} on the affine forms @var{X}
+## and @var{Y} with broadcasting.  Other operands are converted into affine
+## forms.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function z = binary (op, x, y)
+
+  x = affineform (x);
+  y = affineform (y);
+
+  ## Scalar operands are broadcasted by __affine__
+  warning ("off", "Octave:broadcast", "local");
+  x_idx = reshape (1 : numel (x.center), size (x.center));
+  y_idx = reshape (1 : numel (y.center), size (y.center));
+  dims = size (x_idx + y_idx);
+  if (numel (x_idx) ~= 1 && not (isequal (size (x_idx), dims)))
+    x = subsref (x, substruct ("()", {x_idx + zeros(dims)}));
+  endif
+  if (numel (y_idx) ~= 1 && not (isequal (size (y_idx), dims)))
+    y = subsref (y, substruct ("()", {y_idx + zeros(dims)}));
+  endif
+
+  [c, a, e] = __affine__ (op, x.center(:), x.coef, x.err(:), ...
+                          y.center(:), y.coef, y.err(:));
+  z = x;
+  z.center = reshape (c, dims);
+  z.coef = a;
+  z.err = reshape (e, dims);
+
+endfunction
@@ -0,0 +1,58 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{A} =} concatenate (@var{DIM}, @var{X1}, @var{X2}, @dots{})
+##
+## Concatenate affine forms along dimension @var{DIM}.  Operands, which are
+## no affine forms, are converted.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function A = concatenate (dim, varargin)
+
+  varargin = cellfun (@affineform, varargin, "UniformOutput", false);
+  A = varargin{1};
+
+  ## Concatenate the element indices to find the column order of the
+  ## coefficients
+  center = err = idx = coef = cell (size (varargin));
+  n = 0;
+  for i = 1 : numel (varargin)
+    x = varargin{i};
+    center{i} = x.center;
+    err{i} = x.err;
+    idx{i} = n + reshape (1 : numel (x.center), size (x.center));
+    coef{i} = x.coef;
+    n += numel (x.center);
+  endfor
+
+  ## All noise symbols, which are missing in an operand, have coefficient 0
+  k = max (cellfun (@rows, coef));
+  for i = 1 : numel (coef)
+    coef{i} = resize (coef{i}, k, columns (coef{i}));
+  endfor
+
+  A.center = cat (dim, center{:});
+  A.err = cat (dim, err{:});
+  idx = cat (dim, idx{:});
+  coef = horzcat (coef{:});
+  A.coef = coef(:, idx(:));
+
+endfunction
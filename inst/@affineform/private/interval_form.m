@@ -0,0 +1,39 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{Z} =} interval_form (@var{X})
+##
+## Convert the bare interval array @var{X} into an affine form without
+## noise symbols.  The result does not depend on any other affine form.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function z = interval_form (x)
+
+  [center, radius] = rad (x);
+  unbounded = isinf (radius);
+  center(unbounded) = 0;
+  radius(isnan (radius)) = 0;
+
+  z = affineform (zeros (size (x)));
+  z.center = center;
+  z.err = radius;
+
+endfunction
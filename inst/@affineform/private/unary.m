@@ -0,0 +1,35 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{Z} =} unary (@var{OP}, @var{X})
+##
+## Compute the element-wise function @var{OP} on the affine form @var{X}.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function z = unary (op, x)
+
+  [c, a, e] = __affine__ (op, x.center(:), x.coef, x.err(:));
+  z = x;
+  z.center = reshape (c, size (x.center));
+  z.coef = a;
+  z.err = reshape (e, size (x.center));
+
+endfunction
@@ -0,0 +1,51 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} rdivide (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} ./ @var{Y}}
+##
+## Compute the element-wise quotient of the affine forms @var{X} and @var{Y}.
+##
+## The quotient is computed as the product of @var{X} and the Chebyshev
+## approximation of the reciprocal of @var{Y}.  Where @var{Y} contains zero,
+## the reciprocal is computed in interval arithmetic.
+## @seealso{@@infsup/rdivide}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = rdivide (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  result = binary ("times", x, unary ("inv", affineform (y)));
+
+endfunction
+
+%!test
+%! a = affineform (infsup (1, 2));
+%! assert (subset (infsup (1), infsup (a ./ a)));
+%! assert (wid (infsup (a ./ a)) < wid (infsup (1, 2) ./ infsup (1, 2)));
+%!test
+%! x = infsup ([1, -1, 2], [2, 1, 4]);
+%! assert (all (subset (x ./ 3, infsup (affineform (x) ./ 3))));
+%! assert (all (subset (3 ./ x, infsup (3 ./ affineform (x)))));
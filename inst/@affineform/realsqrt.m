@@ -0,0 +1,47 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} realsqrt (@var{X})
+##
+## Compute the square root of each element of the affine form @var{X} with
+## a Chebyshev approximation.
+##
+## Where @var{X} is not nonnegative, the square root is computed in interval
+## arithmetic.
+## @seealso{@@infsup/realsqrt}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = realsqrt (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = unary ("realsqrt", x);
+
+endfunction
+
+%!test
+%! x = infsup ([1, 0, -1], [4, 2, 4]);
+%! y = infsup (realsqrt (affineform (x)));
+%! assert (all (subset (realsqrt (x), y)));
+%! assert (isequal (y(3), infsup (0, 2)));
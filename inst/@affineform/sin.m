@@ -0,0 +1,43 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} sin (@var{X})
+##
+## Compute the sine of each element of the affine form @var{X} in interval
+## arithmetic.
+##
+## The result has no noise symbols and, thus, does not depend on @var{X}.
+## @seealso{@@infsup/sin}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = sin (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = interval_form (sin (infsup (x)));
+
+endfunction
+
+%!assert (isequal (infsup (sin (affineform (infsup (0)))), infsup (0)));
+%!assert (subset (sin (infsup (1, 2)), infsup (sin (affineform (infsup (1, 2))))));
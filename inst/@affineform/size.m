@@ -0,0 +1,52 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypemethod {@@affineform} {@var{SZ} =} size (@var{A})
+## @deftypemethodx {@@affineform} {@var{DIM_SZ} =} size (@var{A}, @var{DIM})
+## @deftypemethodx {@@affineform} {[@var{ROWS, COLS, ..., DIM_N_SZ}] =} size (...)
+##
+## Return the size of the affine form @var{A}.
+##
+## @seealso{@@affineform/numel, @@affineform/end}
+## @end deftypemethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function varargout = size (A, dim)
+
+  if (nargin == 0 || nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (nargin == 1)
+    varargout = cell (1, max (1, nargout));
+    [varargout{:}] = size (A.center);
+  else
+    if (nargout > 1)
+      print_usage ();
+      return
+    endif
+    varargout{1} = size (A.center, dim);
+  endif
+
+endfunction
+
+%!assert (size (affineform (infsup (1 : 3))), [1, 3]);
+%!assert (size (affineform (zeros (2, 3)), 1), 2);
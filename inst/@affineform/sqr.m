@@ -0,0 +1,47 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@affineform} sqr (@var{X})
+##
+## Compute the square of each element of the affine form @var{X} with a
+## Chebyshev approximation.
+## @seealso{@@infsup/sqr}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = sqr (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = unary ("sqr", x);
+
+endfunction
+
+%!test
+%! a = affineform (infsup ([-1, 1, -inf], [1, 3, 0]));
+%! y = infsup (sqr (a));
+%! assert (all (subset (sqr (infsup ([-1, 1, -inf], [1, 3, 0])), y)));
+%! assert (sup (y(2)), 9);
+%!test
+%! a = affineform (infsup (1, 3));
+%! assert (wid (infsup (sqr (a) - 4 * a)) < wid (sqr (infsup (1, 3)) - 4 * infsup (1, 3)));
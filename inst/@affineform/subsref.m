@@ -0,0 +1,80 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} subsref (@var{A}, @var{IDX})
+## @defopx Operator {@@affineform} {@var{A}(@var{I})}
+## @defopx Operator {@@affineform} {@var{A}(@var{I}, @var{J})}
+##
+## Select elements from the affine form @var{A}.
+##
+## The selected elements keep their noise symbols and, thus, their
+## dependency on the other elements of @var{A}.
+##
+## @example
+## @group
+## a = affineform (infsup ([1, 2], [3, 4]));
+## infsup (a(2) - a(1) - a(2))
+##   @result{} ans = [-3, -1]
+## @end group
+## @end example
+## @seealso{@@affineform/end}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = subsref (A, S)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  switch (S(1).type)
+    case "()"
+      idx = reshape (1 : numel (A.center), size (A.center));
+      idx = idx(S(1).subs{:});
+      result = A;
+      result.center = A.center(idx);
+      result.coef = A.coef(:, idx(:));
+      result.err = A.err(idx);
+    case "{}"
+      error ("interval:InvalidOperand", ...
+             "affineform cannot be indexed with {}");
+    otherwise
+      error ("interval:InvalidOperand", ...
+             "affineform cannot be indexed with %s", S(1).type);
+  endswitch
+
+  if (numel (S) > 1)
+    result = subsref (result, S(2 : end));
+  endif
+
+endfunction
+
+%!# from the documentation string
+%!test
+%! a = affineform (infsup ([1, 2], [3, 4]));
+%! assert (isequal (infsup (a(2) - a(1) - a(2)), infsup (-3, -1)));
+
+%!test
+%! a = affineform (infsup (magic (3), magic (3) + 1));
+%! assert (size (a(:, 2)), [3, 1]);
+%! assert (isequal (infsup (a(2, :)), infsup ([3, 5, 7], [4, 6, 8])));
+%!error subsref (affineform (infsup (1)), substruct ("{}", {1}))
+%!error affineform (infsup (1)).center
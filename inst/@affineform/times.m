@@ -0,0 +1,52 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} times (@var{X}, @var{Y})
+## @defopx Operator {@@affineform} {@var{X} .* @var{Y}}
+##
+## Compute the element-wise product of the affine forms @var{X} and @var{Y}.
+##
+## The product of the linear parts is exact up to rounding errors, the
+## quadratic term is bounded by the product of the radii of @var{X} and
+## @var{Y} and added to the error term.
+## @seealso{@@infsup/times}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = times (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  result = binary ("times", x, y);
+
+endfunction
+
+%!test
+%! a = affineform (infsup (-1, 1));
+%! assert (isequal (infsup (a .* a), infsup (-1, 1)));
+%! assert (isequal (infsup (a .* (2 - a)), infsup (-3, 3)));
+%! assert (isequal (infsup (a .* 0), infsup (0)));
+%!test
+%! x = infsup ([-2, -1, 0, 1], [-1, 1, 0, 3]);
+%! y = infsup ([1; -3], [2; -2]);
+%! assert (all (all (subset (x .* y, infsup (affineform (x) .* y)))));
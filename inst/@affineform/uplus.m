@@ -0,0 +1,40 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} uplus (@var{X})
+## @defopx Operator {@@affineform} {+@var{X}}
+##
+## Return the affine form @var{X}.
+## @seealso{@@infsup/uplus}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = uplus (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = x;
+
+endfunction
+
+%!assert (isequal (infsup (+affineform (infsup (1, 2))), infsup (1, 2)));
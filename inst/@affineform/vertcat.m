@@ -0,0 +1,43 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@affineform} vertcat (@var{ARRAY1}, @var{ARRAY2}, @dots{})
+## @defopx Operator {@@affineform} {[@var{ARRAY1}; @var{ARRAY2}; @dots{}]}
+##
+## Return the vertical concatenation of affine forms along dimension 1.
+##
+## Other arguments are converted to affine forms.
+##
+## @seealso{@@affineform/horzcat}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = vertcat (varargin)
+
+  result = concatenate (1, varargin{:});
+
+endfunction
+
+%!test
+%! a = affineform (infsup ([1, 2], [2, 3]));
+%! b = [a; infsup([4, 5]); a];
+%! assert (size (b), [3, 2]);
+%! assert (isequal (infsup (b(3, :) - b(1, :)), infsup ([0, 0])));
+%! assert (isequal (infsup (b(2, :)), infsup ([4, 5])));
@@ -52,55 +52,11 @@ function [a, b] = bisect (x)
     return
   endif
 
-  m = zeros (size (x.inf));
-  idx.type = '()';
-
-  positive = x.inf >= 0 & x.sup > 0;
-  if (any (positive(:)))
-    idx.subs = {positive};
-    bounded = intersect (infsup (pow2 (-1074), realmax), subsref (x, idx));
-    m(positive) = min (realmax, pow2 (mid (log2 (bounded))));
-  endif
-
-  negative = x.inf < 0 & x.sup <= 0;
-  if (any (negative(:)))
-    idx.subs = {negative};
-    bounded = intersect (infsup (-realmax, -pow2 (-1074)), subsref (x, idx));
-    m(negative) = ...
-    uminus (min (realmax, pow2 (mid (log2 (uminus (bounded))))));
-  endif
-
-  both_signs = x.inf < 0 & x.sup > 0;
-  both_signs_p = both_signs & x.sup > -x.inf;
-  if (any (both_signs_p(:)))
-    idx.subs = {both_signs_p};
-    bounded_n = intersect (infsup (-realmax, -pow2 (-1074)), subsref (x, idx));
-    bounded_p = intersect (infsup (pow2 (-1074), realmax), subsref (x, idx));
-    m(both_signs_p) = min (realmax, pow2 (
-                                        mid (log2 (bounded_p)) ...
-                                        - mid (log2 (uminus (bounded_n))) ...
-                                        - 1074));
-  endif
-
-  both_signs_n = both_signs & x.sup < -x.inf;
-  if (any (both_signs_n(:)))
-    idx.subs = {both_signs_n};
-    bounded_n = intersect (infsup (-realmax, -pow2 (-1074)), subsref (x, idx));
-    bounded_p = intersect (infsup (pow2 (-1074), realmax), subsref (x, idx));
-    m(both_signs_n) = uminus (min (realmax, ...
-                                   pow2 (mid (log2 (uminus (bounded_n))) ...
-                                         - mid (log2 (bounded_p)) ...
-                                         - 1074)));
-  endif
-
-  m = min (max (m, x.inf), x.sup);
+  [m_sup, m_inf] = __subdivide__ ("bisect", x.inf, x.sup);
 
   a = b = x;
-  m(isempty (x)) = -inf;
-  a.sup = m;
-  m(isempty (x)) = inf;
-  m(m == 0) = -0;
-  b.inf = m;
+  a.sup = m_sup;
+  b.inf = m_inf;
 
 endfunction
 
@@ -129,6 +85,10 @@ endfunction
 %! [a, b] = bisect (infsup (-inf, 0));
 %! assert (a == infsup (-inf, -pow2 (-25)));
 %! assert (b == infsup (-pow2 (-25), 0));
+%!test
+%! [a, b] = bisect (infsup ([1, -4; 0, -inf], [4, -1; 0, inf]));
+%! assert (isequal (a, infsup ([1, -4; 0, -inf], [2, -2; 0, 0])));
+%! assert (isequal (b, infsup ([2, -2; 0, 0], [4, -1; 0, inf])));
 %!# correct use of signed zeros
 %!test
 %! [a, b] = bisect (infsup (0));
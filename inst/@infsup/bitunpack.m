@@ -31,7 +31,7 @@
 ## For all scalar intervals the following equation holds:
 ## @code{@var{X} == interval_bitpack (bitunpack (@var{X}))}.
 ##
-## @seealso{interval_bitpack}
+## @seealso{interval_bitpack, interval_pack}
 ## @end defmethod
 
 ## Author: Oliver Heimlich
@@ -49,21 +49,11 @@ function result = bitunpack (x)
   ## representation of [0, 0] is (-0, +0). Both is guaranteed by the infsup
   ## constructor.
 
-  l = bitunpack (x.inf);
-  u = bitunpack (x.sup);
-
-  ## Initialize result vector
-  result = zeros (1, length (l) + length (u), 'logical');
-  if (not (isrow (l)))
-    result = result';
+  result = bitunpack (interval_pack (x));
+  if (isrow (x.inf))
+    result = result.';
   endif
 
-  ## Merge 64 bit blocks from l and u (alternating) together into result.
-  target = reshape (1 : length (result), 64, numel (x.inf) + numel (x.sup));
-  target(:, 2 : 2 : size (target, 2)) = [];
-  result(target) = l;
-  result(target + 64) = u;
-
 endfunction
 
 %!test;
@@ -33,16 +33,16 @@
 ## @var{R}' * @var{R} = @var{A}.
 ## @end display
 ##
-## @example
-## @group
+## @example
+## @group
 ## chol (infsup (pascal (3)))
 ##   @result{} ans = 3×3 interval matrix
 ##
 ##        [1]   [1]   [1]
 ##        [0]   [1]   [2]
 ##        [0]   [0]   [1]
-##
-## @end group
+##
+## @end group
 ## @end example
 ##
 ## Called using the @option{lower} flag, @command{chol} returns the lower
@@ -75,8 +75,8 @@
 ## This function tries to guarantee that each symmetric matrix in @var{A} is
 ## positive definite.  If that fails, a warning is triggered.
 ##
-## @example
-## @group
+## @example
+## @group
 ## A = infsup (pascal (3));
 ## A(3, 3) = "[5, 6]";
 ## chol (A)
@@ -87,7 +87,7 @@
 ##        [0]   [1]      [2]
 ##        [0]   [0]   [0, 1]
 ##
-## @end group
+## @end group
 ## @end example
 ##
 ## @seealso{@@infsup/lu, @@infsup/qr}
@@ -118,44 +118,30 @@ function [fact, P] = chol (A, option)
 
   ## Matrix is symmetric by definition, eliminate illegal values
   A = intersect (A, A');
-  P = 0;
 
-  ## columnwise computation of L done in frame of A
-  for k = 1 : n
-    idx_diag = substruct ("()", {k, k});
-    ## row vector # enables vectorized computation
-    el = subsref (A, substruct ("()", {k, 1 : k - 1}));
-    ## first main formula (diagonal entry)
-    alpha = subsref (A, idx_diag) - el * el';
-    if (inf (alpha) <= 0)
-      if (sup (alpha) <= 0)
-        ## each symmetric Ao in A verified not to be PD
-        P = -alpha.sup;
-        if (nargout < 2)
-          error ("chol: matrix is not positive definite");
-        endif
-      else
-        ## continue only on PD values, but warn about it
-        warning ("chol:PD", ...
-                 "chol: matrix is not guaranteed to be positive definite");
-      endif
+  ## The factorization is computed with exact dot products in a single
+  ## compiled pass over the upper triangle
+  [l, u, notpd, uncertain, P] = __chol__ (A.inf, A.sup);
+  if (notpd)
+    ## each symmetric Ao in A verified not to be PD
+    if (nargout < 2)
+      error ("chol: matrix is not positive definite");
     endif
-    s = sqrt (alpha);
-    A = subsasgn (A, idx_diag, s);
-    ## second main formula (subdiagonal entries)
-    idx_subdiag = substruct ("()", {k + 1 : n, k});
-    A = subsasgn (A, idx_subdiag, ...
-                  (subsref (A, idx_subdiag) - ...
-                   subsref (A, substruct ("()", {k + 1 : n, 1 : k - 1})) * ...
-                   el') ./ s);
-  endfor
+  elseif (uncertain)
+    ## continue only on PD values, but warn about it
+    warning ("chol:PD", ...
+             "chol: matrix is not guaranteed to be positive definite");
+  endif
+
   ## verified Cholesky decomposition found
-  L = tril (A); # lower triangular part extracted
+  R = infsup ();
+  R.inf = l;
+  R.sup = u;
   switch (option)
     case "lower"
-      fact = L;
+      fact = R';
     case "upper"
-      fact = L';
+      fact = R;
   endswitch
 
 endfunction
@@ -167,3 +153,14 @@ endfunction
 %! R = chol (A);
 %! assert (ismember ([sqrt(2), 1/sqrt(2); 0, 1/sqrt(2)], R));
 %! assert (wid (R) < 1e-15);
+%!test
+%! A = infsup (pascal (3));
+%! A(3, 3) = "[5, 6]";
+%! warning ("off", "chol:PD", "local");
+%! R = chol (A);
+%! assert (isequal (R(3, 3), infsup (0, 1)));
+%! assert (isequal (chol (A, "lower"), R'));
+%!error <not positive definite> chol (infsup ([1, 2; 2, 1]))
+%!test
+%! [R, P] = chol (infsup ([1, 2; 2, 1]));
+%! assert (P, 3);
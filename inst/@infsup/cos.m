@@ -41,70 +41,7 @@ function x = cos (x)
     return
   endif
 
-  l = u = sinsignl = sinsignu = zeros (size (x.inf));
-
-  ## Check, if wid (x) is certainly greater than 2*pi. This can save the
-  ## computation if some cosine values.
-  width = mpfr_function_d ('minus', -inf, x.sup, x.inf);
-  persistent pi = infsup ("pi");
-  persistent twopi = 2 .* pi;
-  certainlyfullperiod = width >= sup (twopi);
-  l(certainlyfullperiod) = -1;
-  u(certainlyfullperiod) = 1;
-
-  possiblynotfullperiod = not (certainlyfullperiod);
-  if (__check_crlibm__ ())
-    l(possiblynotfullperiod) = min (crlibm_function ('cos', -inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    crlibm_function ('cos', -inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-    u(possiblynotfullperiod) = max (crlibm_function ('cos', inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    crlibm_function ('cos', inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-
-    ## We use sign (-sin) to know the gradient at the boundaries.
-    sinsignl(possiblynotfullperiod) = sign (-crlibm_function ('sin', .5, ...
-                                                              x.inf(possiblynotfullperiod)));
-    sinsignu(possiblynotfullperiod) = sign (-crlibm_function ('sin', .5, ...
-                                                              x.sup(possiblynotfullperiod)));
-  else
-    l(possiblynotfullperiod) = min (mpfr_function_d ('cos', -inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    mpfr_function_d ('cos', -inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-    u(possiblynotfullperiod) = max (mpfr_function_d ('cos', inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    mpfr_function_d ('cos', inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-
-    ## We use sign (-sin) to know the gradient at the boundaries.
-    sinsignl(possiblynotfullperiod) = sign (-mpfr_function_d ('sin', .5, ...
-                                                              x.inf(possiblynotfullperiod)));
-    sinsignu(possiblynotfullperiod) = sign (-mpfr_function_d ('sin', .5, ...
-                                                              x.sup(possiblynotfullperiod)));
-  endif
-
-  ## In case of sign (-sin) == 0, we conservatively use sign (-sin) of nextout.
-  sinsignl(sinsignl == 0) = (-1) .* sign (l(sinsignl == 0));
-  sinsignu(sinsignu == 0) = sign (u(sinsignu == 0));
-
-  containsinf = possiblynotfullperiod & ((sinsignl == -1 & sinsignu == 1) | ...
-                                         (sinsignl == sinsignu & ...
-                                          width >= sup (pi))) ...
-                & ne (0, x);
-  l(containsinf) = -1;
-
-  containssup = possiblynotfullperiod & ((sinsignl == 1 & sinsignu == -1) | ...
-                                         (sinsignl == sinsignu & ...
-                                          width >= sup (pi)));
-  u(containssup) = 1;
-
-  emptyresult = isempty (x);
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
-
-  l(l == 0) = -0;
+  [l, u] = __trigonometric__ ("cos", x.inf, x.sup);
 
   x.inf = l;
   x.sup = u;
@@ -114,6 +51,11 @@ endfunction
 %!# from the documentation string
 %!assert (cos (infsup (1)) == "[0x1.14A280FB5068Bp-1, 0x1.14A280FB5068Cp-1]");
 
+%!# unbounded intervals contain a whole period
+%!assert (cos (infsup (-inf, 0)) == infsup (-1, 1));
+%!assert (cos (infsup (0, inf)) == infsup (-1, 1));
+%!assert (cos (entire ()) == infsup (-1, 1));
+
 %!shared testdata
 %! # Load compiled test data (from src/test/*.itl)
 %! testdata = load (file_in_loadpath ("test/itl.mat"));
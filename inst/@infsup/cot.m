@@ -41,35 +41,7 @@ function x = cot (x)
     return
   endif
 
-  l = u = zeros (size (x));
-
-  ## Check, if wid (x) is certainly greater than pi. This may save computation of
-  ## some cotangent values.
-  width = mpfr_function_d ('minus', -inf, x.sup, x.inf);
-  persistent pi = infsup ("pi");
-  certainlyfullperiod = width >= sup (pi);
-
-  possiblynotfullperiod = not (certainlyfullperiod);
-  l(possiblynotfullperiod) = ...
-  mpfr_function_d ('cot', -inf, x.sup(possiblynotfullperiod));
-  u(possiblynotfullperiod) = ...
-  mpfr_function_d ('cot', +inf, x.inf(possiblynotfullperiod));
-
-  l(x.sup == 0) = -inf;
-  u(x.inf == 0) = +inf;
-
-  singularity = certainlyfullperiod | ...
-                l > u | (...
-                          width > 2 & (...
-                                        sign (l) == sign (u) | ...
-                                        max (abs (l), abs (u)) < 1));
-
-  l(singularity) = -inf;
-  u(singularity) = inf;
-
-  emptyresult = isempty (x) | (x.inf == 0 & x.sup == 0);
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
+  [l, u] = __trigonometric__ ("cot", x.inf, x.sup);
 
   x.inf = l;
   x.sup = u;
@@ -79,6 +51,11 @@ endfunction
 %!# from the documentation string
 %!assert (cot (infsup (1)) == "[0x1.48C05D04E1CFDp-1, 0x1.48C05D04E1CFEp-1]");
 
+%!# unbounded intervals contain a whole period
+%!assert (cot (infsup (-inf, 0)) == entire ());
+%!assert (cot (infsup (0, inf)) == entire ());
+%!assert (cot (entire ()) == entire ());
+
 %!shared testdata
 %! # Load compiled test data (from src/test/*.itl)
 %! testdata = load (file_in_loadpath ("test/itl.mat"));
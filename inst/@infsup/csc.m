@@ -41,44 +41,7 @@ function x = csc (x)
     return
   endif
 
-  l = u = derivl = derivu = zeros (size (x.inf));
-
-  ## Check, if wid (x) is certainly greater than 2*pi. This can save the
-  ## computation if some values.
-  width = mpfr_function_d ('minus', -inf, x.sup, x.inf);
-  persistent pi = infsup ("pi");
-  certainlysingularity = width >= sup (pi);
-
-  ## We simply compute the cosecant for both endpoints.
-  x.inf(x.inf == 0) = +0;
-  x.sup(x.sup == 0) = -0;
-  select = not (certainlysingularity);
-  l(select) = min (...
-                    mpfr_function_d ('csc', -inf, x.inf(select)), ...
-                    mpfr_function_d ('csc', -inf, x.sup(select)));
-  u(select) = max (...
-                    mpfr_function_d ('csc', inf, x.inf(select)), ...
-                    mpfr_function_d ('csc', inf, x.sup(select)));
-
-  ## A change of sign is a sufficient singularity indicator
-  certainlysingularity = certainlysingularity | (select & sign (l) ~= sign (u));
-  l(certainlysingularity) = -inf;
-  u(certainlysingularity) = inf;
-
-  ## Check, whether the interval contains a local extremum using the derivative
-  select = not (certainlysingularity);
-  derivl(select) = -mpfr_function_d ('csc', 0, x.inf(select)) .* ...
-                    mpfr_function_d ('cot', 0, x.inf(select));
-  derivu(select) = -mpfr_function_d ('csc', 0, x.sup(select)) .* ...
-                    mpfr_function_d ('cot', 0, x.sup(select));
-  hasextremum = select & ((derivl <= 0 & derivu >= 0) | ...
-                          (derivl >= 0 & derivu <= 0));
-  l(hasextremum & l > 0) = 1;
-  u(hasextremum & u < 0) = -1;
-
-  emptyresult = isempty (x) | (x.inf == 0 & x.sup == 0);
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
+  [l, u] = __trigonometric__ ("csc", x.inf, x.sup);
 
   x.inf = l;
   x.sup = u;
@@ -88,6 +51,11 @@ endfunction
 %!# from the documentation string
 %!assert (csc (infsup (1)) == "[0x1.303AA9620B223, 0x1.303AA9620B224]");
 
+%!# unbounded intervals contain a whole period
+%!assert (csc (infsup (-inf, 0)) == entire ());
+%!assert (csc (infsup (0, inf)) == entire ());
+%!assert (csc (entire ()) == entire ());
+
 %!shared testdata
 %! # Load compiled test data (from src/test/*.itl)
 %! testdata = load (file_in_loadpath ("test/itl.mat"));
@@ -0,0 +1,74 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@infsup} cumprod (@var{X})
+## @defmethodx {@@infsup} cumprod (@var{X}, @var{DIM})
+##
+## Cumulative product of elements along dimension @var{DIM}.  If @var{DIM} is
+## omitted, it defaults to the first non-singleton dimension.
+##
+## Accuracy: The result is a valid enclosure.
+##
+## @example
+## @group
+## cumprod (infsup (1 : 4))
+##   @result{} ans = 1×4 interval vector
+##
+##      [1]   [2]   [6]   [24]
+##
+## @end group
+## @end example
+## @seealso{@@infsup/prod, @@infsup/cumsum}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = cumprod (x, dim)
+
+  if (nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (nargin < 2)
+    ## Try to find non-singleton dimension
+    dim = find (size (x.inf) ~= 1, 1);
+    if (isempty (dim))
+      dim = 1;
+    endif
+  endif
+
+  [l, u] = __cumulative__ ("prod", x.inf, x.sup, dim);
+
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
+
+endfunction
+
+%!# from the documentation string
+%!assert (cumprod (infsup (1 : 4)) == [1, 2, 6, 24]);
+
+%!assert (isempty (cumprod (infsup ([]))));
+%!assert (cumprod (infsup (magic (3))) == cumprod (magic (3)));
+%!assert (cumprod (infsup (magic (3)), 2) == cumprod (magic (3), 2));
+%!assert (cumprod (infsup ([-1, 2], [1, 3])) == infsup ([-1, -3], [1, 3]));
+%!test
+%! x = cumprod ([infsup(2), infsup(0), entire()]);
+%! assert (x == [2, 0, 0]);
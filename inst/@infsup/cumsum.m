@@ -0,0 +1,76 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@infsup} cumsum (@var{X})
+## @defmethodx {@@infsup} cumsum (@var{X}, @var{DIM})
+##
+## Cumulative sum of elements along dimension @var{DIM}.  If @var{DIM} is
+## omitted, it defaults to the first non-singleton dimension.
+##
+## Accuracy: The result is a tight enclosure.  Each element is computed from
+## an exact running sum, which is rounded only once.
+##
+## @example
+## @group
+## cumsum (infsup ([1, pow2(-1074), -1]))
+##   @result{} ans ⊂ 1×3 interval vector
+##
+##              [1]   [1, 1.0001]   [4.9406e-324, 4.9407e-324]
+##
+## @end group
+## @end example
+## @seealso{@@infsup/sum, @@infsup/cumprod}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = cumsum (x, dim)
+
+  if (nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (nargin < 2)
+    ## Try to find non-singleton dimension
+    dim = find (size (x.inf) ~= 1, 1);
+    if (isempty (dim))
+      dim = 1;
+    endif
+  endif
+
+  [l, u] = __cumulative__ ("sum", x.inf, x.sup, dim);
+
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
+
+endfunction
+
+%!# from the documentation string
+%!assert (cumsum (infsup ([1, pow2(-1074), -1])) == infsup ([1, 1, pow2(-1074)], [1, 1 + eps, pow2(-1074)]));
+
+%!assert (isempty (cumsum (infsup ([]))));
+%!assert (cumsum (infsup (magic (3))) == cumsum (magic (3)));
+%!assert (cumsum (infsup (magic (3)), 2) == cumsum (magic (3), 2));
+%!assert (cumsum (infsup (magic (3)), 3) == magic (3));
+%!assert (cumsum (infsup (ones (1, 1, 3))) == cumsum (ones (1, 1, 3)));
+%!test
+%! x = cumsum ([infsup(1), empty(), infsup(2)]);
+%! assert (isequal (isempty (x), [false, true, true]));
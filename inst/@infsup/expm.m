@@ -16,6 +16,7 @@
 ## -*- texinfo -*-
 ## @documentencoding UTF-8
 ## @defmethod {@@infsup} expm (@var{A})
+## @defmethodx {@@infsup} expm (@var{A}, @var{ACCURACY})
 ##
 ## Compute the matrix exponential of square matrix @var{A}.
 ##
@@ -51,6 +52,13 @@
 ## The algorithm has been published by Alexandre Goldsztejn and Arnold
 ## Neumaier (2009), “On the Exponentiation of Interval Matrices.”
 ##
+## All three steps are computed by a compiled function on a fixed workspace.
+## The @var{ACCURACY} can be set to @code{tight} (default) or @code{valid}.
+## With @code{tight} accuracy, all dot products are exact and rounded only
+## once.  With @code{valid} accuracy, the dot products are computed in
+## floating-point arithmetic and enclosed by a priori error bounds, which is
+## faster but produces wider results.
+##
 ## Accuracy: The result is a valid enclosure.
 ##
 ## @example
@@ -77,9 +85,16 @@
 ## Keywords: interval
 ## Created: 2016-01-26
 
-function result = expm (A)
+function result = expm (A, accuracy)
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+    return
+  endif
 
-  if (nargin ~= 1)
+  if (nargin < 2)
+    accuracy = "tight";
+  elseif (not (any (strcmp (accuracy, {"tight", "valid"}))))
     print_usage ();
     return
   endif
@@ -95,30 +110,20 @@ function result = expm (A)
            "expm: must be square matrix");
   endif
 
-  ## Choose L such that ||A|| / 2^L < 0.1 and 10 <= L <= 100
-  L = min (max (inf (ceil (log2 (10 * norm (A, inf)))), 10), 100);
-  ## Choose K such that K + 2 > ||A|| and 10 <= K <= 170
-  K = min (max (inf (ceil (norm (A, inf) - 2)), 10), 170);
-
-  ## 1. Scale
-  A = rdivide (A, pow2 (L));
+  [l, u] = __expm__ (A.inf, A.sup, strcmp (accuracy, "valid"));
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
 
-  ## 2. Compute Taylor series
-  ## Compute Horner scheme: I + A*(I + A/2*(I + A/3*( ... (I + A/K) ... )))
-  result = I = eye (size (A.inf));
-  for k = K : -1 : 1
-    result = I + A ./ k * result;
-  endfor
-  ## Truncation error for the exponential series
-  alpha = norm (A, inf);
-  rho = pown (alpha, K + 1) ./ ...
-        (factorial (infsup (K + 1)) * (1 - alpha ./ (K + 2)));
-  warning ("off", "interval:ImplicitPromote", "local");
-  truncation_error = rho .* infsup (-1, 1);
-  result = result + truncation_error;
-
-  ## 3. Squaring
-  result = mpower (result, pow2 (L));
+  if (isa (A, "infsupdec"))
+    ## The matrix exponential is continuous and defined everywhere
+    dec = decorationpart (A, "uint8");
+    if (isempty (dec))
+      result = newdec (result);
+    else
+      result = infsupdec (result, __decorate__ (result, min (dec(:))));
+    endif
+  endif
 
 endfunction
 
@@ -126,3 +131,14 @@ endfunction
 %!test
 %! A = infsup ([0 1; 0 -3], [0 1; 0 -2]);
 %! assert (all (all (subset (infsup ([1, 0.316738; 0, 0.0497871], [1, 0.432332; 0, 0.135335]), expm (A)))));
+%!test
+%! A = infsup ([0 1; 0 -3], [0 1; 0 -2]);
+%! assert (all (all (subset (expm (A), expm (A, "valid")))));
+%!test
+%! A = [1, 2; 3, 4] / 10;
+%! assert (all (all (ismember (expm (A), expm (infsup (A))))));
+%!test
+%! x = expm (infsupdec (eye (2), "dac"));
+%! assert (isequal (decorationpart (x), repmat ({"dac"}, 2, 2)));
+%! assert (all (all (ismember (expm (eye (2)), x))));
+%!error expm (infsup (eye (2)), "fast")
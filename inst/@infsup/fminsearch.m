@@ -82,12 +82,22 @@
 ## @end group
 ## @end example
 ##
+## If @var{f} is a function handle, it is traced with
+## @code{intervaltape (@var{f}, size (@var{X0}))} for bare intervals
+## @var{X0}.  The traced expression evaluates the function on both halves of
+## a bisected box and their midpoints in a single compiled pass.  It is only
+## used if it reproduces the first function value exactly.  Without options
+## @option{OutputFcn} and @code{Display = "iter"}, the whole search then
+## runs in compiled code with a priority queue of candidate boxes, and uses
+## the gradient of the traced expression for mean value forms and
+## monotonicity tests, see @code{@@intervaltape/fminsearch}.
+##
 ## The function utilizes the Skelboe-Moore algorithm and has been implemented
 ## after Algorithm 6.1 in R. E. Moore, R. B. Kearfott, and M. J. Cloud.  2009.
 ## Introduction to Interval Analysis.  Society for Industrial and Applied
 ## Mathematics.
 ##
-## @seealso{optimset}
+## @seealso{optimset, @@intervaltape/fminsearch}
 ## @end deftypemethod
 
 ## Author: Oliver Heimlich
@@ -130,6 +140,20 @@ function [X, FVAL, iter] = fminsearch (f, X, options)
     f_ub = sup (fmX);
   endif
 
+  ## 2 Trace the function to evaluate it for several boxes at once
+  tape = [];
+  if (not (isa (X, "infsupdec")))
+    m = mid (X)(:);
+    tape = trace_objective (f, {size(X)}, ...
+                            @(t) isequal (evaluate_batch (t, m, m), fmX));
+  endif
+  if (isa (tape, "intervaltape") && not (displayiter) ...
+      && isempty (options.OutputFcn))
+    ## Run the whole search in compiled code
+    [X, FVAL, iter] = fminsearch (tape, X, options);
+    return
+  endif
+
   ## 3 Initialize queues
   ## C: Completed boxes where accuracy has been reached (it suffices to store a
   ##    single element, because this function doesn't return all candidates)
@@ -161,19 +185,36 @@ function [X, FVAL, iter] = fminsearch (f, X, options)
       feval (options.OutputFcn, X2);
     endif
 
+    if (isa (tape, "intervaltape"))
+      ## Evaluate the midpoints and the boxes in a single pass
+      m1 = mid (X1)(:);
+      m2 = mid (X2)(:);
+      fval = evaluate_batch (tape, [m1, m2, X1.inf(:), X2.inf(:)], ...
+                                   [m1, m2, X1.sup(:), X2.sup(:)]);
+      idx.subs = {1};
+      fmX1 = subsref (fval, idx);
+      idx.subs = {2};
+      fmX2 = subsref (fval, idx);
+      idx.subs = {3};
+      f1 = subsref (fval, idx);
+      idx.subs = {4};
+      f2 = subsref (fval, idx);
+    else
+      fmX1 = feval (f, infsup (mid (X1)));
+      fmX2 = feval (f, infsup (mid (X2)));
+      f1 = feval (f, X1);
+      f2 = feval (f, X2);
+    endif
+
     ## 5 Improve upper bound
-    fmX1 = feval (f, infsup (mid (X1)));
     if (not (isempty (fmX1)))
       f_ub = min (f_ub, sup (fmX1));
     endif
-    fmX2 = feval (f, infsup (mid (X2)));
     if (not (isempty (fmX2)))
       f_ub = min (f_ub, sup (fmX2));
     endif
 
     ## 6 Quit current X box if accuracy has been reached
-    f1 = feval (f, X1);
-    f2 = feval (f, X2);
     feval_count += 4;
 
     cancel_algorithm = feval_count >= options.MaxFunEvals || ...
@@ -278,6 +319,12 @@ endfunction
 %!  [x, y] = fminsearch (sqr, infsup (-inf, inf));
 %!  assert (y == 0);
 
+%!test
+%!  f = @(x) (x(1) - 1) .^ 2 + x(2) .^ 2;
+%!  [~, fval] = fminsearch (f, infsup ([-2, -2], [2, 2]));
+%!  assert (subset (infsup (0), fval));
+%!  assert (inf (fval) > -1e-4);
+
 %!demo
 %!  clf
 %!  hold on
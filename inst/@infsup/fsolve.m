@@ -141,6 +141,22 @@
 ## vectorization.  For higher dimensions of @var{X0} it is also necessary to
 ## use a contraction function.
 ##
+## If @var{F} is a function handle and @option{Contract} is @code{false}, the
+## function is traced after its first evaluation with
+## @code{intervaltape (@var{F}, @dots{})}.  Subsequent function evaluations
+## use the traced expression, which is evaluated for all candidate boxes of
+## an iteration in a single compiled pass.  The traced expression is only
+## used if it reproduces the first function value exactly, otherwise, e.g.,
+## if @var{F} uses functions, which cannot be traced, @var{F} is called as
+## usual.  Before each evaluation, the boxes are contracted with the
+## forward-backward contractor of the traced expression, see
+## @code{@@intervaltape/contract}.  The Jacobian matrix of the traced
+## expression is computed together with the function values by automatic
+## differentiation, see @code{@@intervaltape/jacobian}.  It improves the
+## function values with the mean value form and, if @var{F} has as many
+## elements as @var{X0} and @var{Y}, contracts the boxes with the Krawczyk
+## operator, which is a multivariate interval Newton method.
+##
 ## Accuracy: The result is a valid enclosure.
 ##
 ## @seealso{@@infsup/fzero, ctc_union, ctc_intersect, optimset}
@@ -249,294 +265,232 @@ function [x, x_paving, x_inner_idx] = fsolve (f, x0, y, options)
       options.Vectorize = true;
     end_try_catch
   endif
+
+  warning ("off", "interval:ImplicitPromote", "local");
+  warning ("off", "Octave:broadcast", "local");
+
+  vectorize = false;
   if (options.Vectorize)
-    if (nargout >= 2)
-      [x, x_paving, x_inner_idx] = vectorized (f, x0, y, options);
+    vectorize = true;
+    ## Make the vectorization dimension orthogonal to the dimension of the
+    ## data in y to allow simple function definitions.
+    if (iscolumn (y))
+      data_dim = 1;
+      x_shape = [numel(x0), 1];
     else
-      x = vectorized (f, x0, y, options);
+      assert (isrow (y));
+      data_dim = 2;
+      x_shape = [1, numel(x0)];
     endif
-    return
+  else
+    data_dim = 1;
+    x_shape = size (x0);
   endif
 
-  warning ("off", "interval:ImplicitPromote", "local");
-  x = empty (size (x0));
-  x_paving = {};
-  x_inner_idx = false (0);
-  queue = {x0};
-  x_scalar = isscalar (x0);
-
-  ## Test functions
-  verify_subset = @(fval) all (subset (fval, y)(:));
-  verify_disjoint = @(fval) any (disjoint (fval, y)(:));
-  check_contradiction = @(x) any (isempty (x)(:));
-  max_wid = @(interval) max (wid (interval)(:));
-
-  ## Utility functions for bisection
-  if (x_scalar)
-    bisect_coord = {1};
-    exchange_coordinate = @(interval, coord, l, u) infsup (l, u);
+  ## The queue of candidate boxes and the paving store one box per column
+  ## in matrices of interval boundaries.  Classification and bisection of
+  ## the boxes are computed by __sivia__.
+  d = numel (x0);
+  queue_l = x0.inf(:);
+  queue_u = x0.sup(:);
+  x_l = inf (d, 1);
+  x_u = -inf (d, 1);
+  paving_l = paving_u = {zeros(d, 0)};
+  inner = {false(1, 0)};
+  y_l = y.inf(:);
+  y_u = y.sup(:);
+  if (isempty (options.TolFun))
+    tolfun = -inf;
   else
-    largest_coordinate = @(interval, max_wid) ...
-                          find (wid (interval) == max_wid, 1);
-    exchange_coordinate = @replace_coordinate;
+    tolfun = options.TolFun;
   endif
+  ## The function is traced after its first evaluation
+  tape = [];
+  trace = not (options.Contract);
+  hc4 = true;
 
-  while (not (isempty (queue)))
+  while (not (isempty (queue_l)))
     ## Evaluate f(x)
-    options.MaxFunEvals -= numel (queue);
+    if (vectorize)
+      options.MaxFunEvals--;
+    else
+      options.MaxFunEvals -= columns (queue_l);
+    endif
     options.MaxIter--;
     if (options.Contract)
-      [fval, contractions] = cellfun (f, {y}, queue, ...
-                                      "UniformOutput", false);
+      [fval_l, fval_u, contraction_l, contraction_u] = ...
+        contract_queue (f, y, queue_l, queue_u, x_shape, data_dim, ...
+                        vectorize);
       ## Sanitize the contractions returned by the function
-      queue = cellfun (@intersect, queue, contractions, ...
-                       "UniformOutput", false);
+      queue_l = max (queue_l, contraction_l);
+      queue_u = min (queue_u, contraction_u);
       ## Utilize contradictions to discard candidates
-      contradiction = cellfun (check_contradiction, queue);
-      queue = queue(not (contradiction));
-      if (isempty (queue))
+      consistent = all (queue_l <= queue_u, 1);
+      queue_l = queue_l(:, consistent);
+      queue_u = queue_u(:, consistent);
+      if (isempty (queue_l))
         break
       endif
-      fval = fval(not (contradiction));
-    else
-      fval = cellfun (f, queue, "UniformOutput", false);
-    endif
-    ## Check whether x is outside of the preimage of y
-    ## or x is inside the preimage of y
-    is_outside = cellfun (verify_disjoint, fval);
-    is_inside = cellfun (verify_subset, fval) & not (is_outside);
-    ## Store the verified subsets of the preimage of y and continue only on
-    ## elements that are not verified
-    x = hull (x, queue(is_inside){:});
-    x_paving = vertcat (x_paving, queue(is_inside));
-    x_inner_idx = vertcat (x_inner_idx, true (sum (is_inside), 1));
-    queue = queue(not (is_inside | is_outside));
-    ## Stop after MaxIter or MaxFunEvals
-    if (options.MaxIter <= 0 || options.MaxFunEvals <= 0)
-      x = hull (x, queue{:});
-      x_paving = vertcat (x_paving, queue);
-      x_inner_idx = vertcat (x_inner_idx, false (numel (queue), 1));
-      break
-    endif
-    ## Stop iteration for small intervals
-    if (not (isempty (options.TolFun)))
-      fval = fval(not (is_inside | is_outside));
-      widths = cellfun (max_wid, fval);
-      is_small = widths < options.TolFun;
-    else
-      is_small = false (size (queue));
-    endif
-    widths = cellfun (max_wid, queue);
-    is_small = is_small | (widths < options.TolX);
-    x = hull (x, queue(is_small){:});
-    x_paving = vertcat (x_paving, queue(is_small));
-    x_inner_idx = vertcat (x_inner_idx, false (sum (is_small), 1));
-    queue = queue(not (is_small));
-    widths = widths(not (is_small));
-    ## Bisect remaining intervals at the largest coordinate.
-    ##
-    ## Since the bisect function is the most costly, we want to call it only
-    ## once. Thus, we extract the largest coordinate from each interval array
-    ## inside queue and combine them into an interval vector [l_coord, u_coord]
-    ## with the length of queue. We call the bisect function on this vector,
-    ## which bisects each interval component and produces vectors
-    ## [l_coord, m_coord] and [m_coord, u_coord]. These are used to replace the
-    ## largest coordinate from each original interval array.
-    if (x_scalar)
-      [l_coord, u_coord] = ...
-      cellfun (@(interval) ...
-                deal (interval.inf, interval.sup), ...
-               queue);
+      if (columns (fval_l) == numel (consistent))
+        fval_l = fval_l(:, consistent);
+        fval_u = fval_u(:, consistent);
+      endif
+    elseif (isa (tape, "intervaltape"))
+      ## Forward-backward contraction, then discard boxes without solutions
+      if (hc4)
+        try
+          [queue_l, queue_u] = contract_batch (tape, queue_l, queue_u, ...
+                                               y_l, y_u);
+        catch
+          ## The contractor doesn't support array inputs of the expression
+          hc4 = false;
+        end_try_catch
+      endif
+      consistent = all (queue_l <= queue_u, 1);
+      queue_l = queue_l(:, consistent);
+      queue_u = queue_u(:, consistent);
+      if (isempty (queue_l))
+        break
+      endif
+      [fval_l, fval_u, queue_l, queue_u] = ...
+        mean_value_batch (tape, queue_l, queue_u, y_l, y_u);
     else
-      bisect_coord = cellfun (largest_coordinate, ...
-                              queue, num2cell (widths), ...
-                              "UniformOutput", false);
-      [l_coord, u_coord] = ...
-      cellfun (@(interval, coord) ...
-                deal (interval.inf(coord), interval.sup(coord)), ...
-               queue, bisect_coord);
-    endif
-    m_coord = mid (infsup (l_coord, u_coord));
-    l_coord = num2cell (l_coord);
-    m_coord = num2cell (m_coord);
-    u_coord = num2cell (u_coord);
-    queue = vertcat (...
-                      cellfun (exchange_coordinate, ...
-                               queue, bisect_coord, l_coord, m_coord, ...
-                               "UniformOutput", false), ...
-                      cellfun (exchange_coordinate, ...
-                               queue, bisect_coord, m_coord, u_coord, ...
-                               "UniformOutput", false));
-    ## Short-circuit if no paving must be computed and remaining intervals
-    ## are subsets of the already computed interval enclosure.
-    if (isempty (queue))
-      break
-    endif
-    if (nargout < 2)
-      x_bare = intervalpart (x);
-      queue = queue(not (cellfun (@(q) all (subset (q, x_bare)(:)), ...
-                                  queue)));
+      [fval_l, fval_u] = evaluate_queue (f, y, queue_l, queue_u, x_shape, ...
+                                         data_dim, vectorize);
+      if (trace)
+        trace = false;
+        if (vectorize)
+          sizes = num2cell (ones (1, d));
+        else
+          sizes = {x_shape};
+        endif
+        fval = infsup ();
+        fval.inf = fval_l;
+        fval.sup = fval_u;
+        verify = @(t) isequal (evaluate_batch (t, queue_l, queue_u), fval);
+        tape = trace_objective (f, sizes, verify);
+      endif
     endif
+    ## Discard boxes outside of the preimage of y, store boxes inside of the
+    ## preimage of y and boxes which are small enough, and bisect the other
+    ## boxes.  Stop after MaxIter or MaxFunEvals.
+    [queue_l, queue_u, stored_l, stored_u, stored_inner, x_l, x_u] = ...
+      __sivia__ (queue_l, queue_u, fval_l, fval_u, y_l, y_u, ...
+                 options.TolX, tolfun, ...
+                 options.MaxIter <= 0 || options.MaxFunEvals <= 0, ...
+                 nargout < 2, x_l, x_u);
+    paving_l{end + 1} = stored_l;
+    paving_u{end + 1} = stored_u;
+    inner{end + 1} = stored_inner;
   endwhile
 
-  x = intervalpart (x);
+  x = infsup ();
+  x.inf = reshape (x_l, x_shape);
+  x.sup = reshape (x_u, x_shape);
   if (nargout >= 2)
-    x_paving = cellfun (@vec, x_paving, "UniformOutput", false);
-    x_paving = horzcat (x_paving{:});
+    x_paving = infsup ();
+    x_paving.inf = horzcat (paving_l{:});
+    x_paving.sup = horzcat (paving_u{:});
+    x_inner_idx = horzcat (inner{:});
+    if (not (vectorize) || data_dim == 2)
+      x_inner_idx = transpose (x_inner_idx);
+    endif
   endif
 
 endfunction
 
-function interval = replace_coordinate (interval, coord, l, u)
-  interval.inf(coord) = l;
-  interval.sup(coord) = u;
-endfunction
-
-## Variant of above algorithm, which utilized vectorized evaluation of f
-function [x, x_paving, x_inner_idx] = vectorized (f, x0, y, options)
-
-  warning ("off", "Octave:broadcast", "local");
-
-  ## Make vectorization dimension cat_dim orthogonal to the dimension
-  ## of the data in y to allow simple function definitions.
-  if (iscolumn (y))
-    x0 = vec (x0);
-    data_dim = 1;
-    cat_dim = 2;
+## Arguments of the vectorized function, each argument contains the values
+## of one coordinate of the boxes in the queue
+function args = queue_arguments (queue_l, queue_u, data_dim)
+  if (data_dim == 1)
+    args = interval_rows (queue_l, queue_u);
   else
-    assert (isrow (y));
-    x0 = transpose (vec (x0));
-    data_dim = 2;
-    cat_dim = 1;
+    args = interval_rows (queue_l, queue_u, "column");
   endif
+endfunction
 
-  x = intervalpart (empty (size (x0)));
-  s = size (x0);
-  s(cat_dim) = 0;
-  x_paving = infsup (zeros (s));
-  x_inner_idx = false (0);
-  queue = x0;
-  x_scalar = isscalar (x0);
-
-  ## Test functions
-  verify_subset = @(fval) all (subset (fval, y), data_dim);
-  verify_disjoint = @(fval) any (disjoint (fval, y), data_dim);
-
-  ## Utility functions for indexing the queue
-  idx.type = '()';
-  idx.subs = {:, :};
+## Arguments of the function, one box per cell
+function boxes = queue_boxes (queue_l, queue_u, x_shape)
+  boxes = cell (1, columns (queue_l));
+  for j = 1 : columns (queue_l)
+    interval = infsup ();
+    interval.inf = reshape (queue_l(:, j), x_shape);
+    interval.sup = reshape (queue_u(:, j), x_shape);
+    boxes{j} = interval;
+  endfor
+endfunction
 
-  while (not (isempty (queue.inf)))
-    ## Evaluate f(x)
-    f_args = cell();
-    idx.subs = {:, :};
-    for i=1:numel(x0)
-      idx.subs{data_dim} = i;
-      f_args{i} = subsref (queue, idx);
-    endfor
-    idx.subs = {:, :};
-    options.MaxFunEvals--;
-    options.MaxIter--;
-    if (options.Contract)
-      fval_and_contractions = nthargout (1 : (1 + length (x0)), ...
-                                         @feval, f, y, f_args{:});
-      fval = fval_and_contractions{1};
-      contractions = cat (data_dim, fval_and_contractions{2 : end});
-      ## Sanitize the contractions returned by the function
-      queue = intersect (queue, contractions);
-      ## Utilize contradictions to discard candidates
-      contradiction = any (isempty (queue), data_dim);
-      idx.subs{cat_dim} = not (contradiction);
-      queue = subsref (queue, idx);
-      if (isempty (queue.inf))
-        break
-      endif
-      fval = subsref (fval, idx);
-    else
-      fval = feval (f, f_args{:});
-    endif
-    ## Check whether x is outside of the preimage of y
-    ## or x is inside the preimage of y
-    is_outside = verify_disjoint (fval);
-    is_inside = verify_subset (fval) & not (is_outside);
-    ## Store the verified subsets of the preimage of y and continue only on
-    ## elements that are not verified
-    idx.subs{cat_dim} = is_inside;
-    queue_inside = subsref (queue, idx);
-    x = union (cat (cat_dim, x, queue_inside), [], cat_dim);
-    x_paving = cat (cat_dim, x_paving, queue_inside);
-    x_inner_idx = cat (cat_dim, x_inner_idx, is_inside(is_inside));
-    idx.subs{cat_dim} = not (is_inside | is_outside);
-    queue = subsref (queue, idx);
-    ## Stop after MaxIter or MaxFunEvals
-    if (options.MaxIter <= 0 || options.MaxFunEvals <= 0)
-      x = union (cat (cat_dim, x, queue), [], cat_dim);
-      x_paving = cat (cat_dim, x_paving, queue);
-      s = size (queue);
-      s(data_dim) = 1;
-      x_inner_idx = cat (cat_dim, x_inner_idx, false (s));
-      break
-    endif
-    ## Stop iteration for small intervals
-    if (not (isempty (options.TolFun)))
-      idx.subs{cat_dim} = not (is_inside | is_outside);
-      fval = subsref (fval, idx);
-      widths = max (wid (fval), [], data_dim);
-      is_small = widths < options.TolFun;
-    else
-      s = size (queue);
-      s(data_dim) = 1;
-      is_small = false (s);
+## Boundaries of intervals, one interval array per column.  Intervals are
+## broadcasted to the size of y if necessary.
+function [l, u] = queue_values (values, y)
+  l = u = cell (1, numel (values));
+  for j = 1 : numel (values)
+    interval = values{j};
+    if (not (isa (interval, "infsup")))
+      interval = infsup (interval);
     endif
-    [widths, bisect_coord] = max (wid (queue), [], data_dim);
-    is_small = is_small | (widths < options.TolX);
-    idx.subs{cat_dim} = is_small;
-    queue_is_small = subsref (queue, idx);
-    x = union (cat (cat_dim, x, queue_is_small), [], cat_dim);
-    x_paving = cat (cat_dim, x_paving, queue_is_small);
-    x_inner_idx = cat (cat_dim, x_inner_idx, not (is_small(is_small)));
-    idx.subs{cat_dim} = not (is_small);
-    queue = subsref (queue, idx);
-    widths = widths(not (is_small));
-    bisect_coord = bisect_coord(not (is_small));
-    ## Bisect remaining intervals at the largest coordinate.
-    x1 = x2 = queue;
-    if (x_scalar)
-      coord = queue;
-    else
-      coord_idx.type = "()";
-      if (data_dim == 1)
-        coord_idx.subs = {bisect_coord - 1 + ...
-                          (1 : rows (queue.inf) : numel (queue.inf))};
-      else
-        coord_idx.subs = {bisect_coord - 1 + ...
-                          (1 : columns (queue.inf) : numel (queue.inf)).'};
+    l{j} = interval.inf(:);
+    u{j} = interval.sup(:);
+    if (nargin >= 2 && numel (l{j}) ~= numel (y) && numel (l{j}) ~= 1 ...
+        && numel (y) ~= 1)
+      l{j} = (interval.inf + zeros (size (y)))(:);
+      u{j} = (interval.sup + zeros (size (y)))(:);
+      if (numel (l{j}) ~= numel (y))
+        error ("interval:InvalidOperand", ...
+               "fsolve: function value and Y are nonconformant");
       endif
-      coord = subsref (queue, coord_idx);
-    endif
-    m_coord = mid (coord);
-    if (x_scalar)
-      x1.sup = x2.inf = m_coord;
-    else
-      x1.sup = subsasgn (x1.sup, coord_idx, m_coord);
-      x2.inf = subsasgn (x2.inf, coord_idx, m_coord);
     endif
-    queue = cat (cat_dim, x1, x2);
-    if (isempty (queue.inf))
-      break
-    endif
-    ## Short-circuit if no paving must be computed and remaining intervals
-    ## are subsets of the already computed interval enclosure.
-    if (nargout < 2)
-      idx.subs{cat_dim} = not (all (subset (queue, x), data_dim));
-      queue = subsref (queue, idx);
-    endif
-  endwhile
+  endfor
+  l = horzcat (l{:});
+  u = horzcat (u{:});
+endfunction
 
-  if (nargout >= 2 && data_dim != 1)
-    x_paving = transpose (x_paving);
+## Boundaries of the function value of the vectorized function, one
+## function value per column
+function [l, u] = batch_values (fval, data_dim)
+  if (not (isa (fval, "infsup")))
+    fval = infsup (fval);
   endif
+  l = fval.inf;
+  u = fval.sup;
+  if (data_dim == 2)
+    l = transpose (l);
+    u = transpose (u);
+  endif
+endfunction
 
+## Evaluate f for all boxes in the queue, one function value per column
+function [fval_l, fval_u] = evaluate_queue (f, y, queue_l, queue_u, ...
+                                            x_shape, data_dim, vectorize)
+  if (vectorize)
+    fval = feval (f, queue_arguments (queue_l, queue_u, data_dim){:});
+    [fval_l, fval_u] = batch_values (fval, data_dim);
+  else
+    fval = cellfun (f, queue_boxes (queue_l, queue_u, x_shape), ...
+                    "UniformOutput", false);
+    [fval_l, fval_u] = queue_values (fval, y);
+  endif
+endfunction
+
+## Evaluate the contractor f for all boxes in the queue, one function value
+## and one contraction per column
+function [fval_l, fval_u, contraction_l, contraction_u] = ...
+         contract_queue (f, y, queue_l, queue_u, x_shape, data_dim, vectorize)
+  if (vectorize)
+    result = nthargout (1 : (1 + rows (queue_l)), @feval, f, y, ...
+                        queue_arguments (queue_l, queue_u, data_dim){:});
+    fval = result{1};
+    [fval_l, fval_u] = batch_values (fval, data_dim);
+    [contraction_l, contraction_u] = queue_values (result(2 : end));
+    contraction_l = transpose (contraction_l);
+    contraction_u = transpose (contraction_u);
+  else
+    boxes = queue_boxes (queue_l, queue_u, x_shape);
+    [fval, contractions] = cellfun (f, repmat ({y}, size (boxes)), boxes, ...
+                                    "UniformOutput", false);
+    [fval_l, fval_u] = queue_values (fval, y);
+    [contraction_l, contraction_u] = queue_values (contractions);
+  endif
 endfunction
 
 %!test
@@ -546,6 +500,59 @@ endfunction
 %!  sqr = @(x) x .^ 2;
 %!  assert (subset (sqrt (infsup (2)), fsolve (sqr, infsup (0, 3), 2, struct ("Vectorize", false))));
 
+%!function fval = untraceable_circle (x)
+%!  if (isa (x, "intervaltape"))
+%!    error ("not traceable");
+%!  endif
+%!  fval = x(1) .^ 2 + x(2) .^ 2;
+%!endfunction
+%!test
+%!  x0 = infsup ([-3; -3], [3; 3]);
+%!  options = struct ("Vectorize", false);
+%!  [x, paving] = fsolve (@(x) x(1) .^ 2 + x(2) .^ 2, x0, 1, options);
+%!  [x_ref, paving_ref] = fsolve (@untraceable_circle, x0, 1, options);
+%!  assert (subset (x, x_ref));
+%!  assert (columns (paving) <= columns (paving_ref));
+%!  assert (subset (infsup ([-1; -1], [1; 1]), x));
+%!function fval = untraceable_system (x)
+%!  if (isa (x, "intervaltape"))
+%!    error ("not traceable");
+%!  endif
+%!  fval = [x(1) .^ 2 + x(2) .^ 2 - 1; x(1) - x(2)];
+%!endfunction
+%!test
+%!  ## Krawczyk contraction for a square system
+%!  f = @(x) [x(1) .^ 2 + x(2) .^ 2 - 1; x(1) - x(2)];
+%!  x0 = infsup ([0.1; 0.1], [1; 1]);
+%!  options = struct ("Vectorize", false, "TolX", 1e-8);
+%!  [x, paving] = fsolve (f, x0, [0; 0], options);
+%!  [x_ref, paving_ref] = fsolve (@untraceable_system, x0, [0; 0], options);
+%!  assert (subset (sqrt (infsup ([0.5; 0.5])), x));
+%!  assert (subset (x, x_ref));
+%!  assert (max (wid (x)) < 1e-6);
+%!  assert (columns (paving) < columns (paving_ref));
+%!test
+%!  ## Forward-backward contraction of the traced function
+%!  x = fsolve (@(x) sin (x), infsup (1, 10), 1, struct ("TolX", 1e-10));
+%!  assert (subset (x, infsup (1.5707, 7.8540)));
+%!  assert (subset (infsup (1.5708, 7.8539), x));
+%!test
+%!  x0 = infsup ([-3; -3], [3; 3]);
+%!  y = infsup ([1; 0]);
+%!  f = @(x1, x2) [x1 .^ 2 + x2 .^ 2; x1 - x2];
+%!  x = fsolve (f, x0, y, struct ("Vectorize", true));
+%!  assert (subset (sqrt (infsup ([0.5; 0.5])), x));
+
+%!test
+%!  [x, paving, inner] = fsolve (@(x1, x2) hypot (x1, x2), ...
+%!                               infsup ([-3; -3], [3; 3]), infsup (0.5, 2), ...
+%!                               optimset ("TolX", 0.5));
+%!  assert (rows (paving), 2);
+%!  assert (size (inner), [1, columns(paving)]);
+%!  assert (any (inner));
+%!  assert (subset (infsup ([-2; -2], [2; 2]), x));
+%!  assert (all (subset (paving, x)(:)));
+
 %!function [fval, x] = contractor (y, x)
 %!  fval = x .^ 2;
 %!  y = intersect (y, fval);
@@ -47,6 +47,23 @@
 ## @option{Display}, @option{MaxFunEvals}, @option{MaxIter},
 ## @option{OutputFcn}, @option{TolFun}, @option{TolX}.
 ##
+## If @var{X0} is an interval array, the roots are searched in all elements of
+## @var{X0} at once.  All subintervals of an iteration are evaluated with a
+## single call of @var{F} and @var{DF}, which must accept column vectors of
+## intervals, and the newton or bisection steps are computed for all
+## subintervals in compiled code.  The result is a cell array of the size of
+## @var{X0}, which contains the column vectors of root enclosures for each
+## element of @var{X0}.
+##
+## Function handles @var{F} and @var{DF} are traced with
+## @code{intervaltape (@var{F})} and the traced expressions are evaluated in
+## a single compiled pass instead of calling the functions.  The traced
+## expressions are only used if they reproduce the function values on
+## @var{X0} exactly.  If @var{DF} is not given, the derivative of the traced
+## expression is computed by automatic differentiation, see
+## @code{@@intervaltape/jacobian}, and the interval newton method is used
+## nevertheless.
+##
 ## Accuracy: The result is a valid enclosure.
 ##
 ## @example
@@ -101,10 +118,7 @@ function x = fzero (f, x0, df, options)
   ## Check parameters
   if (not (isa (x0, "infsup")))
     error ("interval:InvalidOperand", "fzero: Parameter X0 is no interval")
-  elseif (not (isscalar (x0)))
-    error ("interval:InvalidOperand", ...
-           "fzero: Parameter X0 must be a scalar / F must be univariate")
-  elseif (isempty (x0))
+  elseif (isscalar (x0) && isempty (x0))
     error ("interval:InvalidOperand", ...
            "fzero: Initial interval is empty, nothing to do")
   elseif (not (is_function_handle (f)) && not (ischar (f)))
@@ -126,6 +140,20 @@ function x = fzero (f, x0, df, options)
     x0 = intervalpart (x0);
   endif
 
+  ## Evaluate traced expressions of the functions
+  [f, tape] = traced (f, x0);
+  if (not (isempty (df)))
+    df = traced (df, x0);
+  elseif (isa (tape, "intervaltape"))
+    ## Automatic differentiation of the traced expression
+    df = @(x) reshape (jacobian (tape, x), size (x));
+  endif
+
+  if (not (isscalar (x0)))
+    x = findroots_batch (f, df, x0, options);
+    return
+  endif
+
   [l, u] = findroots (f, df, x0, 0, options);
 
   x = infsup ();
@@ -134,6 +162,15 @@ function x = fzero (f, x0, df, options)
 
 endfunction
 
+## Replace function f with the evaluation of its traced expression
+function [f, tape] = traced (f, x0)
+  fx0 = feval (f, x0);
+  tape = trace_objective (f, {1}, @(t) isequal (evaluate (t, x0), fx0));
+  if (isa (tape, "intervaltape"))
+    f = @(x) evaluate (tape, x);
+  endif
+endfunction
+
 ## This function will perform the recursive newton / bisection steps
 function [l, u] = findroots (f, df, x0, stepcount, options)
 
@@ -219,6 +256,130 @@ function [l, u] = findroots (f, df, x0, stepcount, options)
 
 endfunction
 
+## Search the roots in all elements of x0 at once.  The active subintervals
+## are stored in column vectors of interval boundaries and __fzero__
+## computes the newton or bisection steps for all of them.
+function x = findroots_batch (f, df, x0, options)
+
+  tolx = options.TolX;
+  if (isempty (tolx))
+    tolx = -inf;
+  endif
+  tolfun = options.TolFun;
+  if (isempty (tolfun))
+    tolfun = -inf;
+  endif
+
+  l = x0.inf(:);
+  u = x0.sup(:);
+  owner = transpose (1 : numel (x0));
+  step = zeros (numel (x0), 1);
+  maxiter = options.MaxIter * ones (numel (x0), 1);
+  ## Empty elements have no roots
+  active = l <= u;
+  [l, u, owner, step, maxiter] = deal (l(active), u(active), ...
+                                       owner(active), step(active), ...
+                                       maxiter(active));
+  roots_l = roots_u = roots_owner = {zeros(0, 1)};
+
+  while (not (isempty (l)))
+    if (isempty (df))
+      [cl, cu, parent] = __fzero__ (l, u);
+    else
+      x = infsup ();
+      x.inf = l;
+      x.sup = u;
+      m = mid (x);
+      fm = feval (f, infsup (m));
+      dfx = feval (df, x);
+      if (not (isa (fm, "infsup")))
+        fm = infsup (fm);
+      endif
+      if (not (isa (dfx, "infsup")))
+        dfx = infsup (dfx);
+      endif
+      [cl, cu, parent] = __fzero__ (l, u, m, fm.inf(:), fm.sup(:), ...
+                                    dfx.inf(:), dfx.sup(:));
+    endif
+
+    c = infsup ();
+    c.inf = cl;
+    c.sup = cu;
+    if (strcmp (options.Display, "iter"))
+      display (c);
+    endif
+
+    f_c = feval (f, c);
+    if (not (isa (f_c, "infsup")))
+      f_c = infsup (f_c);
+    endif
+    f_l = f_c.inf(:);
+    f_u = f_c.sup(:);
+    ## The interval evaluation of f over c proves that there are no roots
+    possible = f_l <= 0 & 0 <= f_u;
+
+    w = wid (c);
+    w_f = wid (f_c)(:);
+    ## Slow convergence detected, cancel iteration soon
+    slow = (f_l == -inf & f_u == inf) ...
+           | w_f ./ max (realmin (), w) < pow2 (-20);
+    maxiter = maxiter(parent) ./ (1 + slow / 2);
+    step = step(parent);
+
+    ## Stop if the result is accurate enough or if there is no improvement
+    done = (cl == l(parent) & cu == u(parent)) | step >= maxiter ...
+           | w <= tolx | w_f <= tolfun;
+    store = possible & done;
+    roots_l{end + 1} = cl(store);
+    roots_u{end + 1} = cu(store);
+    roots_owner{end + 1} = owner(parent(store));
+
+    active = possible & not (done);
+    l = cl(active);
+    u = cu(active);
+    owner = owner(parent(active));
+    step = step(active) + 1;
+    maxiter = maxiter(active);
+  endwhile
+
+  x = cell (size (x0));
+  for k = 1 : numel (x0)
+    result = infsup ();
+    result.inf = result.sup = zeros (0, 1);
+    x{k} = result;
+  endfor
+  roots = sortrows ([vertcat(roots_owner{:}), vertcat(roots_l{:}), ...
+                     vertcat(roots_u{:})]);
+  if (isempty (roots))
+    return
+  endif
+
+  ## Sort the roots of each element in ascending order and merge
+  ## intersecting intervals
+  first = [true; (roots(2 : end, 1) ~= roots(1 : end - 1, 1) ...
+                  | roots(2 : end, 2) ~= roots(1 : end - 1, 3))];
+  roots_u = accumarray (cumsum (first), roots(:, 3), [], @max);
+  roots = [roots(first, 1 : 2), roots_u];
+
+  ## One column vector of root enclosures per element
+  first = find ([true; roots(2 : end, 1) ~= roots(1 : end - 1, 1)]);
+  last = [first(2 : end) - 1; rows(roots)];
+  for k = 1 : numel (first)
+    result = infsup ();
+    result.inf = roots(first(k) : last(k), 2);
+    result.sup = roots(first(k) : last(k), 3);
+    x{roots(first(k), 1)} = result;
+  endfor
+
+endfunction
+
+%!test
+%! f = @(x) x .^ 2 - 2;
+%! df = @(x) 2 * x;
+%! x = fzero (f, infsup (0, 3), df);
+%! assert (isscalar (x));
+%! assert (subset (sqrt (infsup (2)), x));
+%! assert (rad (x) < 8 * eps);
 %!test "from the documentation string";
 %! f = @(x) cos (x);
 %! df = @(x) -sin (x);
@@ -229,3 +390,37 @@ endfunction
 %! zeros = fzero (sqr, infsup ("[Entire]"));
 %! assert (all (subset (0, zeros)));
 %! assert (max (rad (zeros)) < eps);
+%!test
+%! ## Interval newton method with automatic differentiation
+%! f = @(x) exp (x) - 2;
+%! x = fzero (f, infsup (0, 3));
+%! assert (isscalar (x));
+%! assert (subset (log (infsup (2)), x));
+%! assert (rad (x) < 8 * eps);
+%!test
+%! ## Batch of start intervals
+%! f = @(x) x .^ 2 - 2;
+%! df = @(x) 2 * x;
+%! x = fzero (f, infsup ([0; -3; 2; -3], [3; 0; 5; 3]), df);
+%! assert (iscell (x));
+%! assert (size (x), [4, 1]);
+%! assert (numel (x{1}), 1);
+%! assert (subset (sqrt (infsup (2)), x{1}));
+%! assert (rad (x{1}) < 8 * eps);
+%! assert (subset (-sqrt (infsup (2)), x{2}));
+%! assert (numel (x{3}), 0);
+%! assert (numel (x{4}), 2);
+%! assert (all (subset ([-1; 1] .* sqrt (infsup (2)), x{4})));
+%!test
+%! ## Batch with automatic differentiation
+%! x = fzero (@(x) exp (x) - 2, infsup ([0, 1], [3, 3]));
+%! assert (size (x), [1, 2]);
+%! assert (subset (log (infsup (2)), x{1}));
+%! assert (rad (x{1}) < 8 * eps);
+%! assert (numel (x{2}), 0);
+%!test
+%! ## Batch with several roots per element
+%! x = fzero (@(x) cos (x), infsup ([-2, 2], [2, 5]), optimset ("TolX", 1e-6));
+%! assert (all (subset ([-1; 1] .* infsup ("pi") ./ 2, x{1})));
+%! assert (all (subset (3 .* infsup ("pi") ./ 2, x{2})));
+%! assert (max (wid (vertcat (x{:}))) <= 1e-6);
@@ -95,9 +95,34 @@
 
 function [x, isexact, overflow, isnai] = infsup (l, u)
 
-  persistent scalar_empty_interval = class (struct ("inf", inf, ...
-                                                    "sup", -inf), ...
-                                            "infsup");
+  ## Interval arrays are stored natively, see __infsup__.  The boundaries
+  ## remain accessible as x.inf and x.sup for the methods of the class.
+  persistent scalar_empty_interval = __infsup__ (inf, -inf);
+
+  ## Fast path: Binary64 boundaries of equal size, which form legal intervals,
+  ## need no parsing, rounding, broadcasting, or warnings.  This is the most
+  ## common case in internal functions and user code.
+  if (nargin >= 1 && isa (l, "double") && isreal (l) && not (issparse (l)))
+    if (nargin == 1)
+      fast_path = all (isfinite (l(:)));
+    else
+      fast_path = isa (u, "double") && isreal (u) && not (issparse (u)) ...
+                  && size_equal (l, u) ...
+                  && all ((l <= u & l < inf & u > -inf)(:));
+    endif
+    if (fast_path)
+      if (nargin == 1)
+        u = l;
+      endif
+      ## normalize boundaries, see below
+      l(l == 0) = -0;
+      u(u == 0) = +0;
+      x = __infsup__ (l, u);
+      isexact = true ();
+      isnai = overflow = false (size (l));
+      return
+    endif
+  endif
 
   warning ("off", "Octave:broadcast", "local");
 
@@ -860,7 +885,7 @@ function [x, isexact, overflow, isnai] = infsup (l, u)
     endif
   endif
 
-  x = class (x, "infsup");
+  x = __infsup__ (x.inf, x.sup);
 endfunction
 
 %!# Empty intervals
@@ -943,6 +968,15 @@ endfunction
 %! assert (inf (x), 2);
 %! assert (sup (x), 3);
 %!test
+%! [x, isexact, overflow, isnai] = infsup ([-0, 1; 2, -inf], [0, 1; 3, 4]);
+%! assert (inf (x), [0, 1; 2, -inf]);
+%! assert (sup (x), [0, 1; 3, 4]);
+%! assert (signbit (inf (x)), [true, false; false, true]);
+%! assert (signbit (sup (x)), false (2));
+%! assert (isexact);
+%! assert (overflow, false (2));
+%! assert (isnai, false (2));
+%!test
 %! x = infsup (-inf, 0.1);
 %! assert (inf (x), -inf);
 %! assert (sup (x), 0.1);
@@ -56,8 +56,8 @@ function a = intersect (a, b, dim)
       if (not (isa (b, "infsup")))
         b = infsup (b);
       endif
-      l = max (a.inf, b.inf);
-      u = min (a.sup, b.sup);
+      [l, u] = __set_operation__ ("intersect", a.inf, a.sup, [], ...
+                                  b.inf, b.sup, []);
     case 3
       if (not (builtin ("isempty", b)))
         warning ("intersect: second argument is ignored");
@@ -162,3 +162,4 @@ endfunction
 %! in2 = reshape ([in2; in2(1:i)], testsize);
 %! out = reshape ([out; out(1:i)], testsize);
 %! assert (isequaln (intersect (in1, in2), out));
+%!error <intersect: nonconformant arguments> intersect (infsup (1 : 2), infsup (1 : 3))
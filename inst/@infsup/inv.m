@@ -55,7 +55,34 @@ function result = inv (x)
     return
   endif
 
-  result = mldivide (x, eye (n));
+  if (isa (x, "infsupdec") || not (issquare (x.inf)) ...
+      || any (any (isempty (x))))
+    result = mldivide (x, eye (n));
+    return
+  endif
+
+  ## Approximate inversion (non-interval computation) and one step of
+  ## residual correction for all columns at once
+  Am = mid (x);
+  [R, cond] = inv (Am);
+  if (cond == 0 || not (all (isfinite (R(:)))))
+    result = mldivide (x, eye (n));
+    return
+  endif
+  X1 = R + R * (eye (n) - Am * R);
+
+  ## Verification of all columns with the Krawczyk operator
+  [l, u, verified] = __inv__ (x.inf, x.sup, R, X1);
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
+
+  if (not (all (verified)))
+    ## Verification with an approximate inverse of double length
+    I = eye (n);
+    idx = substruct ("()", {":", not(verified)});
+    result = subsasgn (result, idx, mldivide (x, I(:, not (verified))));
+  endif
 
 endfunction
 
@@ -69,3 +96,12 @@ endfunction
 %!# from the documentation string
 %!assert (inv (infsup ([2, 1, 1; 0, 1, 0; 1, 0, 0])) == [0, 0, 1; 0, 1, 0; 1, -1, -2]);
 %!assert (inv (infsup ([1, 2, 3; 4, 0, 6; 0, 0, 1])) == [0, .25, -1.5; .5, -.125, -.75; 0, 0, 1]);
+%!test
+%! A = infsup (magic (4) + eye (4));
+%! assert (all (all (subset (inv (A), mldivide (A, eye (4))))));
+%! assert (all (all (subset (inv (magic (4) + eye (4)), inv (A)))));
+%!test
+%! A = infsup ([2, -1; -1, 2] - 0.1, [2, -1; -1, 2] + 0.1);
+%! B = inv (A);
+%! assert (all (all (subset (inv ([2, -1; -1, 2]), B))));
+%! assert (all (all (wid (B) <= wid (mldivide (A, eye (2))))));
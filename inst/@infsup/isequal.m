@@ -0,0 +1,72 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@infsup} isequal (@var{A}, @var{B}, @dots{})
+##
+## Return true if all interval arrays are of the same class and size, and
+## have identical boundaries (and decorations).
+##
+## Since interval arrays are stored natively, the built-in function cannot
+## compare them like structures.
+##
+## @example
+## @group
+## isequal (infsup (1, 2), infsup (1, 2))
+##   @result{} ans = 1
+## isequal (infsup (1, 2), infsupdec (1, 2))
+##   @result{} ans = 0
+## @end group
+## @end example
+## @seealso{@@infsup/eq}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = isequal (x, varargin)
+
+  if (nargin < 2)
+    print_usage ();
+    return
+  endif
+
+  result = false ();
+  for i = 1 : numel (varargin)
+    y = varargin{i};
+    if (not (strcmp (class (x), class (y))) ...
+        || not (isequal (inf (x), inf (y))) ...
+        || not (isequal (sup (x), sup (y))))
+      return
+    endif
+    if (isa (x, "infsupdec") ...
+        && not (isequal (decorationpart (x), decorationpart (y))))
+      return
+    endif
+  endfor
+  result = true ();
+
+endfunction
+
+%!assert (isequal (infsup (1, 2), infsup (1, 2)));
+%!assert (isequal (infsup ([1, 2]), infsup ([1, 2]), infsup ([1, 2])));
+%!assert (not (isequal (infsup (1, 2), infsup (1, 3))));
+%!assert (not (isequal (infsup ([1, 2]), infsup ([1; 2]))));
+%!assert (not (isequal (infsup (1), 1)));
+%!assert (not (isequal (infsup (1, 2), infsupdec (1, 2))));
+%!assert (isequal (infsupdec (1, 2), infsupdec (1, 2)));
+%!assert (not (isequal (infsupdec (1, 2), infsupdec (1, 2, "trv"))));
@@ -29,7 +29,8 @@
 ## converted to column vectors and the result is a matrix where the
 ## rows are the independent sequences.
 ##
-## Accuracy: The result is an accurate enclosure.
+## Accuracy: The result is a tight enclosure.  Members, which are binary64
+## numbers, are computed exactly.
 ##
 ## @example
 ## @group
@@ -69,20 +70,12 @@ function base = linspace (base, limit, n)
     error ("linspace: BASE and LIMIT must be scalars or vectors");
   endif
 
-  ## Convert base and limit to column vectors. In fact mpfr_linspace_d
-  ## treats all arrays as row vectors but it is safer to not depend on
-  ## this.
+  ## Convert base and limit to column vectors
   base = reshape (base, [], 1);
   limit = reshape (limit, [], 1);
 
-  l = mpfr_linspace_d (-inf, base.inf, limit.inf, n);
-  u = mpfr_linspace_d (+inf, base.sup, limit.sup, n);
-
-  empty = vec (isempty (base) | isempty (limit));
-  l(empty, :) = inf;
-  u(empty, :) = -inf;
-
-  l(l == 0) = -0;
+  [l, u] = __subdivide__ ("linspace", ...
+                          base.inf, base.sup, limit.inf, limit.sup, n);
 
   base.inf = l;
   base.sup = u;
@@ -91,6 +84,13 @@ endfunction
 
 %!assert (isequal (linspace (infsup (0), infsup (10), 9), infsup (linspace (0, 10, 9))));
 
+%!test
+%! x = linspace (infsup (0), infsup (1), 4);
+%! assert (inf (x), [0, 1/3, 2/3, 1]);
+%! assert (sup (x), [0, 1/3 + pow2 (-54), 2/3 + pow2 (-53), 1]);
+
+%!assert (isempty (linspace (infsup (0), infsup (), 3)), true (1, 3));
+
 %!# correct use of signed zeros
 %!test
 %! x = linspace (infsup (0), infsup (0));
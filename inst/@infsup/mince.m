@@ -29,7 +29,8 @@
 ## result is a matrix where the rows are independent sequences.  The
 ## default value for @var{N} is 100.
 ##
-## Accuracy: The result is an accurate enclosure.
+## Accuracy: The boundaries of the sub-intervals are tight enclosures of the
+## equally spaced points in @var{X}.
 ##
 ## @example
 ## @group
@@ -66,21 +67,7 @@ function x = mince (x, n)
   ## Convert x to a column vector
   x = reshape (x, [], 1);
 
-  base = limit = x;
-  idx.type = '()';
-  idx.subs = {isfinite(x.inf)};
-  base = subsasgn (base, idx, infsup (subsref (x.inf, idx)));
-  idx.subs = {isfinite(x.sup)};
-  limit = subsasgn (limit, idx, infsup (subsref (x.sup, idx)));
-
-  boundaries = linspace (base, limit, n + 1);
-
-  l = boundaries.inf(:, 1 : end - 1);
-  u = boundaries.sup(:, 2 : end);
-
-  empty = vec (isempty (x));
-  l(empty, :) = inf;
-  u(empty, :) = -inf;
+  [l, u] = __subdivide__ ("mince", x.inf, x.sup, n);
 
   x.inf = l;
   x.sup = u;
@@ -89,4 +76,11 @@ endfunction
 
 %!assert (isequal (mince (infsup (0, 10), 10), infsup (0 : 9, 1 : 10)));
 
+%!test
+%! x = mince (infsup (0, 1), 3);
+%! assert (inf (x), [0, 1/3, 2/3]);
+%! assert (sup (x), [1/3 + pow2 (-54), 2/3 + pow2 (-53), 1]);
+
+%!assert (isequal (mince (infsup ([1; -inf], [inf; 0]), 2), infsup ([1, 1; -inf, -inf], [inf, inf; 0, 0])));
+
 %!assert (size (mince (infsup (zeros (1, 0), ones (1, 0)), 2)), [0 2]);
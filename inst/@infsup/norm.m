@@ -29,6 +29,11 @@
 ## Infinity norm, the largest row sum of the absolute values of @var{A}.
 ## @item @var{P} = "fro"
 ## Frobenius norm of @var{A}, @code{sqrt (sum (diag (@var{A}' * @var{A})))}.
+## @item @var{P} = 2
+## Spectral norm of @var{A}, the largest singular value.  The lower bound is
+## the largest euclidean norm of the rows and columns of @var{A}, the upper
+## bound is the smaller one of the Frobenius norm and
+## @code{sqrt (norm (@var{A}, 1) * norm (@var{A}, inf))}.
 ## @end table
 ##
 ## If @var{A} is a vector or a scalar:
@@ -59,7 +64,11 @@
 ## "columns" or "cols" then compute the norms of each column and return a row
 ## vector.
 ##
-## Accuracy: The result is a valid enclosure.
+## The matrix norms and the max norm are computed by a compiled function,
+## where all sums are exact and rounded only once.
+##
+## Accuracy: The result is a valid enclosure.  The result is tight for the
+## 1-norm, the infinity norm, and the max norm.
 ##
 ## @example
 ## @group
@@ -123,7 +132,7 @@ function result = norm (A, p, opt)
       endif
       if (p == 1 && q == inf)
         ## Max norm
-        result = max (max (abs (A)));
+        result = matrix_norm (A, "max");
         return
       elseif (p == 1 && q == 1)
         ## 1-norm, computed below
@@ -174,12 +183,8 @@ function result = norm (A, p, opt)
   if (isempty (dim))
     ## Matrix norm
     switch (p)
-      case 1
-        result = max (sum (abs (A), 1));
-      case inf
-        result = max (sum (abs (A), 2));
-      case "fro"
-        result = sqrt (sumsq (vec (A)));
+      case {1, inf, "fro", 2}
+        result = matrix_norm (A, p);
       otherwise
         error ("norm: Particular matrix norm is not yet supported")
     endswitch
@@ -211,8 +216,50 @@ function result = norm (A, p, opt)
 
 endfunction
 
+function result = matrix_norm (A, p)
+
+  [l, u] = __norm__ (A.inf, A.sup, p);
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
+
+  if (isa (A, "infsupdec"))
+    ## Matrix norms are continuous functions, which are defined everywhere
+    dec = decorationpart (A, "uint8");
+    if (isempty (dec))
+      result = newdec (result);
+    else
+      result = infsupdec (result, __decorate__ (result, min (dec(:))));
+    endif
+  endif
+
+endfunction
+
 %!test
 %! A = infsup ("0 [Empty] [0, 1] 1");
 %! assert (isequal (norm (A, 0, "cols"), infsup ("0 [Empty] [0, 1] 1")));
 %!assert (norm (infsup (magic (3)), inf, 1) == 45);
 %!assert (norm (infsup (-magic (3), magic (3)), inf, 1) == "[0, 45]");
+%!assert (norm (infsup (magic (3)), 1) == 15);
+%!assert (norm (infsup (-magic (3), magic (3)), inf) == "[0, 15]");
+%!assert (norm (infsup ([1, -5; 3, 4], [2, 5; 3, 4]), 1, inf) == "[4, 5]");
+%!test
+%! x = norm (infsup (magic (3)), "fro");
+%! assert (subset (sqrt (infsup (285)), x));
+%! assert (sup (x) - inf (x) <= 4 * eps (sqrt (285)));
+%!test
+%! A = magic (4);
+%! assert (ismember (norm (A), norm (infsup (A))));
+%! assert (ismember (norm (A), norm (infsup (A), 2)));
+%!test
+%! x = norm (infsup (magic (4)));
+%! assert (isfinite (inf (x)) && inf (x) <= 34);
+%! assert (sup (x) >= 34);
+%!test
+%! A = infsup (magic (3));
+%! A(2) = empty ();
+%! assert (isempty (norm (A, 1)));
+%!test
+%! x = norm (infsupdec (magic (3), "def"), inf);
+%! assert (x == 15);
+%! assert (decorationpart (x), {"def"});
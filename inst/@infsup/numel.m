@@ -36,6 +36,11 @@ function result = numel (a, varargin)
     error ("invalid use of interval as indexing parameter to numel ()")
   endif
 
+  if (isempty (varargin))
+    result = numel (a.inf);
+    return
+  endif
+
   # We cannot use numel (a.inf, varargin{:}) here,
   # because varargin may contain a magical colon (see bug 53375),
   # which would produce an error:
@@ -0,0 +1,128 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@infsup} polyrange (@var{P}, @var{X})
+## @defmethodx {@@infsup} polyrange (@var{P}, @var{X}, @var{TOL})
+## @defmethodx {@@infsup} polyrange (@var{P}, @var{X}, @var{TOL}, @var{MAXBOXES})
+##
+## Compute an enclosure of the range of polynomial @var{P} over the interval
+## box @var{X}.
+##
+## If @var{X} is a scalar, @var{P} is a vector of coefficients in the order
+## of @code{polyval}, that is, with descending powers.  Otherwise, @var{P} is
+## an array with one dimension for each of the d = @code{numel (@var{X})}
+## variables, and element @code{@var{P}(i1, @dots{}, id)} is the coefficient
+## of x1^(n1 - i1) @dots{} xd^(nd - id), where nk = @code{size (@var{P}, k)}.
+## The coefficients may be intervals.
+##
+## The polynomial is converted into Bernstein form on the box @var{X} with
+## exact dot products, and the range is enclosed by the smallest and largest
+## Bernstein coefficient.  This enclosure is sharp if these coefficients
+## belong to the vertices of the box.  Otherwise, the box is split in halves
+## along its widest dimension with the de Casteljau algorithm, until the
+## bounds are sharp or cannot improve by more than @var{TOL} (default:
+## @code{1e-12}) relative to the largest known value of the polynomial.  At
+## most @var{MAXBOXES} (default: 1000) subboxes are used.
+##
+## The range over an unbounded box is entire, unless the polynomial is
+## constant in the unbounded variables.
+##
+## Accuracy: The result is a valid enclosure.
+##
+## @example
+## @group
+## polyrange (infsup ([1, -2, 0]), infsup (0, 2)) # x^2 - 2x | x = 0 .. 2
+##   @result{} ans = [-1, 0]
+## polyval (infsup ([1, -2, 0]), infsup (0, 2))
+##   @result{} ans = [-4, 0]
+## @end group
+## @end example
+## @seealso{@@infsup/polyval}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = polyrange (p, x, tol, maxboxes)
+
+  if (nargin < 2 || nargin > 4)
+    print_usage ();
+    return
+  endif
+
+  if (not (isa (x, "infsup")))
+    x = infsup (x);
+  endif
+  if (not (isa (p, "infsup")))
+    p = infsup (p);
+  endif
+  if (nargin < 3)
+    tol = 1e-12;
+  endif
+  if (nargin < 4)
+    maxboxes = 1000;
+  endif
+
+  l = p.inf;
+  u = p.sup;
+  if (isscalar (x.inf))
+    if (not (isvector (l)))
+      error ("interval:InvalidOperand", ...
+             "polyrange: polynomial P must be a vector of coefficients");
+    endif
+    l = l(:);
+    u = u(:);
+  elseif (ndims (l) > numel (x.inf))
+    error ("interval:InvalidOperand", ...
+           "polyrange: P must have one dimension for each variable");
+  endif
+
+  ## Ascending powers
+  for k = 1 : ndims (l)
+    l = flip (l, k);
+    u = flip (u, k);
+  endfor
+
+  [l, u] = __bernstein__ (l, u, x.inf, x.sup, tol, maxboxes);
+
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
+
+endfunction
+
+%!# from the documentation string
+%!assert (polyrange (infsup ([1, -2, 0]), infsup (0, 2)) == infsup (-1, 0));
+
+%!test
+%! ## x y - x - y on [0, 2] × [0, 2]
+%! y = polyrange (infsup ([1, -1; -1, 0]), infsup ([0; 0], [2; 2]));
+%! assert (y == infsup (-2, 0));
+%!test
+%! ## Wilkinson-like polynomial with roots 1, 2, 3, 4
+%! p = poly (1 : 4);
+%! y = polyrange (infsup (p), infsup (0, 5));
+%! t = linspace (0, 5, 1001);
+%! assert (inf (y) <= min (polyval (p, t)));
+%! assert (max (polyval (p, t)) <= sup (y));
+%! assert (subset (y, polyval (infsup (p), infsup (0, 5))));
+%! assert (sup (y) - inf (y) < 26);
+%!assert (polyrange (infsup ([-1, 1], [1, 1]), infsup (0, 1)) == infsup (0, 2));
+%!assert (isempty (polyrange (infsup ([1, 2]), empty ())));
+%!assert (isentire (polyrange (infsup ([1, 2]), infsup (0, inf))));
+%!error polyrange (infsup (magic (3)), infsup (1))
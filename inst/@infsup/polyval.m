@@ -25,11 +25,21 @@
 ## -*- texinfo -*-
 ## @documentencoding UTF-8
 ## @defmethod {@@infsup} polyval (@var{P}, @var{X})
+## @defmethodx {@@infsup} polyval (@var{P}, @var{X}, "centered")
 ##
 ## Evaluate polynomial @var{P} with argument @var{X}.
 ##
-## Horner's scheme is used to evaluate a first approximation.  The result is
-## improved with iterative refinement.
+## @var{X} may be an interval array, whose elements are evaluated
+## independently (in parallel if the package has been compiled with OpenMP).
+## Horner's scheme is used to evaluate a first approximation, where each step
+## is computed with an exact dot product and rounded only once.  For
+## singleton intervals @var{X}, the result is improved with iterative
+## refinement.
+##
+## With option @code{"centered"}, the result for non-singleton intervals
+## @var{X} is intersected with the centered form
+## @code{p (c) + p' (@var{X}) * (@var{X} - c)}, where c is the midpoint of
+## @var{X}.  This reduces the overestimation for narrow intervals.
 ##
 ## Accuracy: The result is a tight enclosure for polynomials of degree 1 or
 ## less.  For polynomials of higher degree the result is a valid enclosure.
@@ -52,9 +62,18 @@
 ## Keywords: interval
 ## Created: 2015-05-29
 
-function result = polyval (p, x)
+function result = polyval (p, x, form)
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+    return
+  endif
 
-  if (nargin ~= 2)
+  if (nargin < 3)
+    centered = false;
+  elseif (strcmp (form, "centered"))
+    centered = true;
+  else
     print_usage ();
     return
   endif
@@ -66,100 +85,15 @@ function result = polyval (p, x)
     p = infsup (p);
   endif
 
-  if (not (isscalar (x)))
-    error ('point of evaluation X must be a scalar')
-  endif
-
   if (not (isvector (p)))
     error ('polynomial P must be a vector of coefficients')
   endif
 
-  if (isempty (x))
-    result = x;
-  endif;
-
-  n = numel (p);
-  switch (n)
-    case 0 # empty sum
-      result = infsup (0);
-      return
-    case 1 # p .* x.^0
-      result = p;
-      return
-    case 2 # p(1) .* x.^1 + p(2) .* x.^0
-      result = fma (x, subsref (p, substruct ("()", {1})), ...
-                    subsref (p, substruct ("()", {2})));
-      return
-  endswitch
-
-  if (x == 0)
-    result = subsref (p, substruct ("()", {n}));
-    return
-  elseif (x == 1)
-    result = sum (p);
-    return
-  elseif (x == -1)
-    result = dot (p, (-1) .^ ((n : -1 : 1) - 1));
-    return
-  endif
-
-  kMax = 20;
-
-  idxNext.type = '()';
-  idxLast.type = '()';
-
-  ## Compute first approximation using Horner's scheme
-  yy = infsup (zeros (n, 1));
-  idxNext.subs = {1};
-  result = subsref (p, idxNext);
-  yy = subsasgn (yy, idxNext, result);
-  for i = 2 : n
-    idxNext.subs = {i};
-    result = fma (result, x, subsref (p, idxNext));
-    yy = subsasgn (yy, idxNext, result);
-  endfor
-
-  y = zeros (n, kMax);
-  for k = 1 : kMax
-    lastresult = result;
+  [l, u] = __polyval__ (p.inf, p.sup, x.inf, x.sup, centered);
 
-    if (isempty (result))
-      break
-    endif
-
-    ## Iterative refinement
-    ## Store middle of residual as the next correction of y
-    y(:, k) = mid (yy);
-
-    ## Computation of the residual [r] and
-    ## evaluation of the interval system A*[y] = [r]
-    yy = infsup (zeros (n, 1));
-    for i = 2 : n
-      idxNext.subs = {i};
-      idxLast.subs = {i-1};
-
-      coef = subsref (p, idxNext);
-      yy = subsasgn (yy, idxNext, dot ([subsref(yy, idxLast), ...
-                                        coef, y(i, 1 : k), ...
-                                        y(i - 1, 1 : k)], ...
-                                       [x, ...
-                                        1, ...
-                                        -ones(1, k), x.*ones(1, k)]));
-    endfor
-
-    ## Determination of a new enclosure of p (x)
-    idxLast.subs = {n};
-    result = intersect (result, sum ([subsref(yy, idxLast), y(n, 1 : k)]));
-    if (eq (result, lastresult))
-      ## No improvement
-      break
-    endif
-    if (mpfr_function_d ('plus', +inf, inf (result), pow2 (-1074)) >= ...
-        sup (result))
-      ## 1 ULP accuracy reached
-      break
-    endif
-  endfor
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
 
 endfunction
 
@@ -169,3 +103,19 @@ endfunction
 %!assert (polyval (infsup ([42 42]), -1) == 0);
 %!assert (polyval (infsup ([-42 42 42]), .5) == -42*0.5^2 + 42*0.5 + 42);
 %!assert (polyval (infsup (vec (pascal (3))), 0.1) == "[0X6.502E9A7231A08P+0, 0X6.502E9A7231A0CP+0]");
+
+%!# vectorized evaluation
+%!test
+%! x = infsup ([0, 0.5, 1; -1, 42, 41.5], [0, 0.5, 1; -1, 42, 42.5]);
+%! y = polyval (infsup ([3 4 2 1]), x);
+%! assert (size (y), [2, 3]);
+%! assert (y == infsup ([1, 3.375, 10; 0, 229405, 221393.125], [1, 3.375, 10; 0, 229405, 237607.875]));
+%!test
+%! x = infsup (0.9, 1.1);
+%! y1 = polyval (infsup ([1, -2, 1]), x);
+%! y2 = polyval (infsup ([1, -2, 1]), x, "centered");
+%! assert (subset (y2, y1));
+%! assert (subset (infsup (0, 0.01), y2));
+%! assert (sup (y2) - inf (y2) < 0.05);
+%!assert (isempty (polyval (infsup ([1, 2, 3]), empty ())));
+%!error polyval (infsup ([1, 2, 3]), 1, "tight")
@@ -0,0 +1,46 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {[@var{L}, @var{U}] =} contract_batch (@var{T}, @var{L}, @var{U}, @var{YL}, @var{YU})
+##
+## Contract a batch of B boxes to the solutions of
+## @code{@var{T} (@var{x}) ∈ [@var{YL}, @var{YU}]} with the forward-backward
+## contractor of @code{@@intervaltape/contract}.  The N×B matrices
+## [@var{L}, @var{U}] contain one box per column, boxes without solutions
+## become empty.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [l, u] = contract_batch (T, l, u, y_l, y_u)
+
+  n = rows (l);
+  args = interval_rows (l, u);
+  y = infsup ();
+  y.inf = y_l;
+  y.sup = y_u;
+
+  [~, args{:}] = contract (T, y, args{:});
+  for k = 1 : n
+    l(k, :) = args{k}.inf;
+    u(k, :) = args{k}.sup;
+  endfor
+
+endfunction
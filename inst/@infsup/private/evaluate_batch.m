@@ -0,0 +1,36 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{FVAL} =} evaluate_batch (@var{T}, @var{L}, @var{U})
+##
+## Evaluate the traced function @var{T} for a batch of B arguments in a
+## single pass.  Column j of the N×B matrices @var{L} and @var{U} contains
+## the boundaries of the N variables of the j-th argument.  Column j of the
+## R×B interval matrix @var{FVAL} contains the R elements of the
+## corresponding function value.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function fval = evaluate_batch (T, l, u)
+
+  args = interval_rows (l, u);
+  fval = reshape (evaluate (T, args{:}), numel (T), columns (l));
+
+endfunction
@@ -0,0 +1,46 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun  {@var{ARGS} =} interval_rows (@var{L}, @var{U})
+## @deftypefunx {@var{ARGS} =} interval_rows (@var{L}, @var{U}, "column")
+##
+## Create one interval vector for each row of the boundary matrices @var{L}
+## and @var{U}.  Cell k of @var{ARGS} contains the intervals of row k, which
+## is a row vector or, with the option @code{"column"}, a column vector.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function args = interval_rows (l, u, shape)
+
+  if (nargin == 3 && strcmp (shape, "column"))
+    l = transpose (l);
+    u = transpose (u);
+    args = cell (1, columns (l));
+    for k = 1 : columns (l)
+      args{k} = __infsup__ (l(:, k), u(:, k));
+    endfor
+  else
+    args = cell (1, rows (l));
+    for k = 1 : rows (l)
+      args{k} = __infsup__ (l(k, :), u(k, :));
+    endfor
+  endif
+
+endfunction
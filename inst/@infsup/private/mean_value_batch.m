@@ -0,0 +1,99 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {[@var{FL}, @var{FU}, @var{L}, @var{U}] =} mean_value_batch (@var{T}, @var{L}, @var{U}, @var{YL}, @var{YU})
+##
+## Evaluate the traced function @var{T} for a batch of B boxes like
+## @code{evaluate_batch} and improve the function values with the mean value
+## form.  The function values and the Jacobian matrices over the boxes are
+## computed in a single pass, see @code{@@intervaltape/jacobian}.
+##
+## If the function and [@var{YL}, @var{YU}] have as many elements R as
+## variables N, the boxes
+## [@var{L}, @var{U}] are contracted with the Krawczyk operator for
+## @code{@var{T} (@var{x}) ∈ [@var{YL}, @var{YU}]}, which is an interval
+## Newton method for systems of equations.  Boxes without solutions become
+## empty and have empty function values.  Boxes, where the function is not
+## differentiable, are neither improved nor contracted.
+##
+## The R×B matrices [@var{FL}, @var{FU}] contain the function values.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [fval_l, fval_u, l, u] = mean_value_batch (T, l, u, y_l, y_u)
+
+  [n, b] = size (l);
+  r = numel (T);
+
+  args = interval_rows (l, u);
+  [J, fval] = jacobian (T, args{:});
+  J = reshape (J, r, n, b);
+  fval = reshape (fval, r, b);
+  fval_l = fval.inf;
+  fval_u = fval.sup;
+
+  x = infsup ();
+  x.inf = l;
+  x.sup = u;
+  m = mid (x);
+  fm = evaluate_batch (T, m, m);
+
+  ## Bounded derivatives imply that the function is defined and Lipschitz
+  ## continuous on the box
+  valid = all (isfinite ([reshape(J.inf, r * n, b); ...
+                          reshape(J.sup, r * n, b); ...
+                          fm.inf; ...
+                          fm.sup]), 1);
+  if (not (any (valid)))
+    return
+  endif
+
+  if (r == n && numel (y_l) == r)
+    ## Krawczyk contraction with F = f (m) - y
+    y = infsup ();
+    y.inf = repmat (y_l(:), 1, b);
+    y.sup = repmat (y_u(:), 1, b);
+    F = fm - y;
+    [l(:, valid), u(:, valid)] = __krawczyk__ (l(:, valid), u(:, valid), ...
+                                               m(:, valid), ...
+                                               F.inf(:, valid), ...
+                                               F.sup(:, valid), ...
+                                               J.inf(:, :, valid), ...
+                                               J.sup(:, :, valid));
+    x.inf = l;
+    x.sup = u;
+  endif
+
+  ## Mean value form f (m) + J (x - m), which is also valid for the
+  ## contracted boxes
+  dx = x - m;
+  dx_r = infsup ();
+  dx_r.inf = repmat (reshape (dx.inf, 1, n, b), r, 1);
+  dx_r.sup = repmat (reshape (dx.sup, 1, n, b), r, 1);
+  mv = fm + reshape (sum (J .* dx_r, 2), r, b);
+  fval_l(:, valid) = max (fval_l(:, valid), mv.inf(:, valid));
+  fval_u(:, valid) = min (fval_u(:, valid), mv.sup(:, valid));
+
+  ## Empty boxes after contraction
+  empty = any (l > u, 1);
+  fval_l(:, empty) = inf;
+  fval_u(:, empty) = -inf;
+
+endfunction
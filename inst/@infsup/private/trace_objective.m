@@ -0,0 +1,51 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{T} =} trace_objective (@var{F}, @var{SIZES}, @var{VERIFY})
+##
+## Trace the objective function @var{F} of a solver on arguments of size
+## @var{SIZES}@{1@}, @dots{}.  Return the traced expression @var{T}, or
+## @code{[]} if @var{F} cannot be traced or if @code{@var{VERIFY} (@var{T})}
+## is false.  @var{VERIFY} shall compare the evaluation of @var{T} with the
+## result of @var{F}, such that the solver can evaluate @var{T} in place of
+## @var{F} without any change in its results.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function T = trace_objective (f, sizes, verify)
+
+  T = [];
+  if (ischar (f))
+    f = str2func (f);
+  endif
+  if (not (is_function_handle (f)))
+    return
+  endif
+
+  try
+    tape = intervaltape (f, sizes{:});
+    if (verify (tape))
+      T = tape;
+    endif
+  catch
+    ## F uses operations, which cannot be recorded
+  end_try_catch
+
+endfunction
@@ -22,6 +22,9 @@
 ## Product of elements along dimension @var{DIM}.  If @var{DIM} is omitted, it
 ## defaults to the first non-singleton dimension.
 ##
+## The product of each slice is computed in a single pass by a compiled
+## function.
+##
 ## Accuracy: The result is a valid enclosure.
 ##
 ## @example
@@ -63,16 +66,11 @@ function [result] = prod (x, dim)
     x = infsup(ones (0, 1));
   endif
 
-  resultsize = size (x);
-  resultsize (dim) = 1;
-  result = infsup (ones (resultsize));
+  [l, u] = __prod__ (x.inf, x.sup, dim);
 
-  idx.type = "()";
-  idx.subs = repmat ({":"}, ndims (x));
-  for i = 1:size (x, dim)
-    idx.subs{dim} = i;
-    result = result .* subsref (x, idx);
-  endfor
+  result = infsup ();
+  result.inf = l;
+  result.sup = u;
 
 endfunction
 
@@ -86,3 +84,7 @@ endfunction
 %!assert (prod (infsup (magic (3)), 3) == magic (3));
 
 %!assert (prod (prod (reshape (infsup (1:24), 1, 2, 3, 4))) == reshape ([720, 665280, 13366080, 96909120], 1, 1, 1, 4))
+%!assert (prod (infsup (zeros (0, 3))) == ones (1, 3));
+%!assert (isempty (prod ([infsup(0), empty(), infsup(2)])));
+%!assert (prod ([entire(), infsup(2), infsup(0)]) == 0);
+%!assert (prod (infsup ([-1, 2], [1, 3])) == infsup (-3, 3));
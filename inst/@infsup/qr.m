@@ -40,49 +40,18 @@
 function [Q, R, P] = qr (A)
 
   ## We use the Gram-Schmidt process, since Householder reflections would
-  ## introduce a much larger overestimation for Q in most cases.
+  ## introduce a much larger overestimation for Q in most cases.  The
+  ## process runs in a single compiled pass with exact dot products.
 
-  n = length (A);
-  Q = resize (A, n);
-  R = zeros (n);
-  P = eye (columns (A));
-
-  warning ("off", "Octave:broadcast", "local");
-
-  for i = 1 : n
-    iColIdx = substruct ("()", {":", i});
-    if (nargout >= 3 && i < columns (A))
-      ## Swap columns of Q, choose the column with maximum norm as next pivot
-      B = subsref (Q, substruct ("()", {":", i : n}));
-      [~, j] = max (mig (sumsq (B, 1)));
-      j += i - 1;
-      if (j != i)
-        swapIdx = 1 : n;
-        swapIdx([i j]) = [j i];
-        swap = @(X) subsref (X, substruct ("()", {":", swapIdx}));
-        Q = swap (Q);
-        R = swap (R);
-        P = P(:, swapIdx(1 : columns (A)));
-      endif
-    endif
-    iCol = subsref (Q, iColIdx);
-    d = norm (iCol, 2);
-    iCol = mulrev (d, iCol, "[-1, +1]");
-    Q = subsasgn (Q, iColIdx, iCol);
-    R = subsasgn (R, substruct ("()", {i, i}), d);
+  [ql, qu, rl, ru, perm] = __qr__ (A.inf, A.sup, nargout >= 3);
 
-    if (i < n)
-      otherColsIdx = substruct ("()", {":", (i + 1) : n});
-      otherCols = subsref (Q, otherColsIdx);
-      d = dot (otherCols, iCol, 1);
-      otherCols -= d .* iCol;
-      Q = subsasgn (Q, otherColsIdx, otherCols);
-      R = subsasgn (R, substruct ("()", {i, (i + 1) : n}), d);
-    endif
-  endfor
-
-  Q = resize (Q, rows (A));
-  R = resize (R, size (A));
+  Q = R = infsup ();
+  Q.inf = ql(1 : rows (A), 1 : rows (A));
+  Q.sup = qu(1 : rows (A), 1 : rows (A));
+  R.inf = rl(1 : rows (A), 1 : columns (A));
+  R.sup = ru(1 : rows (A), 1 : columns (A));
+  P = eye (columns (A));
+  P = P(:, perm(1 : columns (A)));
   P = inv (P);
 
 endfunction
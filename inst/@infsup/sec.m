@@ -41,42 +41,7 @@ function x = sec (x)
     return
   endif
 
-  l = u = derivl = derivu = zeros (size (x.inf));
-
-  ## Check, if wid (x) is certainly greater than 2*pi. This can save the
-  ## computation if some values.
-  width = mpfr_function_d ('minus', -inf, x.sup, x.inf);
-  persistent pi = infsup ("pi");
-  certainlysingularity = width >= sup (pi);
-
-  ## We simply compute the secant for both endpoints.
-  select = not (certainlysingularity);
-  l(select) = min (...
-                    mpfr_function_d ('sec', -inf, x.inf(select)), ...
-                    mpfr_function_d ('sec', -inf, x.sup(select)));
-  u(select) = max (...
-                    mpfr_function_d ('sec', inf, x.inf(select)), ...
-                    mpfr_function_d ('sec', inf, x.sup(select)));
-
-  ## A change of sign is a sufficient singularity indicator
-  certainlysingularity = certainlysingularity | (select & sign (l) ~= sign (u));
-  l(certainlysingularity) = -inf;
-  u(certainlysingularity) = inf;
-
-  ## Check, whether the interval contains a local extremum using the derivative
-  select = not (certainlysingularity);
-  derivl(select) = mpfr_function_d ('sec', 0, x.inf(select)) .* ...
-                   mpfr_function_d ('tan', 0, x.inf(select));
-  derivu(select) = mpfr_function_d ('sec', 0, x.sup(select)) .* ...
-                   mpfr_function_d ('tan', 0, x.sup(select));
-  hasextremum = select & ((derivl <= 0 & derivu >= 0) | ...
-                          (derivl >= 0 & derivu <= 0));
-  l(hasextremum & l > 0) = 1;
-  u(hasextremum & u < 0) = -1;
-
-  emptyresult = isempty (x);
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
+  [l, u] = __trigonometric__ ("sec", x.inf, x.sup);
 
   x.inf = l;
   x.sup = u;
@@ -86,6 +51,11 @@ endfunction
 %!# from the documentation string
 %!assert (sec (infsup (1)) == "[0x1.D9CF0F125CC29, 0x1.D9CF0F125CC2A]");
 
+%!# unbounded intervals contain a whole period
+%!assert (sec (infsup (-inf, 0)) == entire ());
+%!assert (sec (infsup (0, inf)) == entire ());
+%!assert (sec (entire ()) == entire ());
+
 %!shared testdata
 %! # Load compiled test data (from src/test/*.itl)
 %! testdata = load (file_in_loadpath ("test/itl.mat"));
@@ -49,29 +49,7 @@ function a = setdiff (a, b)
     b = infsup (b);
   endif
 
-  ## Resize, if broadcasting is needed
-  if (not (size_equal (a.inf, b.inf)))
-    a.inf = ones (size (b.inf)) .* a.inf;
-    a.sup = ones (size (b.inf)) .* a.sup;
-    b.inf = ones (size (a.inf)) .* b.inf;
-    b.sup = ones (size (a.inf)) .* b.sup;
-  endif
-
-  l = a.inf;
-  u = a.sup;
-
-  select = b.sup >= a.sup & b.inf > a.inf;
-  u(select) = min (u(select), b.inf(select));
-
-  select = b.inf <= a.inf & b.sup < a.sup;
-  l(select) = max (l(select), b.sup(select));
-
-  emptyresult = b.inf <= a.inf & b.sup >= a.sup;
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
-
-  l(l == 0) = -0;
-  u(u == 0) = +0;
+  [l, u] = __set_operation__ ("setdiff", a.inf, a.sup, [], b.inf, b.sup, []);
 
   a.inf = l;
   a.sup = u;
@@ -84,5 +62,8 @@ endfunction
 %!assert (isempty (setdiff (infsup (1, 3), infsup (1, 4))));
 %!assert (setdiff (infsup (-inf, inf), infsup (1, 4)) == infsup (-inf, inf));
 
+%!assert (isequal (setdiff (infsup ([1, 1], [3, 3]), infsup ([2; 0], [4; 1])), infsup ([1, 1; 1, 1], [2, 2; 3, 3])));
+
 %!# from the documentation string
 %! assert (setdiff (infsup (1, 3), infsup (2, 4)) == infsup (1, 2));
+%!error <setdiff: nonconformant arguments> setdiff (infsup (1 : 2), infsup (1 : 3))
@@ -57,72 +57,19 @@ function [c, c1, c2] = setxor (a, b)
     b = infsup (b);
   endif
 
-  ## Resize, if broadcasting is needed
-  if (not (size_equal (a.inf, b.inf)))
-    a.inf = ones (size (b.inf)) .* a.inf;
-    a.sup = ones (size (b.inf)) .* a.sup;
-    b.inf = ones (size (a.inf)) .* b.inf;
-    b.sup = ones (size (a.inf)) .* b.sup;
-  endif
-
-  ## Sort the four boundaries in ascending order b1 <= b2 <= b3 <= b4,
-  ## if only one empty interval is present, then [b2, b3] = [Empty],
-  ## with two empty intervals we also have [b1, b4] = [Empty].
-  b1 = min (a.inf, b.inf);
-  b2 = max (a.inf, b.inf);
-  b3 = min (a.sup, b.sup);
-  b4 = max (a.sup, b.sup);
-  [b2, b3] = deal (min (b2, b3), max (b2, b3));
-
-  l = b1;
-  u = b4;
-
-  select = a.inf == b.inf;
-  l(select) = b3(select);
-
-  select = a.sup == b.sup;
-  u(select) = b2(select);
-
-  select = a.inf == b.inf & a.sup == b.sup;
-  l(select) = inf;
-  u(select) = -inf;
-
-  l(l == 0) = -0;
-  u(u == 0) = +0;
+  [l, u, ~, l1, u1, l2, u2] = __set_operation__ ("setxor", ...
+                                                 a.inf, a.sup, [], ...
+                                                 b.inf, b.sup, []);
 
   c = infsup ();
   c.inf = l;
   c.sup = u;
 
   if (nargout > 1)
-    select = isempty (a) | isempty (b);
-    b1(select) = a.inf(select);
-    b2(select) = a.sup(select);
-    b3(select) = b.inf(select);
-    b4(select) = b.sup(select);
-
-    l1 = b1;
-    u1 = b2;
-    select = a.inf == b.inf;
-    l1(select) = inf;
-    u1(select) = -inf;
-
-    l1(l1 == 0) = -0;
-    u1(u1 == 0) = +0;
-
     c1 = infsup ();
     c1.inf = l1;
     c1.sup = u1;
 
-    l2 = b3;
-    u2 = b4;
-    select = a.sup == b.sup;
-    l2(select) = inf;
-    u2(select) = -inf;
-
-    l2(l2 == 0) = -0;
-    u2(u2 == 0) = +0;
-
     c2 = infsup ();
     c2.inf = l2;
     c2.sup = u2;
@@ -162,3 +109,4 @@ endfunction
 %! assert (z == infsup (1, 4));
 %! assert (z1 == infsup (1, 2));
 %! assert (z2 == infsup (3, 4));
+%!error <setxor: nonconformant arguments> setxor (infsup (1 : 2), infsup (1 : 3))
@@ -42,70 +42,7 @@ function x = sin (x)
     return
   endif
 
-  l = u = cossignl = cossignu = zeros (size (x.inf));
-
-  ## Check, if wid (x) is certainly greater than 2*pi. This can save the
-  ## computation if some sine values.
-  width = mpfr_function_d ('minus', -inf, x.sup, x.inf);
-  persistent pi = infsup ("pi");
-  persistent twopi = 2 .* pi;
-  certainlyfullperiod = width >= sup (twopi);
-  l(certainlyfullperiod) = -1;
-  u(certainlyfullperiod) = 1;
-
-  possiblynotfullperiod = not (certainlyfullperiod);
-  if (__check_crlibm__ ())
-    l(possiblynotfullperiod) = min (crlibm_function ('sin', -inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    crlibm_function ('sin', -inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-    u(possiblynotfullperiod) = max (crlibm_function ('sin', inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    crlibm_function ('sin', inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-
-    ## We use sign (cos) to know the gradient at the boundaries.
-    cossignl(possiblynotfullperiod) = sign (crlibm_function ('cos', .5, ...
-                                                             x.inf(possiblynotfullperiod)));
-    cossignu(possiblynotfullperiod) = sign (crlibm_function ('cos', .5, ...
-                                                             x.sup(possiblynotfullperiod)));
-  else
-    l(possiblynotfullperiod) = min (mpfr_function_d ('sin', -inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    mpfr_function_d ('sin', -inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-    u(possiblynotfullperiod) = max (mpfr_function_d ('sin', inf, ...
-                                                     x.inf(possiblynotfullperiod)), ...
-                                    mpfr_function_d ('sin', inf, ...
-                                                     x.sup(possiblynotfullperiod)));
-
-    ## We use sign (cos) to know the gradient at the boundaries.
-    cossignl(possiblynotfullperiod) = sign (mpfr_function_d ('cos', .5, ...
-                                                             x.inf(possiblynotfullperiod)));
-    cossignu(possiblynotfullperiod) = sign (mpfr_function_d ('cos', .5, ...
-                                                             x.sup(possiblynotfullperiod)));
-  endif
-
-  ## In case of sign (cos) == 0, we conservatively use sign (cos) of nextout.
-  cossignl(cossignl == 0) = sign (l(cossignl == 0));
-  cossignu(cossignu == 0) = (-1) * sign (u(cossignu == 0));
-
-  containsinf = possiblynotfullperiod & ((cossignl == -1 & cossignu == 1) | ...
-                                         (cossignl == cossignu & ...
-                                          width >= sup (pi)));
-  l(containsinf) = -1;
-
-  containssup = possiblynotfullperiod & ((cossignl == 1 & cossignu == -1) | ...
-                                         (cossignl == cossignu & ...
-                                          width >= sup (pi)));
-  u(containssup) = 1;
-
-  emptyresult = isempty (x);
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
-
-  l(l == 0) = -0;
-  u(u == 0) = +0;
+  [l, u] = __trigonometric__ ("sin", x.inf, x.sup);
 
   x.inf = l;
   x.sup = u;
@@ -115,6 +52,11 @@ endfunction
 %!# from the documentation string
 %!assert (sin (infsup (1)) == "[0x1.AED548F090CEEp-1, 0x1.AED548F090CEFp-1]");
 
+%!# unbounded intervals contain a whole period
+%!assert (sin (infsup (-inf, 0)) == infsup (-1, 1));
+%!assert (sin (infsup (0, inf)) == infsup (-1, 1));
+%!assert (sin (entire ()) == infsup (-1, 1));
+
 %!# correct use of signed zeros
 %!test
 %! x = sin (infsup (0));
@@ -127,6 +69,12 @@ endfunction
 %! assert (signbit (inf (x)));
 %! assert (not (signbit (sup (x))));
 
+%!# exact range reduction of large arguments
+%!test
+%! x = sin (infsup (pow2 (1000)));
+%! assert (inf (x) <= sin (pow2 (1000)) && sin (pow2 (1000)) <= sup (x));
+%! assert (sup (x) - inf (x) <= eps (sin (pow2 (1000))));
+
 %!shared testdata
 %! # Load compiled test data (from src/test/*.itl)
 %! testdata = load (file_in_loadpath ("test/itl.mat"));
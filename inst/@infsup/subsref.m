@@ -54,6 +54,9 @@
 
 function varargout = subsref (A, S)
 
+  ## The lookup of methods is slow, remember valid properties
+  persistent valid_properties = struct ();
+
   if (nargin ~= 2)
     print_usage ();
     return
@@ -66,19 +69,23 @@ function varargout = subsref (A, S)
     case "{}"
       error ("interval cannot be indexed with {}")
     case "."
-      if (not (any (strcmp (S(1).subs, methods (A)))))
-        error (["interval property ‘", S(1).subs, "’ is unknown"])
-      endif
-      if (compare_versions (OCTAVE_VERSION, "5.1.0", ">="))
-        functionname = ["@infsup/", S(1).subs];
-      else
-        # Octave 4.4.0 and older have used
-        # sys::file_ops::dir_sep_str in symbol_table::find_function
-        # to look up class method names.
-        functionname = ["@infsup", filesep(), S(1).subs];
-      endif
-      if (nargin (functionname) ~= 1)
-        error (["‘", S(1).subs, "’ is not a valid interval property"])
+      if (not (isvarname (S(1).subs) ...
+               && isfield (valid_properties, S(1).subs)))
+        if (not (any (strcmp (S(1).subs, methods (A)))))
+          error (["interval property ‘", S(1).subs, "’ is unknown"])
+        endif
+        if (compare_versions (OCTAVE_VERSION, "5.1.0", ">="))
+          functionname = ["@infsup/", S(1).subs];
+        else
+          # Octave 4.4.0 and older have used
+          # sys::file_ops::dir_sep_str in symbol_table::find_function
+          # to look up class method names.
+          functionname = ["@infsup", filesep(), S(1).subs];
+        endif
+        if (nargin (functionname) ~= 1)
+          error (["‘", S(1).subs, "’ is not a valid interval property"])
+        endif
+        valid_properties.(S(1).subs) = true;
       endif
       A = feval (S(1).subs, A);
     otherwise
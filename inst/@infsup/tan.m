@@ -41,41 +41,7 @@ function x = tan (x)
     return
   endif
 
-  l = u = zeros (size (x));
-
-  ## Check, if wid (x) is certainly greater than pi. This may save
-  ## computation of some tangent values.
-  width = mpfr_function_d ('minus', -inf, x.sup, x.inf);
-  persistent pi = infsup ("pi");
-  certainlyfullperiod = width >= sup (pi);
-
-  possiblynotfullperiod = not (certainlyfullperiod);
-  if (__check_crlibm__ ())
-    l(possiblynotfullperiod) = crlibm_function ('tan', -inf, ...
-                                                x.inf(possiblynotfullperiod));
-    u(possiblynotfullperiod) = crlibm_function ('tan', inf, ...
-                                                x.sup(possiblynotfullperiod));
-  else
-    l(possiblynotfullperiod) = mpfr_function_d ('tan', -inf, ...
-                                                x.inf(possiblynotfullperiod));
-    u(possiblynotfullperiod) = mpfr_function_d ('tan', inf, ...
-                                                x.sup(possiblynotfullperiod));
-  endif
-
-  singularity = certainlyfullperiod | ...
-                l > u | (...
-                          width > 2 & (...
-                                        sign (l) == sign (u) | ...
-                                        max (abs (l), abs (u)) < 1));
-
-  l(singularity) = -inf;
-  u(singularity) = inf;
-
-  emptyresult = isempty (x);
-  l(emptyresult) = inf;
-  u(emptyresult) = -inf;
-
-  l(l == 0) = -0;
+  [l, u] = __trigonometric__ ("tan", x.inf, x.sup);
 
   x.inf = l;
   x.sup = u;
@@ -85,6 +51,11 @@ endfunction
 %!# from the documentation string
 %!assert (tan (infsup (1)) == "[0x1.8EB245CBEE3A5, 0x1.8EB245CBEE3A6]");
 
+%!# unbounded intervals contain a whole period
+%!assert (tan (infsup (-inf, 0)) == entire ());
+%!assert (tan (infsup (0, inf)) == entire ());
+%!assert (tan (entire ()) == entire ());
+
 %!# correct use of signed zeros
 %!test
 %! x = tan (infsup (0));
@@ -56,8 +56,8 @@ function a = union (a, b, dim)
       if (not (isa (b, "infsup")))
         b = infsup (b);
       endif
-      l = min (a.inf, b.inf);
-      u = max (a.sup, b.sup);
+      [l, u] = __set_operation__ ("union", a.inf, a.sup, [], ...
+                                  b.inf, b.sup, []);
     case 3
       if (not (builtin ("isempty", b)))
         warning ("union: second argument is ignored");
@@ -114,3 +114,4 @@ endfunction
 %! in2 = reshape ([in2; in2(1:i)], testsize);
 %! out = reshape ([out; out(1:i)], testsize);
 %! assert (isequaln (union (in1, in2), out));
+%!error <union: nonconformant arguments> union (infsup (1 : 2), infsup (1 : 3))
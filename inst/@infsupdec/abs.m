@@ -43,9 +43,11 @@ function result = abs (x)
     return
   endif
 
-  result = newdec (abs (x.infsup));
   ## abs is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  [l, u, d] = __arithmetic__ ("abs", inf (x.infsup), sup (x.infsup), x.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
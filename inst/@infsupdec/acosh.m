@@ -41,13 +41,14 @@ function result = acosh (x)
     return
   endif
 
-  result = newdec (acosh (x.infsup));
+  bare = acosh (x.infsup);
 
   ## acosh is continuous everywhere, but defined for [1, Inf] only
   persistent domain = infsup (1, inf);
-  result.dec(not (subset (x.infsup, domain))) = _trv ();
 
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, subset (x.infsup, domain));
 
 endfunction
 
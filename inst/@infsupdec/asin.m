@@ -41,13 +41,14 @@ function result = asin (x)
     return
   endif
 
-  result = newdec (asin (x.infsup));
+  bare = asin (x.infsup);
 
   ## asin is continuous everywhere, but defined for [-1, 1] only
   persistent domain = infsup (-1, 1);
-  result.dec(not (subset (x.infsup, domain))) = _trv ();
 
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, subset (x.infsup, domain));
 
 endfunction
 
@@ -41,9 +41,11 @@ function result = asinh (x)
     return
   endif
 
-  result = newdec (asinh (x.infsup));
+  bare = asinh (x.infsup);
   ## asinh is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
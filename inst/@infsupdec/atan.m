@@ -41,9 +41,11 @@ function result = atan (x)
     return
   endif
 
-  result = newdec (atan (x.infsup));
+  bare = atan (x.infsup);
   ## atan is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
@@ -41,13 +41,14 @@ function result = atanh (x)
     return
   endif
 
-  result = newdec (atanh (x.infsup));
+  bare = atanh (x.infsup);
 
   ## atanh is continuous everywhere, but defined for ]-1, 1[ only
   persistent domain_hull = infsup (-1, 1);
-  result.dec(not (interior (x.infsup, domain_hull))) = _trv ();
 
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, interior (x.infsup, domain_hull));
 
 endfunction
 
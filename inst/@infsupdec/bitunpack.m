@@ -32,7 +32,7 @@
 ## For all scalar intervals the following equation holds:
 ## @code{@var{X} == interval_bitpack (bitunpack (@var{X}))}.
 ##
-## @seealso{interval_bitpack}
+## @seealso{interval_bitpack, interval_pack}
 ## @end defmethod
 
 ## Author: Oliver Heimlich
@@ -46,29 +46,12 @@ function result = bitunpack (x)
     return
   endif
 
-  bare = bitunpack (x.infsup);
-  d = bitunpack (x.dec);
-
   ## The exchange representation of [NaI] is (NaN, NaN, ill).
-  if (any (isnai (x)(:)))
-    bare(vec (1:128) + 128 .* vec (find (isnai (x)) - 1, 2)) = ...
-    [bitunpack(nan (sum (isnai (x)), 2))];
-  endif
-
-  ## Initialize result vector
-  result = zeros (1, length (bare) + length (d), 'logical');
-  if (not (isrow (bare)))
-    result = result';
+  result = bitunpack (interval_pack (x));
+  if (isrow (x.dec))
+    result = result.';
   endif
 
-  ## Merge alternating 128 bit blocks from bare and 8 bit blocks from d together
-  ## into result.
-  target_bare = reshape (1 : length (result), 8, length (result) / 8);
-  target_d = target_bare (:, 17 : 17 : size (target_bare, 2));
-  target_bare(:, 17 : 17 : size (target_bare, 2)) = [];
-  result(target_bare) = bare;
-  result(target_d) = d;
-
 endfunction
 
 %!test
@@ -41,8 +41,10 @@ function result = cbrt (x)
     return
   endif
 
-  result = newdec (cbrt (x.infsup));
-  result.dec = min (result.dec, x.dec);
+  bare = cbrt (x.infsup);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
@@ -0,0 +1,63 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypemethod {@@infsupdec} {@var{R} = } chol (@var{A})
+## @deftypemethodx {@@infsupdec} {[@var{R}, @var{P}] = } chol (@var{A})
+## @deftypemethodx {@@infsupdec} {[@var{R}, @dots{}] = } chol (@dots{}, "upper")
+## @deftypemethodx {@@infsupdec} {[@var{L}, @dots{}] = } chol (@dots{}, "lower")
+##
+## Compute the Cholesky factor, @var{R}, of each symmetric positive definite
+## matrix in @var{A}.
+##
+## The factor is computed on the interval part of @var{A} and carries the
+## trivial decoration, since the factorization is only defined for the
+## positive definite matrices in @var{A}.
+##
+## @seealso{@@infsup/chol}
+## @end deftypemethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [fact, P] = chol (A, varargin)
+
+  if (nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (isnai (A))
+    fact = nai ();
+    P = 0;
+    return
+  endif
+
+  if (nargout >= 2)
+    [fact, P] = chol (A.infsup, varargin{:});
+  else
+    fact = chol (A.infsup, varargin{:});
+  endif
+
+  fact = infsupdec (fact, "trv");
+
+endfunction
+
+%!assert (chol (infsupdec (pascal (10))) == chol (pascal (10)));
+%!test
+%! R = chol (infsupdec (pascal (3)), "lower");
+%! assert (isequal (R, infsupdec (chol (pascal (3), "lower"), "trv")));
@@ -41,9 +41,11 @@ function result = cos (x)
     return
   endif
 
-  result = newdec (cos (x.infsup));
   ## cos is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  [l, u, d] = __arithmetic__ ("cos", inf (x.infsup), sup (x.infsup), x.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
@@ -41,9 +41,11 @@ function result = cosh (x)
     return
   endif
 
-  result = newdec (cosh (x.infsup));
+  bare = cosh (x.infsup);
   ## cosh is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
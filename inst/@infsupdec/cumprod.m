@@ -0,0 +1,69 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@infsupdec} cumprod (@var{X})
+## @defmethodx {@@infsupdec} cumprod (@var{X}, @var{DIM})
+##
+## Cumulative product of elements along dimension @var{DIM}.  If @var{DIM} is
+## omitted, it defaults to the first non-singleton dimension.
+##
+## Accuracy: The result is a valid enclosure.
+##
+## @example
+## @group
+## cumprod (infsupdec (1 : 4))
+##   @result{} ans = 1×4 interval vector
+##
+##      [1]_com   [2]_com   [6]_com   [24]_com
+##
+## @end group
+## @end example
+## @seealso{@@infsupdec/prod, @@infsupdec/cumsum}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = cumprod (x, dim)
+
+  if (nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (nargin < 2)
+    ## Try to find non-singleton dimension
+    dim = find (size (x.dec) ~= 1, 1);
+    if (isempty (dim))
+      dim = 1;
+    endif
+  endif
+
+  result = newdec (cumprod (x.infsup, dim));
+  if (not (isempty (x.dec)))
+    result.dec = min (result.dec, cummin (x.dec, dim));
+  endif
+
+endfunction
+
+%!# from the documentation string
+%!assert (isequal (cumprod (infsupdec (1 : 4)), infsupdec ([1, 2, 6, 24])));
+
+%!test
+%! x = cumprod (infsupdec ([1; 2; 3], {"dac"; "com"; "trv"}));
+%! assert (decorationpart (x), {"dac"; "dac"; "trv"});
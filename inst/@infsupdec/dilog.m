@@ -57,9 +57,11 @@ function result = dilog (x)
     return
   endif
 
-  result = newdec (dilog (x.infsup));
+  bare = dilog (x.infsup);
   ## dilog is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
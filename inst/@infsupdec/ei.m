@@ -57,13 +57,14 @@ function result = ei (x)
     return
   endif
 
-  result = newdec (ei (x.infsup));
+  bare = ei (x.infsup);
 
   ## ei is continuous everywhere, but defined for x > 0 only
   persistent domain_hull = infsup (0, inf);
-  result.dec (not (interior (x.infsup, domain_hull))) = _trv ();
 
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, interior (x.infsup, domain_hull));
 
 endfunction
 
@@ -58,9 +58,11 @@ function result = erf (x)
     return
   endif
 
-  result = newdec (erf (x.infsup));
+  bare = erf (x.infsup);
   ## erf is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
@@ -58,9 +58,11 @@ function result = erfc (x)
     return
   endif
 
-  result = newdec (erfc (x.infsup));
+  bare = erfc (x.infsup);
   ## erfc is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
@@ -41,9 +41,11 @@ function result = exp (x)
     return
   endif
 
-  result = newdec (exp (x.infsup));
   ## exp is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  [l, u, d] = __arithmetic__ ("exp", inf (x.infsup), sup (x.infsup), x.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
@@ -41,9 +41,11 @@ function result = expm1 (x)
     return
   endif
 
-  result = newdec (expm1 (x.infsup));
+  bare = expm1 (x.infsup);
   ## expm1 is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
@@ -58,9 +58,11 @@ function result = fma (x, y, z)
     z = infsupdec (z);
   endif
 
-  result = newdec (fma (x.infsup, y.infsup, z.infsup));
+  bare = fma (x.infsup, y.infsup, z.infsup);
   ## fma is defined and continuous everywhere
-  result.dec = min (result.dec, min (x.dec, min (y.dec, z.dec)));
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, y.dec, z.dec);
 
 endfunction
 
@@ -51,9 +51,11 @@ function result = hypot (x, y)
     y = infsupdec (y);
   endif
 
-  result = newdec (hypot (x.infsup, y.infsup));
+  bare = hypot (x.infsup, y.infsup);
   ## hypot is continuous and defined everywhere
-  result.dec = min (result.dec, min (x.dec, y.dec));
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, y.dec);
 
 endfunction
 
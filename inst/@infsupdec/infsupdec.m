@@ -71,6 +71,11 @@
 ## will produce NaIs, whereas illegal decorations provided as an additional
 ## function parameter will be automatically adjusted.
 ##
+## In the syntax @code{infsupdec (@var{I}, @var{D})}, the decorations may
+## also be given as a uint8 array, as returned by
+## @code{decorationpart (@var{X}, "uint8")}.  The numeric decoration 0
+## (@code{ill}) produces NaIs.
+##
 ## For the creation of interval arrays, arguments may be provided as (1) cell
 ## arrays with arbitrary/mixed types, (2) numeric arrays, or for matrices (3)
 ## strings.  Scalar values do broadcast.
@@ -102,8 +107,11 @@
 
 function [x, isexact] = infsupdec (varargin)
 
+  ## The parent object of the class must be an old-style class object.  The
+  ## natively stored bare interval is assigned afterwards, see below.
   persistent scalar_empty_interval = class (struct ("dec", _trv), ...
-                                            "infsupdec", infsup ());
+                                            "infsupdec", ...
+                                            __infsup__ ("object", infsup ()));
 
   ## Enable all mixed mode functions to use decorated variants with implicit
   ## conversion from bare to decorated intervals.
@@ -139,7 +147,17 @@ function [x, isexact] = infsupdec (varargin)
     endif
   endfor
 
-  if (nargin >= 1 && ...
+  if (nargin == 2 && isa (varargin{1}, "infsup") && ...
+      isa (varargin{2}, "uint8"))
+    ## Numeric decorations, e. g., from the interchange format
+    decstr = [];
+    dec = varargin{2};
+    varargin = varargin(1);
+
+    ## The setDec function, as described by IEEE Std 1788-2015,
+    ## may fix decorations
+    fix_illegal_decorations = true;
+  elseif (nargin >= 1 && ...
       iscellstr (varargin{end}) && ...
       not (isempty (varargin{end})) && ...
       any (strcmpi (varargin{end}{1}, ...
@@ -248,22 +266,32 @@ function [x, isexact] = infsupdec (varargin)
       return
   endswitch
 
-  ## Convert decoration strings into decoration matrix.
-  ## Initialize the matrix with the ill decoration, which is not allowed to
-  ## be used explicitly as a parameter to this function.
-  dec = repmat (_ill, size (decstr));
-
   ## Missing decorations will later be assigned their final value
   missingdecoration_value = uint8 (1); # magic value, not used otherwise
-  dec(cellfun ("isempty", decstr)) = missingdecoration_value;
 
-  dec(strcmpi (decstr, "com")) = _com;
-  dec(strcmpi (decstr, "dac")) = _dac;
-  dec(strcmpi (decstr, "def")) = _def;
-  dec(strcmpi (decstr, "trv")) = _trv;
+  if (iscell (decstr))
+    ## Convert decoration strings into decoration matrix.
+    ## Initialize the matrix with the ill decoration, which is not allowed to
+    ## be used explicitly as a parameter to this function.
+    dec = repmat (_ill, size (decstr));
+    dec(cellfun ("isempty", decstr)) = missingdecoration_value;
+
+    dec(strcmpi (decstr, "com")) = _com;
+    dec(strcmpi (decstr, "dac")) = _dac;
+    dec(strcmpi (decstr, "def")) = _def;
+    dec(strcmpi (decstr, "trv")) = _trv;
 
-  if (any ((dec == _ill)(:)))
-    warning ("interval:UndefinedOperation", "illegal decoration");
+    if (any ((dec == _ill)(:)))
+      warning ("interval:UndefinedOperation", "illegal decoration");
+    endif
+  else
+    ## Numeric decoration ill is legal and produces NaIs
+    illegal = (dec ~= _ill) & (dec ~= _trv) & (dec ~= _def) & ...
+              (dec ~= _dac) & (dec ~= _com);
+    if (any (illegal(:)))
+      warning ("interval:UndefinedOperation", "illegal decoration");
+      dec(illegal) = _ill;
+    endif
   endif
 
   ## Broadcast decoration and bare interval
@@ -327,7 +355,9 @@ function [x, isexact] = infsupdec (varargin)
     isexact = false ();
   endif
 
-  x = class (struct ("dec", dec), "infsupdec", bare);
+  x = scalar_empty_interval;
+  x.infsup = bare;
+  x.dec = dec;
 
 endfunction
 
@@ -610,3 +640,14 @@ endfunction
 %! in2 = reshape ([in2; in2(1:i)], testsize);
 %! out = reshape ([out; out(1:i)], testsize);
 %! assert (isequaln (infsupdec (in1, in2), out));
+
+%!# numeric decorations
+%!test
+%! x = infsupdec (infsup ([1, 2, -inf, 0], [1, 2, inf, 0]), uint8 ([16, 8, 16, 0]));
+%! assert (decorationpart (x), {"com", "def", "dac", "ill"});
+%! assert (isnai (x), [false, false, false, true]);
+%!test
+%! x = infsupdec (infsup (1, 2), uint8 (4));
+%! assert (decorationpart (x, "uint8"), uint8 (4));
+%!warning id=interval:UndefinedOperation
+%! assert (isnai (infsupdec (infsup (1, 2), uint8 (7))));
@@ -43,13 +43,11 @@ function result = log (x)
     return
   endif
 
-  result = newdec (log (x.infsup));
-
   ## log is continuous everywhere, but defined for x > 0 only
-  persistent domain_hull = infsup (0, inf);
-  result.dec(not (interior (x.infsup, domain_hull))) = _trv ();
-
-  result.dec = min (result.dec, x.dec);
+  [l, u, d] = __arithmetic__ ("log", inf (x.infsup), sup (x.infsup), x.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
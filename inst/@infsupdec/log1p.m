@@ -43,13 +43,14 @@ function result = log1p (x)
     return
   endif
 
-  result = newdec (log1p (x.infsup));
+  bare = log1p (x.infsup);
 
   ## log1p is continuous everywhere, but defined for x > -1 only
   persistent domain_hull = infsup (-1, inf);
-  result.dec(not (interior (x.infsup, domain_hull))) = _trv ();
 
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, interior (x.infsup, domain_hull));
 
 endfunction
 
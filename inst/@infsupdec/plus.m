@@ -51,9 +51,14 @@ function result = plus (x, y)
     y = infsupdec (y);
   endif
 
-  result = newdec (plus (x.infsup, y.infsup));
-  ## plus is continuous and defined everywhere
-  result.dec = min (result.dec, min (x.dec, y.dec));
+  ## The bounds, the domain check, and the decoration are computed in a
+  ## single pass
+  [l, u, d] = __arithmetic__ ("plus", ...
+                              inf (x.infsup), sup (x.infsup), x.dec, ...
+                              inf (y.infsup), sup (y.infsup), y.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
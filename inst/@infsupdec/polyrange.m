@@ -0,0 +1,65 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@infsupdec} polyrange (@var{P}, @var{X})
+## @defmethodx {@@infsupdec} polyrange (@var{P}, @var{X}, @var{TOL})
+## @defmethodx {@@infsupdec} polyrange (@var{P}, @var{X}, @var{TOL}, @var{MAXBOXES})
+##
+## Compute an enclosure of the range of polynomial @var{P} over the interval
+## box @var{X}.
+##
+## The polynomial is converted into Bernstein form on the box @var{X} and
+## subdivided with the de Casteljau algorithm, see @code{@@infsup/polyrange}.
+##
+## Accuracy: The result is a valid enclosure.
+##
+## @example
+## @group
+## polyrange (infsupdec ([1, -2, 0]), infsupdec (0, 2)) # x^2 - 2x | x = 0 .. 2
+##   @result{} ans = [-1, 0]_com
+## @end group
+## @end example
+## @seealso{@@infsupdec/polyval}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = polyrange (p, x, varargin)
+
+  if (nargin < 2 || nargin > 4)
+    print_usage ();
+    return
+  endif
+
+  if (not (isa (x, "infsupdec")))
+    x = infsupdec (x);
+  endif
+  if (not (isa (p, "infsupdec")))
+    p = infsupdec (p);
+  endif
+
+  result = newdec (polyrange (p.infsup, x.infsup, varargin{:}));
+  result.dec = min (result.dec, min ([p.dec(:); x.dec(:)]));
+
+endfunction
+
+%!# from the documentation string
+%!assert (isequal (polyrange (infsupdec ([1, -2, 0]), infsupdec (0, 2)), infsupdec (-1, 0)));
+
+%!assert (isequal (decorationpart (polyrange (infsupdec ([1, 2], "def"), infsupdec (0, 1))), {"def"}));
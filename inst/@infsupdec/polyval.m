@@ -16,11 +16,15 @@
 ## -*- texinfo -*-
 ## @documentencoding UTF-8
 ## @defmethod {@@infsupdec} polyval (@var{P}, @var{X})
+## @defmethodx {@@infsupdec} polyval (@var{P}, @var{X}, "centered")
 ##
 ## Evaluate polynomial @var{P} with argument @var{X}.
 ##
-## Horner's scheme is used to evaluate a first approximation.  The result is
-## improved with iterative refinement.
+## @var{X} may be an interval array, whose elements are evaluated
+## independently.  Horner's scheme is used to evaluate a first approximation.
+## For singleton intervals @var{X}, the result is improved with iterative
+## refinement.  With option @code{"centered"}, the result for other intervals
+## is intersected with the centered form.
 ##
 ## Accuracy: The result is a tight enclosure for polynomials of degree 1 or
 ## less.  For polynomials of higher degree the result is a valid enclosure.
@@ -43,9 +47,9 @@
 ## Keywords: interval
 ## Created: 2015-05-30
 
-function result = polyval (p, x)
+function result = polyval (p, x, varargin)
 
-  if (nargin ~= 2)
+  if (nargin < 2 || nargin > 3)
     print_usage ();
     return
   endif
@@ -57,9 +61,14 @@ function result = polyval (p, x)
     p = infsupdec (p);
   endif
 
-  result = newdec (polyval (p.infsup, x.infsup));
+  result = newdec (polyval (p.infsup, x.infsup, varargin{:}));
   result.dec = min (result.dec, min (min (p.dec), x.dec));
 
 endfunction
 
 %!assert (isequal (polyval (infsupdec (3, "trv"), 0), infsupdec (3, "trv")));
+%!test
+%! y = polyval (infsupdec ([1, -2, 1]), infsupdec ([0.9, 2], [1.1, 2], {"com", "def"}), "centered");
+%! assert (decorationpart (y), {"com", "def"});
+%! assert (sup (y(1)) < 0.05);
+%! assert (y(2) == 1);
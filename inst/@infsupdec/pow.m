@@ -52,7 +52,7 @@ function result = pow (x, y)
     y = infsupdec (y);
   endif
 
-  result = newdec (pow (x.infsup, y.infsup));
+  bare = pow (x.infsup, y.infsup);
 
   ## pow is continuous everywhere (where it is defined),
   ## but defined for x > 0 or (x = 0 and y > 0) only
@@ -60,9 +60,9 @@ function result = pow (x, y)
   domain = interior (x.infsup, nonnegative) | ...
            (subset (x.infsup, nonnegative) & interior (y.infsup, nonnegative));
 
-  result.dec(not (domain)) = _trv ();
-
-  result.dec = min (result.dec, min (x.dec, y.dec));
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, y.dec, domain);
 
 endfunction
 
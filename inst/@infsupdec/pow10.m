@@ -41,9 +41,11 @@ function result = pow10 (x)
     return
   endif
 
-  result = newdec (pow10 (x.infsup));
+  bare = pow10 (x.infsup);
   ## pow10 is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
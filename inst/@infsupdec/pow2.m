@@ -41,9 +41,11 @@ function result = pow2 (x)
     return
   endif
 
-  result = newdec (pow2 (x.infsup));
+  bare = pow2 (x.infsup);
   ## pow2 is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
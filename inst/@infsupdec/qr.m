@@ -0,0 +1,57 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypemethod {@@infsupdec} {[@var{Q}, @var{R}] =} qr (@var{A})
+## @deftypemethodx {@@infsupdec} {[@var{Q}, @var{R}, @var{P}] =} qr (@var{A})
+##
+## Compute the QR decomposition of @var{A}.
+##
+## The decomposition is computed on the interval part of @var{A}.  The
+## columns of @var{Q} are normalized with a reverse operation, thus, the
+## result carries the trivial decoration.
+##
+## @seealso{@@infsup/qr}
+## @end deftypemethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [Q, R, P] = qr (A)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  if (nargout >= 3)
+    [Q, R, P] = qr (A.infsup);
+  else
+    [Q, R] = qr (A.infsup);
+  endif
+
+  ## Reverse operations should not carry decoration
+  Q = infsupdec (Q, "trv");
+  R = infsupdec (R, "trv");
+
+endfunction
+
+%!test
+%! A = infsupdec ([1 2 3; 4 5 6]);
+%! [Q, R] = qr (A);
+%! assert (all (all (subset (A, Q * R))));
+%! assert (isequal (decorationpart (Q), {"trv", "trv"; "trv", "trv"}));
@@ -54,15 +54,14 @@ function result = rdivide (x, y)
     y = infsupdec (y);
   endif
 
-  result = newdec (rdivide (x.infsup, y.infsup));
-
-  divisionbyzero = ismember (0, y);
-  if (not (size_equal (x.dec, y.dec)))
-    divisionbyzero = divisionbyzero & true (size (x.dec));
-  endif
-  result.dec(divisionbyzero) = _trv ();
-
-  result.dec = min (result.dec, min (x.dec, y.dec));
+  ## The bounds, the domain check, and the decoration are computed in a
+  ## single pass
+  [l, u, d] = __arithmetic__ ("rdivide", ...
+                              inf (x.infsup), sup (x.infsup), x.dec, ...
+                              inf (y.infsup), sup (y.infsup), y.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
@@ -139,3 +138,10 @@ endfunction
 %! in1 = reshape ([in1; in1(1:i)], testsize);
 %! out = reshape ([out; out(1:i)], testsize);
 %! assert (isequaln (rdivide (1, in1), out));
+%!test
+%! x = infsupdec (1) ./ infsupdec ([2, 0, -1, -1], [4, 0, 1, 0]);
+%! assert (isequal (x([1, 3, 4]), infsupdec ([0.25, -inf, -inf], [0.5, inf, -1], {"com", "trv", "trv"})));
+%! assert (isempty (x(2)));
+%! assert (decorationpart (x(2)), {"trv"});
+%!assert (isnai (infsupdec (1) ./ nai ()));
+%!assert (isequal (infsupdec ([1; 2], "dac") ./ infsupdec ([1, 2]), infsupdec ([1, 0.5; 2, 1], "dac")));
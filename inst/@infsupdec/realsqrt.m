@@ -41,14 +41,11 @@ function result = realsqrt (x)
     return
   endif
 
-  result = newdec (realsqrt (x.infsup));
-
   ## realsqrt is continuous everywhere, but defined for x >= 0 only
-  persistent domain = infsup (0, inf);
-  defined = subset (x.infsup, domain);
-  result.dec(not (defined)) = _trv ();
-
-  result.dec = min (result.dec, x.dec);
+  [l, u, d] = __arithmetic__ ("realsqrt", inf (x.infsup), sup (x.infsup), x.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
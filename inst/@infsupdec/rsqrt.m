@@ -41,13 +41,14 @@ function result = rsqrt (x)
     return
   endif
 
-  result = newdec (rsqrt (x.infsup));
+  bare = rsqrt (x.infsup);
 
   ## rsqrt is continuous everywhere, but defined for x > 0 only
   persistent domain_hull = infsup (0, inf);
-  result.dec(not (interior (x.infsup, domain_hull))) = _trv ();
 
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec, interior (x.infsup, domain_hull));
 
 endfunction
 
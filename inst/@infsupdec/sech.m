@@ -41,9 +41,11 @@ function result = sech (x)
     return
   endif
 
-  result = newdec (sech (x.infsup));
+  bare = sech (x.infsup);
   ## sech is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
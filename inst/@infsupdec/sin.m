@@ -42,9 +42,11 @@ function result = sin (x)
     return
   endif
 
-  result = newdec (sin (x.infsup));
   ## sin is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  [l, u, d] = __arithmetic__ ("sin", inf (x.infsup), sup (x.infsup), x.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
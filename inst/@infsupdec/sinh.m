@@ -41,9 +41,11 @@ function result = sinh (x)
     return
   endif
 
-  result = newdec (sinh (x.infsup));
+  bare = sinh (x.infsup);
   ## sinh is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
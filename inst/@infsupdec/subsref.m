@@ -55,6 +55,9 @@
 
 function varargout = subsref (A, S)
 
+  ## The lookup of methods is slow, remember valid properties
+  persistent valid_properties = struct ();
+
   if (nargin ~= 2)
     print_usage ();
     return
@@ -67,26 +70,30 @@ function varargout = subsref (A, S)
     case "{}"
       error ("interval cannot be indexed with {}")
     case "."
-      if (any (strcmp (S(1).subs, methods ("infsupdec"))))
-        if (compare_versions (OCTAVE_VERSION, "5.1.0", ">="))
-          functionname = ["@infsupdec/", S(1).subs];
+      if (not (isvarname (S(1).subs) ...
+               && isfield (valid_properties, S(1).subs)))
+        if (any (strcmp (S(1).subs, methods ("infsupdec"))))
+          if (compare_versions (OCTAVE_VERSION, "5.1.0", ">="))
+            functionname = ["@infsupdec/", S(1).subs];
+          else
+            # Octave 4.4.0 and older have used
+            # sys::file_ops::dir_sep_str in symbol_table::find_function
+            # to look up class method names.
+            functionname = ["@infsupdec", filesep(), S(1).subs];
+          endif
+        elseif (any (strcmp (S(1).subs, methods ("infsup"))))
+          if (compare_versions (OCTAVE_VERSION, "5.1.0", ">="))
+            functionname = ["@infsup/", S(1).subs];
+          else
+            functionname = ["@infsup", filesep(), S(1).subs];
+          endif
         else
-          # Octave 4.4.0 and older have used
-          # sys::file_ops::dir_sep_str in symbol_table::find_function
-          # to look up class method names.
-          functionname = ["@infsupdec", filesep(), S(1).subs];
+          error (["interval property ‘", S(1).subs, "’ is unknown"])
         endif
-      elseif (any (strcmp (S(1).subs, methods ("infsup"))))
-        if (compare_versions (OCTAVE_VERSION, "5.1.0", ">="))
-          functionname = ["@infsup/", S(1).subs];
-        else
-          functionname = ["@infsup", filesep(), S(1).subs];
+        if (nargin (functionname) ~= 1)
+          error (["‘", S(1).subs, "’ is not a valid interval property"])
         endif
-      else
-        error (["interval property ‘", S(1).subs, "’ is unknown"])
-      endif
-      if (nargin (functionname) ~= 1)
-        error (["‘", S(1).subs, "’ is not a valid interval property"])
+        valid_properties.(S(1).subs) = true;
       endif
       A = feval (S(1).subs, A);
     otherwise
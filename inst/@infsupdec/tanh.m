@@ -41,9 +41,11 @@ function result = tanh (x)
     return
   endif
 
-  result = newdec (tanh (x.infsup));
+  bare = tanh (x.infsup);
   ## tanh is defined and continuous everywhere
-  result.dec = min (result.dec, x.dec);
+  result = x;
+  result.infsup = bare;
+  result.dec = __decorate__ (bare, x.dec);
 
 endfunction
 
@@ -50,9 +50,14 @@ function result = times (x, y)
     y = infsupdec (y);
   endif
 
-  result = newdec (times (x.infsup, y.infsup));
-  ## times is defined and continuous everywhere
-  result.dec = min (result.dec, min (x.dec, y.dec));
+  ## The bounds, the domain check, and the decoration are computed in a
+  ## single pass
+  [l, u, d] = __arithmetic__ ("times", ...
+                              inf (x.infsup), sup (x.infsup), x.dec, ...
+                              inf (y.infsup), sup (y.infsup), y.dec);
+  result = x;
+  result.infsup = __infsup__ (l, u);
+  result.dec = d;
 
 endfunction
 
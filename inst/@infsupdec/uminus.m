@@ -43,8 +43,8 @@ function result = uminus (x)
   endif
 
   ## uminus is defined and continuous everywhere
-  result = newdec (uminus (x.infsup));
-  result.dec = x.dec;
+  result = x;
+  result.infsup = uminus (x.infsup);
 
 endfunction
 
@@ -0,0 +1,70 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} append (@var{F}, @var{X})
+##
+## Append the elements of interval array @var{X} to the file of @var{F}.
+##
+## The elements are appended in column-major order.  Bare intervals are
+## converted into decorated intervals and vice versa, if necessary.
+##
+## @seealso{@@intervalfile/intervalfile}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function F = append (F, x)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (strcmp (F.class_name, "infsupdec"))
+    if (not (isa (x, "infsupdec")))
+      x = infsupdec (x);
+    endif
+  else
+    if (isa (x, "infsupdec"))
+      x = intervalpart (x);
+    elseif (not (isa (x, "infsup")))
+      x = infsup (x);
+    endif
+  endif
+
+  fid = open_data (F, "a");
+  unwind_protect
+    fwrite (fid, interval_pack (x, F.arch));
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, "infsupdec");
+%!   f = append (f, infsupdec (1, 2, "def"));
+%!   f = append (f, [3; 4]);
+%!   assert (numel (f), 3);
+%!   assert (decorationpart (f(:)), {"def"; "com"; "com"});
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
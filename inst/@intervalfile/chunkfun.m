@@ -0,0 +1,108 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} chunkfun (@var{FUN}, @var{F}, @var{FILENAME})
+## @defmethodx {@@intervalfile} chunkfun (@var{FUN}, @var{F}, @var{G}, @dots{}, @var{FILENAME})
+##
+## Evaluate element-wise function @var{FUN} on the intervals in the files of
+## @var{F}, @var{G}, @dots{} and store the result in a new file
+## @var{FILENAME}.
+##
+## The files are processed in chunks of constant size.  For each chunk,
+## @var{FUN} is called with interval column vectors of equal size and must
+## return an interval column vector of the same size.  Any interval
+## function, which operates element-wise, can be used, e. g.,
+## @code{@@exp} or @code{@@plus}.  The result is decorated if the first
+## result chunk is decorated.
+##
+## @example
+## @group
+## f = intervalfile (tempname (), infsup (1 : 3));
+## g = chunkfun (@@sqr, f, tempname ());
+## g(:)
+##   @result{} ans = 3×1 interval vector
+##
+##        [1]
+##        [4]
+##        [9]
+##
+## @end group
+## @end example
+## @seealso{@@intervalfile/intervalfile}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = chunkfun (fun, varargin)
+
+  if (nargin < 3 || not (ischar (varargin{end})))
+    print_usage ();
+    return
+  endif
+
+  filename = varargin{end};
+  F = varargin(1 : end - 1);
+  if (not (all (cellfun ("isclass", F, "intervalfile"))))
+    error ("interval:InvalidOperand", ...
+           "chunkfun: all arguments must be of class intervalfile");
+  endif
+  n = numel (F{1});
+  if (any (cellfun ("numel", F) ~= n))
+    error ("interval:InvalidOperand", ...
+           "chunkfun: files must contain the same number of intervals");
+  endif
+
+  fid = zeros (size (F));
+  unwind_protect
+    for k = 1 : numel (F)
+      fid(k) = open_data (F{k}, "r");
+    endfor
+    chunks = cell (size (F));
+    for offset = 1 : chunksize () : max (1, n)
+      for k = 1 : numel (F)
+        chunks{k} = read_chunk (F{k}, fid(k));
+      endfor
+      y = fun (chunks{:});
+      if (numel (y) ~= numel (chunks{1}))
+        error ("interval:InvalidOperand", ...
+               "chunkfun: FUN must operate element-wise");
+      endif
+      if (offset == 1)
+        result = intervalfile (filename, class (y), F{1}.arch);
+      endif
+      append (result, y);
+    endfor
+  unwind_protect_cleanup
+    for k = find (fid > 0)
+      fclose (fid(k));
+    endfor
+  end_unwind_protect
+
+endfunction
+
+%!test
+%! file = {tempname(), tempname(), tempname()};
+%! unwind_protect
+%!   f = intervalfile (file{1}, infsup (1 : 3, 2 : 4));
+%!   g = intervalfile (file{2}, infsup (4 : 6));
+%!   h = chunkfun (@plus, f, g, file{3});
+%!   assert (isequal (h(:), infsup ([5; 7; 9], [6; 8; 10])));
+%! unwind_protect_cleanup
+%!   cellfun (@unlink, file);
+%! end_unwind_protect
@@ -0,0 +1,57 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} display (@var{F})
+##
+## Display the variable name, the size, and the file name of @var{F}.
+##
+## The intervals are not read from the file.
+##
+## @example
+## @group
+## f = intervalfile ("/tmp/data.bin", infsup (1 : 3))
+##   @result{} f = 3×1 interval vector in file /tmp/data.bin
+## @end group
+## @end example
+## @seealso{@@intervalfile/intervalfile}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function display (F)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  label = inputname (1);
+  if (isempty (label))
+    label = "ans";
+  endif
+
+  if (strcmp (F.class_name, "infsupdec"))
+    kind = "decorated interval vector";
+  else
+    kind = "interval vector";
+  endif
+
+  printf ("%s = %d×1 %s in file %s\n", label, numel (F), kind, F.filename);
+
+endfunction
@@ -0,0 +1,111 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} dot (@var{F}, @var{G})
+##
+## Dot product of the interval vectors in the files of @var{F} and @var{G}.
+##
+## @var{G} may also be an interval or numeric vector in memory with the same
+## number of elements.  The files are processed chunk by chunk with
+## @code{@@infsup/dot}.
+##
+## Accuracy: The result is an accurate enclosure.  The products of each
+## chunk and the partial result of the previous chunks are summed up exactly
+## and rounded once per chunk.  For files with at most 1048576 intervals the
+## result is tight.
+##
+## @seealso{@@infsup/dot}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = dot (F, G)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (not (isa (F, "intervalfile")))
+    ## Dot product is commutative
+    [F, G] = deal (G, F);
+  endif
+
+  n = numel (F);
+  if (numel (G) ~= n)
+    error ("interval:InvalidOperand", ...
+           "dot: files must contain the same number of intervals");
+  endif
+
+  in_memory = not (isa (G, "intervalfile"));
+  fid = zeros (1, 2);
+  unwind_protect
+    fid(1) = open_data (F, "r");
+    if (not (in_memory))
+      fid(2) = open_data (G, "r");
+    endif
+
+    for offset = 1 : chunksize () : max (1, n)
+      x = read_chunk (F, fid(1));
+      if (in_memory)
+        y = G(offset : offset + numel (x) - 1)(:);
+      else
+        y = read_chunk (G, fid(2));
+      endif
+      if (offset == 1)
+        result = dot (x, y, 1);
+      else
+        ## The partial result enters the exact dot product of the chunk, such
+        ## that the sum is rounded only once per chunk
+        result = dot ([result; x], [1; y], 1);
+      endif
+    endfor
+  unwind_protect_cleanup
+    for k = find (fid > 0)
+      fclose (fid(k));
+    endfor
+  end_unwind_protect
+
+endfunction
+
+%!test
+%! file = {tempname(), tempname()};
+%! unwind_protect
+%!   f = intervalfile (file{1}, infsup ([1, 2, 3]));
+%!   g = intervalfile (file{2}, infsup ([4, 5, 6], [4, 5, 7]));
+%!   assert (isequal (dot (f, g), infsup (32, 35)));
+%!   assert (isequal (dot (f, [1, 1, 1]), infsup (6)));
+%!   assert (isequal (dot (infsup ([1, 1, 1]), f), infsup (6)));
+%! unwind_protect_cleanup
+%!   cellfun (@unlink, file);
+%! end_unwind_protect
+
+%!test
+%! file = {tempname(), tempname()};
+%! unwind_protect
+%!   x = [1, pow2(-60) * ones(1, 1048576), -1];
+%!   f = intervalfile (file{1}, infsup (x));
+%!   g = intervalfile (file{2}, infsup (ones (size (x))));
+%!   ## The partial result of the first chunk is rounded, the second is not
+%!   y = dot (f, g);
+%!   assert (subset (infsup (pow2 (-40)), y));
+%!   assert (sup (y) - inf (y) <= pow2 (-52));
+%! unwind_protect_cleanup
+%!   cellfun (@unlink, file);
+%! end_unwind_protect
@@ -0,0 +1,84 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} hull (@var{F})
+##
+## Interval enclosure of all intervals in the file of @var{F}.
+##
+## The file is processed chunk by chunk with @code{@@infsup/union}.  For
+## decorated intervals, the result carries the best possible decoration,
+## which is allowed by the decorations in the file, like the function
+## @code{hull}.
+##
+## Accuracy: The result is a tight enclosure.
+##
+## @seealso{hull, @@infsup/union}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = hull (F)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  if (strcmp (F.class_name, "infsupdec"))
+    result = reduce_chunks (F, @decorated_hull);
+  else
+    result = reduce_chunks (F, @(x) union (x, [], 1));
+  endif
+
+endfunction
+
+function result = decorated_hull (x)
+
+  d = decorationpart (x, "uint8");
+  if (any (d == 0))
+    result = nai ();
+    return
+  endif
+
+  bare = union (intervalpart (x), [], 1);
+  result = infsupdec (bare, min ([decorationpart(newdec (bare), "uint8"); d]));
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   x = infsup ([1, 3, 0], [2, 4, 0]);
+%!   x(3) = infsup ();
+%!   f = intervalfile (file, x);
+%!   assert (isequal (hull (f), infsup (1, 4)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, infsupdec ([1, 3], [2, 4], {"com", "def"}));
+%!   assert (isequal (hull (f), infsupdec (1, 4, "def")));
+%!   f = append (f, nai ());
+%!   assert (isnai (hull (f)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
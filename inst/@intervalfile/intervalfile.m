@@ -0,0 +1,194 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypeop Constructor {@@intervalfile} {@var{F} =} intervalfile (@var{FILENAME})
+## @deftypeopx Constructor {@@intervalfile} {@var{F} =} intervalfile (@var{FILENAME}, @var{CLASS})
+## @deftypeopx Constructor {@@intervalfile} {@var{F} =} intervalfile (@var{FILENAME}, @var{CLASS}, @var{ARCH})
+## @deftypeopx Constructor {@@intervalfile} {@var{F} =} intervalfile (@var{FILENAME}, @var{X})
+## @deftypeopx Constructor {@@intervalfile} {@var{F} =} intervalfile (@var{FILENAME}, @var{X}, @var{ARCH})
+##
+## Create a disk-backed interval vector, which is stored in file
+## @var{FILENAME}.
+##
+## The file contains the intervals in the interchange format of
+## IEEE Std 1788-2015, see @command{interval_pack}, after a header of 16
+## octets.  @var{CLASS} is either @code{"infsup"} (default) for bare
+## intervals or @code{"infsupdec"} for decorated intervals.  @var{ARCH} is
+## the byte order of the interval boundaries and defaults to
+## @code{"ieee-le"}.  If the file does not exist, an empty file is created.
+## Otherwise, the class and byte order are read from the header of the file.
+##
+## The syntax with an interval array @var{X} creates or overwrites the file
+## and stores the elements of @var{X} in column-major order.  More intervals
+## can be added with @code{append}.
+##
+## The intervals are not loaded into memory.  Indexing @code{@var{F}(@var{I})}
+## reads the requested elements from the file and returns them as an interval
+## column vector.  The reductions @code{sum}, @code{dot}, @code{hull},
+## @code{min}, and @code{max}, as well as element-wise operations with
+## @code{chunkfun}, process the file in chunks of constant size, such that
+## data, which is larger than the available memory, can be processed.
+##
+## @example
+## @group
+## f = intervalfile (tempname (), infsup (1 : 3));
+## sum (f)
+##   @result{} ans = [6]
+## f(2)
+##   @result{} ans = [2]
+## @end group
+## @end example
+## @seealso{interval_pack, interval_unpack, @@intervalfile/chunkfun}
+## @end deftypeop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function F = intervalfile (filename, class_name, arch)
+
+  ## Mixed operations with intervals in memory use the methods of this class
+  superiorto ("infsup", "infsupdec");
+
+  if (nargin < 1 || nargin > 3)
+    print_usage ();
+    return
+  endif
+
+  if (not (ischar (filename)))
+    error ("interval:InvalidOperand", ...
+           "intervalfile: FILENAME must be a string");
+  endif
+  filename = make_absolute_filename (filename);
+
+  x = [];
+  if (nargin >= 2 && isa (class_name, "infsup"))
+    x = class_name;
+    class_name = class (x);
+  elseif (nargin >= 2 && not (any (strcmp (class_name, ...
+                                            {"infsup", "infsupdec"}))))
+    error ("interval:InvalidOperand", ...
+           ['intervalfile: invalid class, ' ...
+              'expected: infsup or infsupdec, ' ...
+              'was: ' class_name])
+  endif
+  if (nargin < 3)
+    arch = "ieee-le";
+  endif
+  switch (arch)
+    case {"native", "n"}
+      [~, ~, endian] = computer ();
+      if (endian == "B")
+        arch = "ieee-be";
+      else
+        arch = "ieee-le";
+      endif
+    case {"ieee-le", "l"}
+      arch = "ieee-le";
+    case {"ieee-be", "b"}
+      arch = "ieee-be";
+    otherwise
+      error ("interval:InvalidOperand", ...
+             "intervalfile: invalid byte order '%s'", arch);
+  endswitch
+
+  if (not (isa (x, "infsup")) && exist (filename, "file"))
+    ## Use existing data
+    [file_class_name, file_arch] = read_header (filename);
+    if ((nargin >= 2 && not (strcmp (class_name, file_class_name))) ...
+        || (nargin >= 3 && not (strcmp (arch, file_arch))))
+      error ("interval:InvalidOperand", ...
+             "intervalfile: file '%s' contains %s intervals in %s order", ...
+             filename, file_class_name, file_arch);
+    endif
+    F = class (struct ("filename", filename, ...
+                       "class_name", file_class_name, ...
+                       "arch", file_arch), ...
+               "intervalfile");
+    return
+  endif
+
+  if (nargin < 2)
+    class_name = "infsup";
+  endif
+  F = class (struct ("filename", filename, ...
+                     "class_name", class_name, ...
+                     "arch", arch), ...
+             "intervalfile");
+
+  fid = fopen (F.filename, "w");
+  if (fid < 0)
+    error ("interval:InvalidOperand", ...
+           "intervalfile: unable to create file '%s'", F.filename);
+  endif
+  unwind_protect
+    fwrite (fid, header (F));
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+  F = append (F, x);
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file);
+%!   assert (numel (f), 0);
+%!   f = append (f, infsup (1 : 3));
+%!   assert (numel (f), 3);
+%!   assert (isequal (f(:), infsup ([1; 2; 3])));
+%!   assert (isequal (intervalfile (file)(2), infsup (2)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   x = infsupdec ([1, 2; 3, 4], [5, inf; 6, 7]);
+%!   x(2) = empty ();
+%!   f = intervalfile (file, x, "ieee-be");
+%!   assert (size (f), [4, 1]);
+%!   assert (isequal (f(:), x(:)));
+%!   assert (isequal (f(end : -1 : 3), x([4; 3])));
+%!   assert (isequal (intervalfile (file, "infsupdec", "ieee-be")(:), x(:)));
+%!   ## Class and byte order are stored in the file
+%!   assert (isequal (intervalfile (file)(:), x(:)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!error intervalfile (tempname (), "double")
+%!error intervalfile (tempname (), "infsup", "middle-endian")
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   intervalfile (file, infsup (1 : 3));
+%!   fail ("intervalfile (file, 'infsupdec')", "contains infsup intervals");
+%!   fid = fopen (file, "a");
+%!   fwrite (fid, uint8 (42));
+%!   fclose (fid);
+%!   fail ("intervalfile (file)", "does not match its intervals");
+%!   fid = fopen (file, "w");
+%!   fwrite (fid, zeros (1, 32, "uint8"));
+%!   fclose (fid);
+%!   fail ("intervalfile (file)", "is no interval file");
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
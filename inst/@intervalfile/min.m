@@ -0,0 +1,51 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} min (@var{F})
+##
+## Minimum of all intervals in the file of @var{F}.
+##
+## The file is processed chunk by chunk with @code{@@infsup/min}.
+##
+## Accuracy: The result is a tight enclosure.
+##
+## @seealso{@@infsup/min}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = min (F)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = reduce_chunks (F, @(x) min (x, [], 1));
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, infsup ([1, 3], [2, 4]));
+%!   assert (isequal (min (f), infsup ("[1, 2]")));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
@@ -0,0 +1,48 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} numel (@var{F})
+##
+## Return the number of intervals in the file of @var{F}.
+##
+## @seealso{@@intervalfile/size}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = numel (F, varargin)
+
+  if (not (isa (F, "intervalfile")))
+    error ("invalid use of intervalfile as indexing parameter to numel ()")
+  endif
+
+  if (not (isempty (varargin)))
+    ## Indexing produces a single interval vector (see bug #53375)
+    result = 1;
+    return
+  endif
+
+  info = stat (F.filename);
+  if (isempty (info))
+    error ("interval:InvalidOperand", ...
+           "intervalfile: file '%s' does not exist", F.filename);
+  endif
+  result = floor ((info.size - numel (header (F))) / octets (F));
+
+endfunction
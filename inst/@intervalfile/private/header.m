@@ -0,0 +1,37 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{H} =} header (@var{F})
+##
+## Return the header of the file of @var{F} as a row vector of octets.
+##
+## The header consists of the signature @code{"intervalfile"}, the format
+## version 1, the class (0 for @code{"infsup"}, 1 for @code{"infsupdec"}),
+## the byte order (@code{"l"} or @code{"b"}), and a reserved zero octet.  Its
+## length of 16 octets keeps the interval boundaries aligned.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function h = header (F)
+
+  h = uint8 (["intervalfile", 1, strcmp(F.class_name, "infsupdec"), ...
+              F.arch(6), 0]);
+
+endfunction
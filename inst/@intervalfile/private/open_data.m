@@ -0,0 +1,39 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{FID} =} open_data (@var{F}, @var{MODE})
+##
+## Open the file of @var{F} with fopen mode @var{MODE}.  Files, which are
+## opened for reading, are positioned at the first interval after the header.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function fid = open_data (F, mode)
+
+  fid = fopen (F.filename, mode);
+  if (fid < 0)
+    error ("interval:InvalidOperand", ...
+           "intervalfile: unable to open file '%s'", F.filename);
+  endif
+  if (strcmp (mode, "r"))
+    fseek (fid, numel (header (F)), SEEK_SET);
+  endif
+
+endfunction
@@ -0,0 +1,39 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{X} =} read_chunk (@var{F}, @var{FID})
+## @deftypefunx {@var{X} =} read_chunk (@var{F}, @var{FID}, @var{N})
+##
+## Read the next @var{N} intervals (at most one chunk by default) from the
+## open file @var{FID} of @var{F}.  The result is an interval column vector,
+## which is empty at the end of the file.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function x = read_chunk (F, fid, n)
+
+  if (nargin < 3)
+    n = chunksize ();
+  endif
+
+  b = fread (fid, n * octets (F), "*uint8");
+  x = interval_unpack (b, F.class_name, F.arch);
+
+endfunction
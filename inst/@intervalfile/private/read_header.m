@@ -0,0 +1,67 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {[@var{CLASS}, @var{ARCH}] =} read_header (@var{FILENAME})
+##
+## Read the class and byte order of the intervals in file @var{FILENAME}
+## from its header, see @code{header}.
+##
+## An error is raised if the file has no valid header or if its size is no
+## multiple of the interval size.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [class_name, arch] = read_header (filename)
+
+  fid = fopen (filename, "r");
+  if (fid < 0)
+    error ("interval:InvalidOperand", ...
+           "intervalfile: unable to open file '%s'", filename);
+  endif
+  unwind_protect
+    h = fread (fid, 16, "*uint8")';
+    fseek (fid, 0, SEEK_END);
+    bytes = ftell (fid);
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+  if (numel (h) == 16 && h(15) == "b")
+    arch = "ieee-be";
+  else
+    arch = "ieee-le";
+  endif
+  if (numel (h) == 16 && h(14) == 1)
+    class_name = "infsupdec";
+  else
+    class_name = "infsup";
+  endif
+  F = struct ("class_name", class_name, "arch", arch);
+  if (not (isequal (h, header (F))))
+    error ("interval:InvalidOperand", ...
+           "intervalfile: file '%s' is no interval file", filename);
+  endif
+  if (mod (bytes - numel (h), octets (F)) ~= 0)
+    error ("interval:InvalidOperand", ...
+           "intervalfile: size of file '%s' does not match its intervals", ...
+           filename);
+  endif
+
+endfunction
@@ -0,0 +1,45 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{R} =} reduce_chunks (@var{F}, @var{FUN})
+##
+## Reduce all intervals of @var{F} with @var{FUN} chunk by chunk.
+##
+## @var{FUN} must reduce an interval column vector to a single interval.  The
+## partial result of the previous chunks is prepended to each chunk, such
+## that it is considered in the next call of @var{FUN}.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = reduce_chunks (F, fun)
+
+  fid = open_data (F, "r");
+  unwind_protect
+    result = fun (read_chunk (F, fid));
+    chunk = read_chunk (F, fid);
+    while (numel (chunk) > 0)
+      result = fun ([result; chunk]);
+      chunk = read_chunk (F, fid);
+    endwhile
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+
+endfunction
@@ -0,0 +1,56 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} size (@var{F})
+## @defmethodx {@@intervalfile} size (@var{F}, @var{DIM})
+##
+## Return the size of the interval column vector in the file of @var{F}.
+##
+## @seealso{@@intervalfile/numel}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function varargout = size (F, dim)
+
+  if (nargin == 0 || nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  s = [numel(F), 1];
+  if (nargin == 1)
+    if (nargout <= 1)
+      varargout{1} = s;
+    else
+      varargout = num2cell ([s, ones(1, nargout - 2)]);
+    endif
+  else
+    if (nargout > 1)
+      print_usage ();
+      return
+    endif
+    if (dim <= 2)
+      varargout{1} = s(dim);
+    else
+      varargout{1} = 1;
+    endif
+  endif
+
+endfunction
@@ -0,0 +1,134 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervalfile} subsref (@var{F}, @var{IDX})
+## @defopx Operator {@@intervalfile} {@var{F}(@var{I})}
+##
+## Read selected elements from the interval vector in the file of @var{F}.
+##
+## The result is an interval column vector.  Only the part of the file
+## between the first and the last selected element is read, chunk by chunk.
+##
+## @example
+## @group
+## f = intervalfile (tempname (), infsup (1 : 10));
+## f([2, end])
+##   @result{} ans = 2×1 interval vector
+##
+##        [2]
+##       [10]
+##
+## @end group
+## @end example
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function varargout = subsref (F, S)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  switch S(1).type
+    case "()"
+      idx = S(1).subs;
+      n = numel (F);
+      if (numel (idx) > 2 || ...
+          (numel (idx) == 2 && not (isequal (idx{2}, 1) || ...
+                                    isequal (idx{2}, ":"))))
+        error ("intervalfile: only vector indexing is supported");
+      endif
+      i = idx{1};
+      if (ischar (i) && strcmp (i, ":"))
+        i = (1 : n)';
+      elseif (islogical (i))
+        i = find (i(:));
+      else
+        i = i(:);
+      endif
+      if (any (i < 1 | i > n | fix (i) ~= i))
+        error ("intervalfile: index out of bound; value out of bound %d", n);
+      endif
+      result = read_elements (F, i);
+    case "{}"
+      error ("intervalfile cannot be indexed with {}")
+    otherwise
+      error ("invalid subscript type")
+  endswitch
+
+  if (numel (S) > 1)
+    result = subsref (result, S(2 : end));
+  endif
+
+  varargout = {result};
+
+endfunction
+
+function result = read_elements (F, i)
+
+  result = interval_unpack (zeros (0, 1, "uint8"), F.class_name, F.arch);
+  if (isempty (i))
+    return
+  endif
+
+  ## Read the elements in ascending order
+  [i, order] = sort (i);
+  parts = {result};
+  fid = open_data (F, "r");
+  unwind_protect
+    fseek (fid, (i(1) - 1) * octets (F), SEEK_CUR);
+    for offset = i(1) : chunksize () : i(end)
+      n = min (chunksize (), i(end) - offset + 1);
+      chunk = read_chunk (F, fid, n);
+      selected = (i >= offset & i < offset + n);
+      parts{end + 1} = chunk(i(selected) - offset + 1);
+    endfor
+  unwind_protect_cleanup
+    fclose (fid);
+  end_unwind_protect
+  result = vertcat (parts{:});
+
+  ## Restore the original order
+  inverse_order(order) = 1 : numel (order);
+  result = result(inverse_order);
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, infsup (1 : 10, 2 : 11));
+%!   assert (isequal (f([3; 1; 3]), infsup ([3; 1; 3], [4; 2; 4])));
+%!   assert (isequal (f(end), infsup (10, 11)));
+%!   assert (isequal (f(logical ([1, 0, 1])), infsup ([1; 3], [2; 4])));
+%!   assert (numel (f([])), 0);
+%!   assert (f(2:3).inf, [2; 3]);
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+%!error <out of bound>
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, infsup (1 : 3));
+%!   f(4);
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
@@ -0,0 +1,65 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervalfile} sum (@var{F})
+##
+## Sum of all intervals in the file of @var{F}.
+##
+## The file is processed chunk by chunk with @code{@@infsup/sum}, where the
+## partial sum of the previous chunks is included in the next chunk.
+##
+## Accuracy: The result is an accurate enclosure, which is rounded at most
+## once per chunk.  For files with less than 1048576 intervals the result is
+## tight.
+##
+## @seealso{@@infsup/sum}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = sum (F)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = reduce_chunks (F, @(x) sum (x, 1));
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, infsup ([1, pow2(-1074), -1]));
+%!   assert (isequal (sum (f), infsup (pow2 (-1074))));
+%!   f = intervalfile (file, "infsup");
+%!   assert (isequal (sum (f), infsup (0)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! file = tempname ();
+%! unwind_protect
+%!   f = intervalfile (file, infsupdec (ones (1, 1048576 + 3)));
+%!   assert (isequal (sum (f), infsupdec (1048579)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
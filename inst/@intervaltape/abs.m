@@ -0,0 +1,42 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervaltape} abs (@var{X})
+##
+## Record the absolute value of each element of @var{X} in the expression
+## graph.
+## @seealso{@@infsup/abs, @@intervaltape/evaluate}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = abs (x)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  result = unary ("abs", x);
+
+endfunction
+
+%!test
+%! x = infsup ([-2, -1, 0, 1], [-1, 1, 0, 2]);
+%! assert (isequal (evaluate (abs (intervaltape (x))), abs (x)));
@@ -0,0 +1,186 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypemethod {@@intervaltape} {[@var{FVAL}, @var{CX1}, @dots{}, @var{CXN}] =} contract (@var{T}, @var{Y}, @var{X1}, @dots{}, @var{XN})
+## @deftypemethodx {@@intervaltape} {[@var{FVAL}, @var{CX}] =} contract (@var{T}, @var{Y}, @var{X})
+##
+## Contract the domain of the traced function @var{T} to the solutions of
+## @code{@var{T} (@var{x}) ∈ @var{Y}}.
+##
+## The result @var{CXk} is a subset of the k-th variable @var{Xk}, which
+## contains all solutions in @var{X1} × … × @var{XN}.  The variables are
+## bound like with @code{@@intervaltape/evaluate}, several values for each
+## variable contract a batch of boxes at once.  @var{FVAL} is the function
+## value over the contracted box, which is a subset of the function value
+## over the original box.  Boxes without solutions are contracted to
+## empty intervals.  @var{Y} is either scalar or has the size of @var{T}.
+##
+## The contractor is HC4Revise, which takes a single forward-backward pass
+## over the expression graph in compiled code: the function value is
+## evaluated, intersected with @var{Y}, and propagated back to the
+## variables with the reverse operation of each node, e.g., @code{mulrev}
+## or @code{sinrev}.  Repeated application may contract the box further.
+##
+## The syntax and results are compatible with contractors for @code{fsolve}
+## with option @option{Contract}.  The inputs of the traced function must
+## be scalar.
+##
+## @example
+## @group
+## f = intervaltape (@@(x, y) x .^ 2 + y .^ 2, 1, 1);
+## [~, cx, cy] = contract (f, 4, infsup (1, 3), infsup (-3, 3))
+##   @result{}
+##     cx = [1, 2]
+##     cy ⊂ [-1.7321, +1.7321]
+## @end group
+## @end example
+## @seealso{@@infsup/fsolve, @@intervaltape/evaluate, ctc_intersect}
+## @end deftypemethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [fval, varargout] = contract (T, y, varargin)
+
+  if (nargin < 2)
+    print_usage ();
+    return
+  endif
+
+  if (T.variables == 0)
+    error ("interval:InvalidOperand", ...
+           "contract: expression T has no free variables");
+  endif
+  if (isa (y, "infsupdec"))
+    error ("interval:InvalidOperand", ...
+           "intervaltape: decorated intervals are not supported");
+  elseif (not (isa (y, "infsup")))
+    y = infsup (y);
+  endif
+
+  point = T.variables > 1 && numel (varargin) == 1 ...
+          && numel (varargin{1}) == T.variables;
+  if (point)
+    ## A single box, whose coordinates are the variables
+    x = varargin{1};
+    if (not (isa (x, "infsup")))
+      x = infsup (x);
+    endif
+    varargin = cell (1, T.variables);
+    for k = 1 : T.variables
+      varargin{k} = x(k);
+    endfor
+  endif
+  if (numel (varargin) ~= T.variables)
+    error ("interval:InvalidOperand", ...
+           "intervaltape: expected values of %d variables, got %d", ...
+           T.variables, numel (varargin));
+  endif
+
+  ## Size of the batch after broadcasting
+  shape = [1, 1];
+  for k = 1 : T.variables
+    v = varargin{k};
+    if (isa (v, "infsupdec"))
+      error ("interval:InvalidOperand", ...
+             "intervaltape: decorated intervals are not supported");
+    elseif (not (isa (v, "infsup")))
+      varargin{k} = v = infsup (v);
+    endif
+    if (numel (v) == 1 || isequal (size (v), shape))
+      continue
+    endif
+    v_shape = size (v);
+    v_shape(end + 1 : numel (shape)) = 1;
+    shape(end + 1 : numel (v_shape)) = 1;
+    if (any (shape ~= v_shape & shape ~= 1 & v_shape ~= 1))
+      error ("interval:InvalidOperand", ...
+             "intervaltape: nonconformant arguments");
+    endif
+    shape(shape == 1) = v_shape(shape == 1);
+  endfor
+
+  ## One box per column
+  xl = xu = zeros (T.variables, prod (shape));
+  for k = 1 : T.variables
+    xl(k, :) = (ones (shape) .* inf (varargin{k}))(:);
+    xu(k, :) = (ones (shape) .* sup (varargin{k}))(:);
+  endfor
+
+  n = numel (T.op);
+  l = u = cell (n, 1);
+  for k = find (strcmp (T.op, "input"))'
+    l{k} = inf (T.value{k});
+    u{k} = sup (T.value{k});
+  endfor
+
+  [xl, xu, fl, fu] = __hc4__ (T.op, T.arg, T.param, l, u, T.root(:), ...
+                              xl, xu, inf (y)(:), sup (y)(:));
+
+  if (numel (T.root) == 1)
+    fval = reshape (__infsup__ (fl, fu), shape);
+  elseif (prod (shape) == 1)
+    fval = reshape (__infsup__ (fl, fu), size (T.root));
+  else
+    ## One column per element of the batch
+    fval = __infsup__ (fl, fu);
+  endif
+
+  if (point)
+    varargout{1} = reshape (__infsup__ (xl, xu), size (x));
+  else
+    for k = 1 : max (0, nargout - 1)
+      varargout{k} = reshape (__infsup__ (xl(k, :), xu(k, :)), shape);
+    endfor
+  endif
+
+endfunction
+
+%!# from the documentation string
+%!test
+%! f = intervaltape (@(x, y) x .^ 2 + y .^ 2, 1, 1);
+%! [fval, cx, cy] = contract (f, 4, infsup (1, 3), infsup (-3, 3));
+%! assert (isequal (cx, infsup (1, 2)));
+%! assert (isequal (cy, sqrt (infsup (3)) .* infsup (-1, 1)));
+%! assert (isequal (fval, sqr (cx) + sqr (cy)));
+
+%!test
+%! ## Batch of boxes, the second box contains no solution
+%! f = intervaltape (@(x) exp (x), 1);
+%! [fval, cx] = contract (f, infsup (1, 2), infsup ([-1, 1], [1, 2]));
+%! assert (size (cx), [1, 2]);
+%! assert (isequal (cx(1), intersect (infsup (-1, 1), log (infsup (1, 2)))));
+%! assert (isempty (cx(2)));
+%! assert (isempty (fval(2)));
+%!test
+%! ## System of equations and a single box
+%! f = intervaltape (@(x) [x(1) + x(2); x(1) - x(2)], 2);
+%! [fval, cx] = contract (f, [2; 0], infsup ([0; 0], [1.5; 3]));
+%! assert (size (cx), [2, 1]);
+%! assert (isequal (cx, infsup ([0.5; 0.5], [1.5; 1.5])));
+%! assert (isequal (fval, infsup ([1; -1], [3; 1])));
+%!test
+%! ## Compatible with fsolve contractors
+%! f = intervaltape (@(x) x .^ 2, 1);
+%! ctc = @(y, x) contract (f, y, x);
+%! x = fsolve (ctc, infsup (-3, 3), 2, struct ("Contract", true));
+%! assert (subset (sqrt (infsup (2)) .* infsup (-1, 1), x));
+%! assert (sup (x) < 1.5);
+%!error contract (intervaltape (infsup (1)), 0)
+%!error contract (intervaltape (@(x) x, 1), 0, 1, 2)
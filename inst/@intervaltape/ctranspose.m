@@ -0,0 +1,43 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} ctranspose (@var{T})
+## @defopx Operator {@@intervaltape} {@var{T}'}
+##
+## Return the complex conjugate transpose of the array of expressions
+## @var{T}.
+##
+## Since intervals are real, this is equivalent to @code{transpose}.
+##
+## @seealso{@@intervaltape/transpose}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function T = ctranspose (T)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  T.root = transpose (T.root);
+
+endfunction
+
+%!assert (size (intervaltape (@(x) x, [2, 3])'), [3, 2]);
@@ -0,0 +1,54 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervaltape} display (@var{T})
+##
+## Display the variable name and the number of nodes in the expression graph
+## of @var{T}.
+##
+## The expression is not evaluated.
+##
+## @example
+## @group
+## x = intervaltape (infsup (2, 3));
+## y = x .^ 2 - 2 * x
+##   @result{} y = deferred interval expression with 5 nodes
+## @end group
+## @end example
+## @seealso{@@intervaltape/evaluate}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function display (T)
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  label = inputname (1);
+  if (isempty (label))
+    label = "ans";
+  endif
+
+  printf ("%s = deferred interval expression with %d nodes\n", ...
+          label, numel (T.op));
+
+endfunction
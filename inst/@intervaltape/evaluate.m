@@ -0,0 +1,104 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervaltape} evaluate (@var{T})
+## @defmethodx {@@intervaltape} evaluate (@var{T}, @var{V1}, @dots{}, @var{VN})
+## @defmethodx {@@intervaltape} evaluate (@var{T}, @var{X})
+##
+## Evaluate the deferred interval expression @var{T}.
+##
+## The whole expression is evaluated in a single pass over the elements of
+## the inputs.  For each element, all intermediate results are computed with
+## correctly rounded functions, such that the result is equal to the result
+## of immediate evaluation with the corresponding interval functions.
+## Inputs of different size are broadcasted.
+##
+## If @var{T} is a traced function with N free variables, see
+## @code{intervaltape (@var{F}, @dots{})}, the interval array @var{Vk}
+## contains the values of the k-th variable.  Several values for each
+## variable evaluate the function for a batch of arguments at once.  The
+## syntax with a single interval array @var{X} with N elements evaluates the
+## function for @code{@var{V1} = @var{X}(1)}, @dots{},
+## @code{@var{VN} = @var{X}(N)}.
+##
+## The result has the size of the expression @var{T} for a single value of
+## each variable and the size of the batch for a scalar expression.
+## Otherwise, each column of the result contains the values of the
+## expression for one element of the batch.
+##
+## @example
+## @group
+## x = intervaltape (infsup (2, 3));
+## evaluate (x .^ 2 - 2 * x)
+##   @result{} ans = [-2, 5]
+##
+## f = intervaltape (@@(x, y) x .* y + 1, 1, 1);
+## evaluate (f, infsup ([1, 2, 3]), infsup (2))
+##   @result{} ans = 1×3 interval vector
+##
+##        [3]   [5]   [7]
+##
+## @end group
+## @end example
+## @seealso{@@intervaltape/intervaltape, @@intervaltape/jacobian}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = evaluate (T, varargin)
+
+  if (nargin < 1)
+    print_usage ();
+    return
+  endif
+
+  [op, l, u, shape] = bind_variables (T, varargin);
+
+  [l, u] = __eval_tape__ (op, T.arg, T.param, l, u, T.root);
+
+  result = root_values (T, l, u, shape);
+
+endfunction
+
+%!# from the documentation string
+%!assert (isequal (evaluate (intervaltape (infsup (2, 3)) .^ 2 - 2 * intervaltape (infsup (2, 3))), infsup (-2, 5)));
+
+%!test
+%! x = infsup (1 : 3);
+%! y = intervaltape (x);
+%! assert (isequal (evaluate (exp (y) .* sin (y) + y .^ 2), exp (x) .* sin (x) + x .^ 2));
+%!test
+%! x = infsup ([-1, 0, 2], [1, 0, 3]);
+%! y = evaluate (log (intervaltape (x)));
+%! assert (isequal (y, log (x)));
+%! assert (isempty (y(2)));
+%!test
+%! x = intervaltape (infsup ([1; 2]));
+%! y = intervaltape (infsup ([3, 4, 5]));
+%! assert (isequal (evaluate (x + y), infsup ([4, 5, 6; 5, 6, 7])));
+%!error evaluate (intervaltape (infsup ([1, 2])) + intervaltape (infsup ([1, 2, 3])))
+%!test
+%! f = intervaltape (@(x, y) x .* y + 1, 1, 1);
+%! assert (isequal (evaluate (f, infsup ([1, 2, 3]), infsup (2)), infsup ([3, 5, 7])));
+%! assert (isequal (evaluate (f, infsup ([2; 3])), infsup (7)));
+%!test
+%! f = intervaltape (@(x) [x(1) + x(2); x(1) .* x(2)], 2);
+%! assert (isequal (evaluate (f, infsup ([1; 2])), infsup ([3; 2])));
+%! assert (isequal (evaluate (f, infsup ([1, 2]), infsup ([3, 4])), infsup ([4, 6; 3, 8])));
+%!error evaluate (intervaltape (@(x, y) x + y, 1, 1), infsup (1))
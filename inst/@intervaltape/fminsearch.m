@@ -0,0 +1,166 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypemethod {@@intervaltape} {@var{X} =} fminsearch (@var{T}, @var{X0})
+## @deftypemethodx {@@intervaltape} {@var{X} =} fminsearch (@var{T}, @var{X0}, @var{OPTIONS})
+## @deftypemethodx {@@intervaltape} {[@var{X}, @var{FVAL}, @var{ITER}] =} fminsearch (@dots{})
+##
+## Minimize the traced function @var{T} over the interval box @var{X0} and
+## return rigorous bounds.
+##
+## @var{T} must be a scalar expression, which has been traced with
+## @code{intervaltape (@var{F}, size (@var{X0}))}, and whose constant inputs
+## are scalar.  The algorithm is the same as with
+## @code{fminsearch (@var{F}, @var{X0}, @var{OPTIONS})} for bare intervals,
+## but the whole search runs in a compiled function: Candidate boxes are
+## kept in a priority queue, which is ordered by the lower bound of their
+## function value, and the function values of both halves of a bisected box
+## and their midpoints are evaluated at once.
+##
+## The gradient of the function is computed together with the function
+## values by automatic differentiation, see @code{@@intervaltape/jacobian}.
+## The function values of the boxes are improved with the mean value form.
+## Boxes, where the function is strictly monotone in some coordinate, cannot
+## contain a minimum in the interior of @var{X0}.  Such boxes are discarded
+## or reduced to the face of @var{X0}.  This reduces the number of boxes
+## considerably for smooth functions.
+##
+## It is possible to use the following optimization @var{options}:
+## @option{Display}, @option{MaxFunEvals}, @option{MaxIter},
+## @option{TolFun}, @option{TolX}.  Option @option{Display} =
+## @code{"iter"} displays only the final result.
+##
+## @example
+## @group
+## t = intervaltape (@@(x) (x(1) - 1) .^ 2 + x(2) .^ 2, 2);
+## [~, fval] = fminsearch (t, infsup ([-3; -3], [3; 3]));
+## subset (0, fval)
+##   @result{} ans = 1
+## @end group
+## @end example
+## @seealso{@@infsup/fminsearch, @@intervaltape/jacobian}
+## @end deftypemethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [X, FVAL, iter] = fminsearch (T, X0, options)
+
+  if (nargin < 2)
+    print_usage ();
+    return
+  endif
+
+  if (not (isa (T, "intervaltape")))
+    error ("interval:InvalidOperand", ...
+           "fminsearch: Parameter T is no interval expression")
+  elseif (isa (X0, "infsupdec"))
+    error ("interval:InvalidOperand", ...
+           "fminsearch: decorated intervals are not supported");
+  elseif (not (isa (X0, "infsup")))
+    error ("interval:InvalidOperand", ...
+           "fminsearch: Parameter X0 is no interval")
+  elseif (numel (T.root) ~= 1)
+    error ("interval:InvalidOperand", ...
+           "fminsearch: Expression T is not scalar")
+  elseif (T.variables ~= numel (X0))
+    error ("interval:InvalidOperand", ...
+           "fminsearch: Expression T has %d variables, X0 has %d elements", ...
+           T.variables, numel (X0))
+  endif
+
+  defaultoptions = optimset (optimset, 'TolFun', 1e-4);
+  if (nargin < 3)
+    options = defaultoptions;
+  else
+    options = optimset (defaultoptions, options);
+  endif
+  if (not (isempty (options.OutputFcn)))
+    error ("interval:InvalidOperand", ...
+           "fminsearch: Option OutputFcn is not supported")
+  endif
+
+  n = numel (T.op);
+  l = u = cell (n, 1);
+  for k = find (strcmp (T.op, "input"))'
+    l{k} = inf (T.value{k});
+    u{k} = sup (T.value{k});
+  endfor
+
+  [xl, xu, fl, fu, f_ub, iter, cancel_algorithm] = ...
+    __fminsearch__ (T.op, T.arg, T.param, l, u, T.root, ...
+                    inf (X0)(:), sup (X0)(:), ...
+                    option_value (options.TolFun, -inf), ...
+                    option_value (options.TolX, -inf), ...
+                    option_value (options.MaxIter, inf), ...
+                    option_value (options.MaxFunEvals, inf));
+
+  X = reshape (infsup (xl, xu), size (X0));
+  if (fl > fu)
+    FVAL = infsup ();
+  else
+    FVAL = infsup (fl, fu);
+  endif
+  if (isfinite (f_ub))
+    FVAL = intersect (FVAL, infsup (-inf, f_ub));
+  endif
+
+  if (any (strcmp (options.Display, {"iter", "final"})) || ...
+      (cancel_algorithm && strcmp (options.Display, "notify")))
+    printf ('\nTarget accuracy has%s been reached after %d step(s)\n', ...
+            ' not'(1:end * cancel_algorithm), ...
+            iter);
+    display (X);
+    display (FVAL);
+  endif
+
+endfunction
+
+function value = option_value (value, default)
+  if (isempty (value))
+    value = default;
+  endif
+endfunction
+
+%!# from the documentation string
+%!test
+%! t = intervaltape (@(x) (x(1) - 1) .^ 2 + x(2) .^ 2, 2);
+%! [~, fval] = fminsearch (t, infsup ([-3; -3], [3; 3]));
+%! assert (subset (0, fval));
+
+%!test
+%! f = @(x) (x(1) - 2) .^ 2 - x(2) .^ 2;
+%! x0 = infsup ([1, 0], [3, 1]);
+%! [x, fval, iter] = fminsearch (intervaltape (f, [1, 2]), x0);
+%! ## The m-file implementation is used with an OutputFcn
+%! [x_ref, fval_ref, iter_ref] = fminsearch (f, x0, ...
+%!                                           optimset ('OutputFcn', @(x) []));
+%! assert (subset (-1, fval));
+%! assert (subset (-1, fval_ref));
+%! assert (inf (fval) > -1 - 1e-4);
+%! assert (subset (x, infsup ([1.5, 0.5], [2.5, 1])));
+%! assert (iter <= iter_ref);
+%!test
+%! ## Monotone in both coordinates
+%! [x, fval, iter] = fminsearch (intervaltape (@(x) exp (x(1)) - x(2), 2), ...
+%!                               infsup ([0; -1], [1; 2]));
+%! assert (isequal (x, infsup ([0; 2])));
+%! assert (subset (-1, fval));
+%! assert (iter < 10);
+%!error fminsearch (intervaltape (@(x) x, 2), infsup ([1; 2]))
+%!error fminsearch (intervaltape (@(x) x(1), 2), infsup (1))
+%!error <fminsearch: decorated intervals are not supported> fminsearch (intervaltape (@(x) x(1), 2), infsupdec ([1; 2]))
@@ -0,0 +1,42 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} horzcat (@var{ARRAY1}, @var{ARRAY2}, @dots{})
+## @defopx Operator {@@intervaltape} {[@var{ARRAY1}, @var{ARRAY2}, @dots{}]}
+##
+## Return the horizontal concatenation of arrays of expressions along
+## dimension 2.
+##
+## The expression graphs of the arguments are merged.  Other arguments are
+## converted to bare intervals.
+##
+## @seealso{@@intervaltape/vertcat}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = horzcat (varargin)
+
+  result = concatenate (2, varargin{:});
+
+endfunction
+
+%!test
+%! f = intervaltape (@(x) [x(2), x(1), infsup([2, 3])], 2);
+%! assert (size (f), [1, 4]);
+%! assert (isequal (evaluate (f, infsup ([0; 1])), infsup ([1, 0, 2, 3])));
@@ -0,0 +1,182 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypeop Constructor {@@intervaltape} {@var{T} =} intervaltape (@var{X})
+## @deftypeopx Constructor {@@intervaltape} {@var{T} =} intervaltape (@var{F}, @var{SZ1}, @dots{})
+##
+## Create a deferred interval expression from the bare interval array
+## @var{X}.
+##
+## Interval arithmetic on @var{T} does not compute any intervals, but records
+## the operations in an expression graph.  Subexpressions, which occur
+## several times, are recorded only once.  @code{evaluate (@var{T})} computes
+## the result of the whole expression in a single pass over the elements,
+## without intermediate interval arrays.  The result is the same as with
+## immediate evaluation of the operations on @var{X}.
+##
+## Supported operations are @code{+}, @code{-}, @code{.*}, @code{./},
+## @code{.^} with integral exponent, the matrix operators for scalar
+## operands, and the functions @code{abs}, @code{cos}, @code{exp},
+## @code{log}, @code{realsqrt}, @code{sin}, @code{sqr}, and @code{sqrt}.
+## Other operands are converted to bare intervals.  All operations are
+## evaluated element-wise with broadcasting.
+##
+## The syntax with a function handle @var{F} traces the function: @var{F}
+## is called once with N symbolic arguments of size @var{SZ1}, @dots{},
+## @var{SZN} (default: a single scalar argument).  The result is the
+## expression graph of the function's value, which can be evaluated many
+## times and for many argument values at once with
+## @code{evaluate (@var{T}, @dots{})}.  An error is raised if @var{F} uses
+## operations, which cannot be recorded, e.g., comparisons of its
+## arguments.
+##
+## @example
+## @group
+## x = intervaltape (infsup (1 : 3));
+## y = exp (x) .* sin (x) + x .^ 2;
+## evaluate (y)
+##   @result{} ans ⊂ 1×3 interval vector
+##
+##        [3.2873, 3.2874]   [10.718, 10.719]   [11.834, 11.835]
+##
+##
+## f = @@(x) x(1) .^ 2 + x(1) .* x(2);
+## t = intervaltape (f, 2);
+## evaluate (t, infsup ([1; 2]))
+##   @result{} ans = [3]
+## @end group
+## @end example
+## @seealso{@@intervaltape/evaluate}
+## @end deftypeop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function T = intervaltape (x, varargin)
+
+  ## Mixed operations with intervals use the methods of this class
+  superiorto ("infsup", "infsupdec");
+
+  ## Input arrays must never share keys, the constructor is locked in memory,
+  ## such that clearing functions does not reset the counter
+  persistent next_input_id = 0;
+  mlock ();
+
+  if (nargin < 1)
+    print_usage ();
+    return
+  endif
+
+  if (is_function_handle (x))
+    ## Trace the function on symbolic arguments, each element of the
+    ## arguments is a free variable
+    if (isempty (varargin))
+      varargin = {1};
+    endif
+    args = cell (size (varargin));
+    n = 0;
+    for i = 1 : numel (varargin)
+      s = varargin{i};
+      if (isscalar (s))
+        s = [s, 1];
+      endif
+      m = prod (s);
+      variable = n + (1 : m)';
+      ## Same keys as with addnode
+      key = arrayfun (@(k) sprintf ("variable 0 0 %d", k), variable, ...
+                      "UniformOutput", false);
+      index = containers.Map ();
+      if (m > 0)
+        index = containers.Map (key, num2cell (1 : m)');
+      endif
+      args{i} = class (struct ("op", {repmat({"variable"}, m, 1)}, ...
+                               "arg", zeros (m, 2), ...
+                               "param", variable, ...
+                               "key", {key}, ...
+                               "index", {index}, ...
+                               "value", {cell(m, 1)}, ...
+                               "root", reshape (1 : m, s), ...
+                               "variables", n + m), ...
+                       "intervaltape");
+      n += m;
+    endfor
+
+    T = feval (x, args{:});
+    if (not (isa (T, "intervaltape")))
+      error ("interval:InvalidOperand", ...
+             "intervaltape: F does not compute an expression of its arguments");
+    endif
+    T.variables = n;
+    return
+  endif
+
+  if (nargin ~= 1)
+    print_usage ();
+    return
+  endif
+
+  if (isa (x, "intervaltape"))
+    T = x;
+    return
+  endif
+  if (isa (x, "infsupdec"))
+    error ("interval:InvalidOperand", ...
+           "intervaltape: decorated intervals are not supported");
+  endif
+  if (not (isa (x, "infsup")))
+    x = infsup (x);
+  endif
+
+  if (numel (x) == 1)
+    ## Equal constants share a node
+    key = ["input " num2hex(inf (x)) " " num2hex(sup (x))];
+  else
+    next_input_id ++;
+    key = sprintf ("input #%d", next_input_id);
+  endif
+
+  T = class (struct ("op", {{"input"}}, ...
+                     "arg", [0, 0], ...
+                     "param", 0, ...
+                     "key", {{key}}, ...
+                     "index", {containers.Map(key, 1)}, ...
+                     "value", {{x}}, ...
+                     "root", 1, ...
+                     "variables", 0), ...
+             "intervaltape");
+
+endfunction
+
+%!test
+%! x = intervaltape (infsup (1, 2));
+%! assert (isequal (evaluate (x), infsup (1, 2)));
+%!test
+%! x = intervaltape (infsup (1 : 3));
+%! assert (isequal (evaluate (x + 1), infsup (2 : 4)));
+%!test
+%! t = intervaltape (@(x, y) [x .* y; exp(y)], 1, 1);
+%! assert (size (t), [2, 1]);
+%! assert (isequal (evaluate (t, infsup (2), infsup (0)), infsup ([0; 1])));
+%!test
+%! x = intervaltape (infsup (1 : 2));
+%! clear intervaltape
+%! clear functions
+%! y = intervaltape (infsup (3 : 4));
+%! assert (isequal (evaluate (x + y), infsup ([4, 6])));
+%!error intervaltape (infsupdec (1))
+%!error intervaltape (@(x) mid (x))
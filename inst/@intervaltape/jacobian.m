@@ -0,0 +1,117 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervaltape} jacobian (@var{T}, @var{V1}, @dots{}, @var{VN})
+## @defmethodx {@@intervaltape} jacobian (@var{T}, @var{X})
+## @deftypemethodx {@@intervaltape} {[@var{J}, @var{Y}] =} jacobian (@dots{})
+##
+## Compute an interval enclosure of the derivatives of the traced function
+## @var{T} with respect to its N free variables.
+##
+## The variables are bound like with @code{@@intervaltape/evaluate}.  The
+## derivatives are computed in forward mode of automatic differentiation in
+## the same compiled pass as the function value @var{Y}: each intermediate
+## result carries its interval value and an interval gradient.  Thus,
+## @code{@var{J}(i, k)} contains the partial derivatives of the i-th
+## element of @var{T} with respect to the k-th variable for all values of
+## the variables.  For a batch of B values of each variable, @var{J} is an
+## R×N×B array, where R = @code{numel (@var{T})}.
+##
+## The enclosures are suitable for mean value forms, monotonicity tests,
+## and interval Newton methods.  Where a function is evaluated outside of
+## its domain, the enclosure of its derivative is unbounded.  At points
+## where @code{abs} is not differentiable, the enclosure contains the
+## generalized gradient [-1, 1].
+##
+## @example
+## @group
+## f = intervaltape (@@(x) x(1) .^ 2 .* x(2), 2);
+## jacobian (f, infsup ([1; 2], [2; 3]))
+##   @result{} ans = 1×2 interval vector
+##
+##        [4, 12]   [1, 4]
+##
+## @end group
+## @end example
+## @seealso{@@intervaltape/evaluate}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [J, Y] = jacobian (T, varargin)
+
+  if (nargin < 1)
+    print_usage ();
+    return
+  endif
+
+  if (T.variables == 0)
+    error ("interval:InvalidOperand", ...
+           "jacobian: expression T has no free variables");
+  endif
+
+  [op, l, u, shape, variable_node] = bind_variables (T, varargin);
+  wrt = find (variable_node);
+
+  [l, u, dl, du] = __eval_tape__ (op, T.arg, T.param, l, u, T.root(:), ...
+                                  variable_node(wrt));
+
+  ## Variables, which don't occur in T, have zero derivatives
+  R = numel (T.root);
+  B = prod (shape);
+  jl = ju = zeros (R, T.variables, B);
+  for k = 1 : numel (wrt)
+    jl(:, wrt(k), :) = reshape (cell2mat (cellfun (@(v) v(:)', dl(:, k), ...
+                                                   "UniformOutput", false)), ...
+                                R, 1, B);
+    ju(:, wrt(k), :) = reshape (cell2mat (cellfun (@(v) v(:)', du(:, k), ...
+                                                   "UniformOutput", false)), ...
+                                R, 1, B);
+  endfor
+  J = __infsup__ (jl, ju);
+
+  if (nargout >= 2)
+    Y = root_values (T, l, u, shape);
+  endif
+
+endfunction
+
+%!# from the documentation string
+%!test
+%! f = intervaltape (@(x) x(1) .^ 2 .* x(2), 2);
+%! assert (isequal (jacobian (f, infsup ([1; 2], [2; 3])), infsup ([4, 1], [12, 4])));
+
+%!test
+%! f = intervaltape (@(x, y) [sin(x) .* y; exp(x) ./ y; abs(y)], 1, 1);
+%! [J, Y] = jacobian (f, infsup (1), infsup (2));
+%! assert (size (J), [3, 2]);
+%! assert (isequal (Y, [sin(infsup (1)) .* 2; exp(infsup (1)) ./ 2; 2]));
+%! assert (all (subset ([2 * cos(1), sin(1); exp(1) / 2, -exp(1) / 4; 0, 1], J)(:)));
+%! assert (max (rad (J)(:)) < 8 * eps);
+%!test
+%! f = intervaltape (@(x, y) x .^ 3 + 0 * y, 1, 1);
+%! [J, Y] = jacobian (f, infsup ([1, 2], [1, 3]), infsup (0));
+%! assert (size (J), [1, 2, 2]);
+%! assert (isequal (J(1, 1, :), reshape (infsup ([3, 12], [3, 27]), 1, 1, 2)));
+%! assert (isequal (J(1, 2, :), reshape (infsup ([0, 0]), 1, 1, 2)));
+%! assert (isequal (Y, infsup ([1, 8], [1, 27])));
+%!test
+%! f = intervaltape (@(x) sqrt (x) + log (x), 1);
+%! assert (isentire (jacobian (f, infsup (-1, 1))));
+%! assert (isequal (jacobian (f, infsup (4)), infsup (0.5)));
+%!error jacobian (intervaltape (infsup (1)))
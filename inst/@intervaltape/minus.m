@@ -0,0 +1,45 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} minus (@var{X}, @var{Y})
+## @defopx Operator {@@intervaltape} {@var{X} - @var{Y}}
+##
+## Record the element-wise difference of @var{X} and @var{Y} in the expression
+## graph.
+## @seealso{@@infsup/minus, @@intervaltape/evaluate}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = minus (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  result = binary ("minus", x, y);
+
+endfunction
+
+%!test
+%! x = infsup ([-2, -1, 0, 1], [-1, 1, 0, inf]);
+%! y = infsup ([1; 2], [3; 4]);
+%! assert (isequal (evaluate (minus (intervaltape (x), y)), minus (x, y)));
+%! assert (isequal (evaluate (minus (x, intervaltape (y))), minus (x, y)));
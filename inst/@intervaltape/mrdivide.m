@@ -0,0 +1,50 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} mrdivide (@var{X}, @var{Y})
+## @defopx Operator {@@intervaltape} {@var{X} / @var{Y}}
+##
+## Record the quotient of @var{X} and @var{Y} in the expression graph.
+##
+## The divisor @var{Y} must be scalar.
+## @seealso{@@intervaltape/rdivide, @@intervaltape/evaluate}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = mrdivide (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (not (isscalar_operand (y)))
+    error ("interval:InvalidOperand", ...
+           "intervaltape: the divisor must be scalar");
+  endif
+
+  result = binary ("rdivide", x, y);
+
+endfunction
+
+%!test
+%! x = infsup (1 : 3, 2 : 4);
+%! assert (isequal (evaluate (intervaltape (x) / 3), x / 3));
+%!error infsup (1) / intervaltape (infsup (1 : 3))
@@ -0,0 +1,52 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} mtimes (@var{X}, @var{Y})
+## @defopx Operator {@@intervaltape} {@var{X} * @var{Y}}
+##
+## Record the product of @var{X} and @var{Y} in the expression graph.
+##
+## Matrix multiplication is not supported, one of the operands must be
+## scalar.
+## @seealso{@@intervaltape/times, @@intervaltape/evaluate}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = mtimes (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (not (isscalar_operand (x) || isscalar_operand (y)))
+    error ("interval:InvalidOperand", ...
+           "intervaltape: matrix multiplication is not supported");
+  endif
+
+  result = binary ("times", x, y);
+
+endfunction
+
+%!test
+%! x = infsup (1 : 3, 2 : 4);
+%! assert (isequal (evaluate (2 * intervaltape (x)), 2 * x));
+%! assert (isequal (evaluate (intervaltape (x) * infsup (-1, 1)), x * infsup (-1, 1)));
+%!error intervaltape (infsup (1 : 3)) * infsup ([1; 2; 3])
@@ -0,0 +1,45 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervaltape} numel (@var{T})
+##
+## Return the number of expressions in the array of expressions @var{T}.
+##
+## @seealso{@@intervaltape/size}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = numel (T, varargin)
+
+  if (not (isa (T, "intervaltape")))
+    error ("invalid use of intervaltape as indexing parameter to numel ()")
+  endif
+
+  if (not (isempty (varargin)))
+    ## Indexing produces a single array of expressions (see bug #53375)
+    result = 1;
+    return
+  endif
+
+  result = numel (T.root);
+
+endfunction
+
+%!assert (numel (intervaltape (infsup (1 : 3))), 1);
+%!assert (numel (intervaltape (@(x) x, [2, 3])), 6);
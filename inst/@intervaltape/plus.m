@@ -0,0 +1,59 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} plus (@var{X}, @var{Y})
+## @defopx Operator {@@intervaltape} {@var{X} + @var{Y}}
+##
+## Record the element-wise sum of @var{X} and @var{Y} in the expression
+## graph.
+## @seealso{@@infsup/plus, @@intervaltape/evaluate}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = plus (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  result = binary ("plus", x, y);
+
+endfunction
+
+%!test
+%! x = infsup ([-2, -1, 0, 1], [-1, 1, 0, inf]);
+%! y = infsup ([1; 2], [3; 4]);
+%! assert (isequal (evaluate (plus (intervaltape (x), y)), plus (x, y)));
+%! assert (isequal (evaluate (plus (x, intervaltape (y))), plus (x, y)));
+%!test
+%! x = intervaltape (infsup (1, 2));
+%! y = exp (x) + exp (x);
+%! assert (numel (struct (y).op), 3);
+%!test
+%! ## Tapes derived from the same tape record their own nodes
+%! x = intervaltape (infsup (1, 2));
+%! y = x + 1;
+%! z = x + 2;
+%! w = x + 1;
+%! assert (isequal (evaluate (y), infsup (2, 3)));
+%! assert (isequal (evaluate (z), infsup (3, 4)));
+%! assert (isequal (evaluate (w), infsup (2, 3)));
+%! assert (numel (struct (w).op), 3);
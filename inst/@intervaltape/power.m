@@ -0,0 +1,54 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} power (@var{X}, @var{Y})
+## @defopx Operator {@@intervaltape} {@var{X} .^ @var{Y}}
+##
+## Record the element-wise power of @var{X} and @var{Y} in the expression
+## graph.
+##
+## The exponent @var{Y} must be a nonzero integral number.
+## @seealso{@@infsup/power, @@intervaltape/pown, @@intervaltape/evaluate}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = power (x, y)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  ## x .^ 0 differs from pown (x, 0) for x = [0]
+  if (isa (y, "intervaltape") || not (isnumeric (y)) || y == 0)
+    error ("interval:InvalidOperand", ...
+           "intervaltape: exponent must be a nonzero integral number");
+  endif
+
+  result = pown (x, y);
+
+endfunction
+
+%!test
+%! x = infsup ([-2, -1, 0, 1, 0], [-1, 1, 0, 2, 3]);
+%! assert (isequal (evaluate (intervaltape (x) .^ 2), x .^ 2));
+%! assert (isequal (evaluate (intervaltape (x) .^ -1), x .^ -1));
+%!error intervaltape (infsup (1)) .^ 0
+%!error 2 .^ intervaltape (infsup (1))
@@ -0,0 +1,50 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defmethod {@@intervaltape} pown (@var{X}, @var{P})
+##
+## Record the monomial @code{x^@var{P}} of each element of @var{X} in the
+## expression graph.  @var{P} must be an integral number.
+## @seealso{@@infsup/pown, @@intervaltape/evaluate}
+## @end defmethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = pown (x, p)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  if (not (isnumeric (p) && isscalar (p) && fix (p) == p && isfinite (p)))
+    error ("interval:InvalidOperand", ...
+           "intervaltape: exponent must be an integral number");
+  endif
+
+  result = unary ("pown", x, double (p));
+
+endfunction
+
+%!test
+%! x = infsup ([-2, -1, 0, 1, 0], [-1, 1, 0, 2, 3]);
+%! for p = -3 : 3
+%!   assert (isequal (evaluate (pown (intervaltape (x), p)), pown (x, p)));
+%! endfor
+%!error pown (intervaltape (infsup (1)), 0.5)
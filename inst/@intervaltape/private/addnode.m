@@ -0,0 +1,61 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {[@var{T}, @var{IDX}] =} addnode (@var{T}, @var{OP}, @var{ARG}, @var{PARAM})
+## @deftypefunx {[@var{T}, @var{IDX}] =} addnode (@var{T}, "input", [0, 0], 0, @var{VALUE}, @var{KEY})
+##
+## Append a node to the expression graph of @var{T}, unless an equal node
+## exists.  @var{IDX} is the index of the node.
+##
+## Nodes are equal if they have equal keys.  The key of an operation is
+## built from @var{OP}, the argument nodes @var{ARG}, and the integer
+## parameter @var{PARAM}.  Input nodes carry their own @var{KEY}.  Existing
+## nodes are looked up in a @code{containers.Map} of the keys, such that
+## recording a tape takes linear time in the number of nodes.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [T, idx] = addnode (T, op, arg, param, value, key)
+
+  if (nargin < 6)
+    value = [];
+    key = sprintf ("%s %d %d %d", op, arg(1), arg(2), param);
+  endif
+
+  ## The index of the keys is a handle object, which is shared with the tapes
+  ## that T has been derived from.  Their entries may refer to other nodes
+  ## and are only used if the key of the node matches.
+  index = T.index;
+  if (isKey (index, key))
+    idx = index(key);
+    if (idx <= numel (T.key) && strcmp (T.key{idx}, key))
+      return
+    endif
+  endif
+
+  idx = numel (T.op) + 1;
+  T.op{idx, 1} = op;
+  T.arg(idx, :) = arg;
+  T.param(idx, 1) = param;
+  T.key{idx, 1} = key;
+  T.value{idx, 1} = value;
+  index(key) = idx;
+
+endfunction
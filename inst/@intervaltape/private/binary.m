@@ -0,0 +1,45 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{T} =} binary (@var{OP}, @var{X}, @var{Y})
+##
+## Record the element-wise operation @var{OP} on @var{X} and @var{Y} with
+## broadcasting.  Operands, which are no expressions, are converted into
+## input nodes.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function T = binary (op, x, y)
+
+  x = intervaltape (x);
+  y = intervaltape (y);
+
+  [T, y_root] = merge (x, y);
+
+  warning ("off", "Octave:broadcast", "local");
+  x_root = x.root + zeros (size (y_root));
+  y_root = y_root + zeros (size (x.root));
+
+  T.root = zeros (size (x_root));
+  for i = 1 : numel (x_root)
+    [T, T.root(i)] = addnode (T, op, [x_root(i), y_root(i)], 0);
+  endfor
+
+endfunction
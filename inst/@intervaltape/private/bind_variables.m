@@ -0,0 +1,100 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {[@var{OP}, @var{L}, @var{U}, @var{SHAPE}, @var{VARIABLE}] =} bind_variables (@var{T}, @var{ARGS})
+##
+## Bind the variables of @var{T} to the values in cell array @var{ARGS}, see
+## @code{@@intervaltape/evaluate}.  Variable nodes become input nodes of
+## the operations @var{OP} and the cell arrays @var{L} and @var{U} contain
+## the interval boundaries of all input nodes, which are broadcasted to the
+## common size @var{SHAPE}.  @var{VARIABLE}(k) is the index of the node of
+## the k-th variable or zero if the expression doesn't depend on the
+## variable.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [op, l, u, shape, variable_node] = bind_variables (T, args)
+
+  if (T.variables > 1 && numel (args) == 1 && numel (args{1}) == T.variables)
+    ## Evaluate at a single point, whose coordinates are the variables
+    x = args{1};
+    if (not (isa (x, "infsup")))
+      x = infsup (x);
+    endif
+    args = cell (1, T.variables);
+    for k = 1 : T.variables
+      args{k} = x(k);
+    endfor
+  endif
+  if (numel (args) ~= T.variables)
+    error ("interval:InvalidOperand", ...
+           "intervaltape: expected values of %d variables, got %d", ...
+           T.variables, numel (args));
+  endif
+
+  n = numel (T.op);
+  l = u = cell (n, 1);
+  input = find (strcmp (T.op, "input"))';
+  for k = input
+    l{k} = inf (T.value{k});
+    u{k} = sup (T.value{k});
+  endfor
+
+  ## Bind the variables to their values, which are inputs of the evaluation
+  variable = find (strcmp (T.op, "variable"))';
+  variable_node = zeros (1, T.variables);
+  for k = variable
+    v = args{T.param(k)};
+    if (isa (v, "infsupdec"))
+      error ("interval:InvalidOperand", ...
+             "intervaltape: decorated intervals are not supported");
+    elseif (not (isa (v, "infsup")))
+      v = infsup (v);
+    endif
+    l{k} = inf (v);
+    u{k} = sup (v);
+    variable_node(T.param(k)) = k;
+  endfor
+  op = T.op;
+  op(variable) = {"input"};
+  input = sort ([input, variable]);
+
+  ## Size of the inputs after broadcasting
+  shape = [1, 1];
+  for k = input
+    if (numel (l{k}) == 1 || isequal (size (l{k}), shape))
+      continue
+    endif
+    input_shape = size (l{k});
+    input_shape(end + 1 : numel (shape)) = 1;
+    shape(end + 1 : numel (input_shape)) = 1;
+    if (any (shape ~= input_shape & shape ~= 1 & input_shape ~= 1))
+      error ("interval:InvalidOperand", ...
+             "intervaltape: nonconformant arguments");
+    endif
+    shape(shape == 1) = input_shape(shape == 1);
+  endfor
+  for k = input
+    if (numel (l{k}) ~= 1 && not (isequal (size (l{k}), shape)))
+      l{k} = ones (shape) .* l{k};
+      u{k} = ones (shape) .* u{k};
+    endif
+  endfor
+
+endfunction
@@ -0,0 +1,59 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{T} =} concatenate (@var{DIM}, @var{X1}, @var{X2}, @dots{})
+##
+## Concatenate arrays of expressions along dimension @var{DIM}.  The
+## elements of operands, which are no expressions, are recorded as scalar
+## inputs.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function T = concatenate (dim, varargin)
+
+  T = [];
+  for i = 1 : numel (varargin)
+    y = varargin{i};
+    if (not (isa (y, "intervaltape")))
+      if (numel (y) == 0)
+        continue
+      endif
+      if (not (isa (y, "infsup")))
+        y = infsup (y);
+      endif
+      ## One input node per element
+      root = zeros (size (y));
+      Y = intervaltape (y(1));
+      root(1) = 1;
+      for j = 2 : numel (y)
+        [Y, root(j)] = merge (Y, intervaltape (y(j)));
+      endfor
+      Y.root = root;
+      y = Y;
+    endif
+
+    if (not (isa (T, "intervaltape")))
+      T = y;
+    else
+      [T, root] = merge (T, y);
+      T.root = cat (dim, T.root, root);
+    endif
+  endfor
+
+endfunction
@@ -0,0 +1,38 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{B} =} isscalar_operand (@var{X})
+##
+## Check whether @var{X} is a single interval or number, or a single
+## expression whose inputs are single intervals.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function b = isscalar_operand (x)
+
+  if (not (isa (x, "intervaltape")))
+    b = (numel (x) == 1);
+    return
+  endif
+
+  b = (numel (x.root) == 1) && ...
+      all (cellfun (@numel, x.value(strcmp (x.op, "input"))) == 1);
+
+endfunction
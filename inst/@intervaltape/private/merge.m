@@ -0,0 +1,55 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {[@var{T}, @var{IDX}] =} merge (@var{T}, @var{S})
+##
+## Merge the expression graph of @var{S} into the expression graph of
+## @var{T}.  @var{IDX} are the indices of the roots of @var{S} in the merged
+## graph.  Common subexpressions are shared.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function [T, idx] = merge (T, S)
+
+  T.variables = max (T.variables, S.variables);
+
+  n = numel (S.key);
+  if (n <= numel (T.key) && isequal (S.key, T.key(1 : n)))
+    ## S is a subexpression of T, which is the common case when a
+    ## variable is used several times
+    idx = S.root;
+    return
+  endif
+
+  map = zeros (n, 1);
+  for k = 1 : n
+    arg = S.arg(k, :);
+    arg(arg > 0) = map(arg(arg > 0));
+    if (strcmp (S.op{k}, "input"))
+      [T, map(k)] = addnode (T, "input", arg, S.param(k), S.value{k}, ...
+                             S.key{k});
+    else
+      [T, map(k)] = addnode (T, S.op{k}, arg, S.param(k));
+    endif
+  endfor
+
+  idx = reshape (map(S.root), size (S.root));
+
+endfunction
@@ -0,0 +1,45 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{Y} =} root_values (@var{T}, @var{L}, @var{U}, @var{SHAPE})
+##
+## Create the interval values of the roots of @var{T} from the cell arrays
+## @var{L} and @var{U}, which have been computed by @code{__eval_tape__} for
+## inputs of size @var{SHAPE}, see @code{@@intervaltape/evaluate} for the
+## size of the result.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function y = root_values (T, l, u, shape)
+
+  if (numel (T.root) == 1)
+    l = l{1};
+    u = u{1};
+  elseif (prod (shape) == 1)
+    l = reshape ([l{:}], size (T.root));
+    u = reshape ([u{:}], size (T.root));
+  else
+    ## One column per element of the batch
+    l = cell2mat (cellfun (@(v) v(:)', l(:), "UniformOutput", false));
+    u = cell2mat (cellfun (@(v) v(:)', u(:), "UniformOutput", false));
+  endif
+
+  y = __infsup__ (l, u);
+
+endfunction
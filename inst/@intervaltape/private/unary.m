@@ -0,0 +1,40 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypefun {@var{T} =} unary (@var{OP}, @var{X})
+## @deftypefunx {@var{T} =} unary (@var{OP}, @var{X}, @var{PARAM})
+##
+## Record the element-wise operation @var{OP} with integer parameter
+## @var{PARAM} (default: 0) on @var{X}.
+## @end deftypefun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function T = unary (op, x, param)
+
+  if (nargin < 3)
+    param = 0;
+  endif
+
+  T = x;
+  for i = 1 : numel (x.root)
+    [T, T.root(i)] = addnode (T, op, [x.root(i), 0], param);
+  endfor
+
+endfunction
@@ -0,0 +1,55 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @deftypemethod {@@intervaltape} {@var{SZ} =} size (@var{T})
+## @deftypemethodx {@@intervaltape} {@var{DIM_SZ} =} size (@var{T}, @var{DIM})
+## @deftypemethodx {@@intervaltape} {[@var{ROWS, COLS, ..., DIM_N_SZ}] =} size (...)
+##
+## Return the size of the array of expressions @var{T}.
+##
+## The size does not depend on the size of the inputs, which are broadcasted
+## during evaluation.
+##
+## @seealso{@@intervaltape/numel, @@intervaltape/end}
+## @end deftypemethod
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function varargout = size (T, dim)
+
+  if (nargin == 0 || nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (nargin == 1)
+    varargout = cell (1, max (1, nargout));
+    [varargout{:}] = size (T.root);
+  else
+    if (nargout > 1)
+      print_usage ();
+      return
+    endif
+    varargout{1} = size (T.root, dim);
+  endif
+
+endfunction
+
+%!assert (size (intervaltape (infsup (1 : 3))), [1, 1]);
+%!assert (size (intervaltape (@(x) x, [2, 3])), [2, 3]);
+%!assert (size (intervaltape (@(x) x, 3), 1), 3);
@@ -0,0 +1,74 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defop Method {@@intervaltape} subsref (@var{T}, @var{IDX})
+## @defopx Operator {@@intervaltape} {@var{T}(@var{I})}
+## @defopx Operator {@@intervaltape} {@var{T}(@var{I}, @var{J})}
+##
+## Select elements from the array of expressions @var{T}.
+##
+## Indexing does not record any operation, the result shares the expression
+## graph of @var{T}.  This is how traced functions access the elements of
+## their arguments.
+##
+## @example
+## @group
+## f = intervaltape (@@(x) x(1) .* x(2), 2);
+## evaluate (f, infsup ([2; 3]))
+##   @result{} ans = [6]
+## @end group
+## @end example
+## @seealso{@@intervaltape/end}
+## @end defop
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = subsref (T, S)
+
+  if (nargin ~= 2)
+    print_usage ();
+    return
+  endif
+
+  switch (S(1).type)
+    case "()"
+      result = T;
+      result.root = T.root(S(1).subs{:});
+    case "{}"
+      error ("interval:InvalidOperand", ...
+             "intervaltape cannot be indexed with {}");
+    otherwise
+      error ("interval:InvalidOperand", ...
+             "intervaltape cannot be indexed with %s", S(1).type);
+  endswitch
+
+  if (numel (S) > 1)
+    result = subsref (result, S(2 : end));
+  endif
+
+endfunction
+
+%!# from the documentation string
+%!assert (isequal (evaluate (intervaltape (@(x) x(1) .* x(2), 2), infsup ([2; 3])), infsup (6)));
+
+%!test
+%! f = intervaltape (@(x) x(:, 2) - x(:, 1), [2, 2]);
+%! assert (size (f), [2, 1]);
+%! assert (isequal (evaluate (f, infsup ([1; 2; 4; 8])), infsup ([3; 6])));
+%!error subsref (intervaltape (infsup (1)), substruct ("{}", {1}))
+%!error intervaltape (infsup (1)).root
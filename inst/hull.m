@@ -30,9 +30,11 @@
 ##
 ## The result is equivalent to
 ## @code{union (infsupdec (@var{X1}), union (infsupdec (@var{X2}), …))}, but
-## computed in a more efficient way.  In contrast to the union function, this
-## function is not considered a set operation and the result carries the best
-## possible decoration, which is allowed by the input parameters.
+## computed in a more efficient way: the boundaries and decorations of all
+## parameters are processed in a single pass.  In contrast to the union
+## function, this function is not considered a set operation and the result
+## carries the best possible decoration, which is allowed by the input
+## parameters.
 ##
 ## Warning: This function is not defined by IEEE Std 1788-2015 and shall not be
 ## confused with the standard's convexHull function, which is implemented by
@@ -66,112 +68,31 @@ function result = hull (varargin)
     return
   endif
 
-  l = u = cell (size (varargin));
-
-  ## Floating point numbers can be used without conversion
-  floats = cellfun (@isfloat, varargin);
-  l(floats) = u(floats) = varargin(floats);
-
-  ## Convert everything else to interval, if necessary
-  decoratedintervals = cellfun ("isclass", varargin, "infsupdec");
-  to_convert = not (decoratedintervals | floats);
-  ## Use infsupdec constructor for conversion, because it can handle decorated
-  ## interval literals.  Also, it will trigger an interval:ImplicitPromote
-  ## warning if necessary.
-  varargin(to_convert) = cellfun (@infsupdec, varargin(to_convert), ...
-                                  "UniformOutput", false ());
-  decoratedintervals = not (floats);
-
-  ## Extract inf and sup arrays for remaining elements of l and u.
-  l(decoratedintervals) = cellfun (@inf, varargin(decoratedintervals), ...
-                                   "UniformOutput", false ());
-  u(decoratedintervals) = cellfun (@sup, varargin(decoratedintervals), ...
-                                   "UniformOutput", false ());
-
-  ## Broadcast nonsingleton dimensions (otherwise cat would throw an error below)
-  numberofdimensions = max (cellfun ("ndims", l));
-  sizes = zeros(numberofdimensions, size (l)(2));
-  for dim = 1:numberofdimensions
-    sizes(dim, :) = cellfun("size", l, dim);
-  endfor
-  targetsize = max (sizes, [], 2);
-  warning ("off", "Octave:broadcast", "local");
-  if (!all (or (targetsize == sizes, sizes == 1)(:)))
-    error ("hull: dimensions mismatch")
-  endif
-  for dim = 1:numberofdimensions
-    if (targetsize(dim) ~= 1)
-      to_broadcast = sizes(dim, :) == 1;
-      for i = find (to_broadcast)
-        broadcastvector = ones (numberofdimensions, 1);
-        broadcastvector(dim) = targetsize(dim);
-        l{i} = repmat (l{i}, broadcastvector);
-        u{i} = repmat (u{i}, broadcastvector);
-      endfor
+  ## Boundaries and decorations of each parameter.  Floating point numbers
+  ## can be used without conversion and carry no decoration.
+  operands = cell (3, numel (varargin));
+  for i = 1 : numel (varargin)
+    x = varargin{i};
+    if (isfloat (x))
+      operands(:, i) = {x; x; []};
+      continue
+    endif
+    if (not (isa (x, "infsupdec")))
+      ## Use infsupdec constructor for conversion, because it can handle
+      ## decorated interval literals.  Also, it will trigger an
+      ## interval:ImplicitPromote warning if necessary.
+      x = infsupdec (x);
     endif
+    operands(:, i) = {inf(x); sup(x); decorationpart(x, "uint8")};
   endfor
 
-  ## Compute min and max of inf and sup arrays, NaNs would be ignored and must
-  ## be considered
-  nans = false (targetsize);
-  l = cat (numberofdimensions + 1, l{:});
-  nans(any (isnan (l), numberofdimensions + 1)) = true;
-  l = min (l, [], numberofdimensions + 1);
-  u = cat (numberofdimensions + 1, u{:});
-  nans(any (isnan (u), numberofdimensions + 1)) = true;
-  u = max (u, [], numberofdimensions + 1);
-
-  ## Compute best possible decoration
-  dec = cell (targetsize);
-  dec(:) = "com";
-  dec(not (isfinite (l) & isfinite (u))) = "dac";
-  dec(nans) = "trv";
-
-  ## Consider input decorations
-  if (any (decoratedintervals))
-    dec = mindec (dec, cellfun (@decorationpart, ...
-                                varargin(decoratedintervals), ...
-                                "UniformOutput", false ()));
-  endif
+  [l, u, d] = __set_operation__ ("hull", operands{:});
 
-  nairesult = strcmp (dec, "ill");
-  emptyresult = isnan (l) | isnan (u) | l > u | nairesult;
+  emptyresult = l > u;
   l(emptyresult) = u(emptyresult) = 0;
-  dec(nairesult) = "com";
-  result = infsupdec (l, u, dec);
-  result(emptyresult) = empty ();
-  result(nairesult) = nai ();
-
-endfunction
-
-function decoration = mindec (decoration, decorations)
-
-  ## Determine and apply the minimum decoration
-  for i = 1 : length (decorations)
-    if (iscell (decorations{i}) && not (isempty (decorations{i})))
-      otherdecoration = decorations{i}{1};
-    else
-      otherdecoration = decorations{i};
-    endif
-
-    ## Only check distinct elements
-    for n = find (not (strcmp (decoration, decorations{i})))(:)'
-      if (iscell (decorations{i}) && not (isscalar (decorations{i})))
-        otherdecoration = decorations{i}{n};
-      else
-        ## Scalars broadcast into the whole cell array. The value is set
-        ## once before the inner for loop.
-      endif
-
-      ## Because of the simple propagation order com > dac > def > trv, we
-      ## can use string comparison order.
-      if (!strcmp (decoration{n}, "ill") && ...
-          (strcmp (otherdecoration, "ill") || ...
-           sign ((decoration{n}) - otherdecoration) * [4; 2; 1] < 0))
-        decoration{n} = otherdecoration;
-      endif
-    endfor
-  endfor
+  result = infsup (l, u);
+  result(emptyresult) = infsup ();
+  result = infsupdec (result, d);
 
 endfunction
 
@@ -189,9 +110,9 @@ endfunction
 %!assert (isequal (hull (zeros (2, 1, 4, 1), ones (1, 3, 1, 5), -1), infsupdec (-ones (2, 3, 4, 5), ones (2, 3, 4, 5))))
 %!assert (isnai (hull (zeros (2, 2, 2, 2), ones (2, 2, 2, 2), nai)), logical (ones (2, 2, 2, 2)))
 
-%!error <dimensions mismatch> hull (1:2, 1:3);
-%!error <dimensions mismatch> hull ((1:2)', (1:3)');
-%!error <dimensions mismatch> hull (ones (2, 2, 2), ones (2, 2, 3));
+%!error <hull: dimensions mismatch> hull (1:2, 1:3);
+%!error <hull: dimensions mismatch> hull ((1:2)', (1:3)');
+%!error <hull: dimensions mismatch> hull (ones (2, 2, 2), ones (2, 2, 3));
 
 %!test "from the documentation string";
 %! assert (isequal (hull (1, 2, 3, 4), infsupdec (1, 4, "com")));
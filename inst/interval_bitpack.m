@@ -30,7 +30,7 @@
 ## Accuracy: For all valid interchange encodings the following equation holds:
 ## @code{@var{X} == bitunpack (interval_bitpack (@var{X}))}.
 ##
-## @seealso{@@infsup/bitunpack, @@infsupdec/bitunpack}
+## @seealso{@@infsup/bitunpack, @@infsupdec/bitunpack, interval_unpack}
 ## @end defun
 
 ## Author: Oliver Heimlich
@@ -50,24 +50,13 @@ function result = interval_bitpack (x)
               'was: ' typeinfo(x)])
   endif
 
+  ## Convert bits into octets of the interchange format in native byte order
   switch size (x, 2)
     case 128 # (inf, sup)
-      l = bitpack (x (:, 1 : 64)' (:), 'double');
-      u = bitpack (x (:, 65 : 128)' (:), 'double');
-      result = infsup (l, u);
+      result = interval_unpack (bitpack (x' (:), 'uint8'), 'infsup');
 
     case 136 # (inf, sup, dec)
-      l = bitpack (x (:, 1 : 64)' (:), 'double');
-      u = bitpack (x (:, 65 : 128)' (:), 'double');
-      d = bitpack (x (:, 129 : 136)' (:), 'uint8');
-
-      dec = cell (size (x, 1), 1);
-      dec (d == 4) = 'trv';
-      dec (d == 8) = 'def';
-      dec (d == 12) = 'dac';
-      dec (d == 16) = 'com';
-
-      result = infsupdec (l, u, dec);
+      result = interval_unpack (bitpack (x' (:), 'uint8'), 'infsupdec');
 
     otherwise
       error ("interval:InvalidOperand", ...
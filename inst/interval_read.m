@@ -0,0 +1,209 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defun interval_read (@var{FID})
+## @defunx interval_read (@var{FILENAME})
+## @defunx interval_read (@dots{}, @var{N})
+##
+## Read interval literals from a text file with one interval literal per line.
+##
+## The file can be given by an open file descriptor @var{FID} or by a
+## @var{FILENAME}.  Empty lines are ignored.  If @var{N} is given, at most
+## @var{N} interval literals are read and the file position of @var{FID} is
+## left at the beginning of the next line.  The result is a column vector.
+##
+## The result is a decorated interval if any of the literals is decorated or
+## is [NaI].  Otherwise, the result is a bare interval.
+##
+## The file is read and parsed in chunks, such that large files can be read
+## without an intermediate cell array of strings.  Interval literals in
+## inf-sup form with decimal or hexadecimal boundaries, as produced by
+## @command{interval_write}, are parsed directly.  Other literals are passed
+## to the interval constructor.  In either case, the boundaries are rounded
+## outward.
+##
+## @example
+## @group
+## file = tempname ();
+## interval_write (file, infsup ([1, 2], [3, 4]));
+## interval_read (file)
+##   @result{} ans ⊂ 2×1 interval vector
+##
+##        [1, 3]
+##        [2, 4]
+##
+## @end group
+## @end example
+## @seealso{interval_write, infsup, infsupdec}
+## @end defun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function x = interval_read (file, n)
+
+  if (nargin < 1 || nargin > 2)
+    print_usage ();
+    return
+  endif
+
+  if (nargin < 2)
+    n = inf;
+  endif
+
+  if (ischar (file))
+    fid = fopen (file, "r");
+    if (fid < 0)
+      error ("interval:InvalidOperand", ...
+             "interval_read: unable to open file '%s'", file);
+    endif
+    unwind_protect
+      x = interval_read (fid, n);
+    unwind_protect_cleanup
+      fclose (fid);
+    end_unwind_protect
+    return
+  endif
+
+  chunksize = 2 ^ 20;
+  l = u = {};
+  d = isnai = {};
+  count = 0;
+  decorated = false;
+  while (count < n)
+    [text, text_length] = fread (fid, [1, chunksize], "*char");
+    if (text_length == 0)
+      break
+    endif
+    if (text_length == chunksize && not (feof (fid)))
+      ## Do not split the last line of the chunk
+      last_line_break = find (text == "\n", 1, "last");
+      if (isempty (last_line_break))
+        ## Line is longer than the chunk, try again with a larger chunk
+        fseek (fid, -text_length, SEEK_CUR);
+        chunksize *= 2;
+        continue
+      endif
+      fseek (fid, last_line_break - text_length, SEEK_CUR);
+      text = text(1 : last_line_break);
+    endif
+
+    [chunk_l, chunk_u, chunk_d, valid, rejected, consumed] = ...
+      __parse_interval_literals__ (text, n - count);
+    if (consumed < numel (text))
+      ## Stopped after n literals
+      fseek (fid, consumed - numel (text), SEEK_CUR);
+    endif
+
+    chunk_isnai = false (size (chunk_l));
+    if (not (isempty (rejected)))
+      ## Let the interval constructor parse any other literal
+      if (any (not (cellfun ("isempty", strfind (rejected, "_")))) || ...
+          any (not (cellfun ("isempty", regexp (rejected, '\[\s*nai\s*\]', ...
+                                                  "ignorecase")))))
+        fallback = infsupdec (rejected);
+        chunk_d(not (valid)) = decorationpart (fallback, "uint8");
+        chunk_isnai(not (valid)) = isnai (fallback);
+      else
+        fallback = infsup (rejected);
+      endif
+      chunk_l(not (valid)) = inf (fallback);
+      chunk_u(not (valid)) = sup (fallback);
+    endif
+
+    decorated = decorated || any (chunk_d) || any (chunk_isnai);
+    l{end + 1} = chunk_l;
+    u{end + 1} = chunk_u;
+    d{end + 1} = chunk_d;
+    isnai{end + 1} = chunk_isnai;
+    count += numel (chunk_l);
+  endwhile
+
+  l = vertcat (zeros (0, 1), l{:});
+  u = vertcat (zeros (0, 1), u{:});
+  d = vertcat (zeros (0, 1, "uint8"), d{:});
+  isnai = vertcat (false (0, 1), isnai{:});
+
+  ## Empty intervals cannot be created from boundaries without a warning
+  emptyresult = isnan (l) | isnan (u) | l > u;
+  commonresult = isfinite (l) & isfinite (u) & not (emptyresult);
+  l(emptyresult) = u(emptyresult) = 0;
+
+  if (decorated)
+    ## Add missing decorations, as in the infsupdec constructor
+    missingdecoration = (d == 0) & not (isnai);
+    d(missingdecoration) = 12;
+    d(missingdecoration & emptyresult) = 4;
+    d(missingdecoration & commonresult) = 16;
+    d(isnai) = 16;
+
+    dec_translation = {"", "", "", "", "trv", "", "", "", "def", ...
+                       "", "", "", "dac", "", "", "", "com"};
+    x = infsupdec (l, u, dec_translation(d + 1));
+    x(emptyresult) = empty ();
+    x(isnai) = nai ();
+  else
+    x = infsup (l, u);
+    x(emptyresult) = infsup ();
+  endif
+
+endfunction
+
+%!test
+%! file = tempname ();
+%! fid = fopen (file, "w");
+%! fputs (fid, "[1, 2]\n\n  [3, 4]  \n0.1\n[Empty]\n3.56?1\n");
+%! fclose (fid);
+%! unwind_protect
+%!   x = interval_read (file);
+%!   assert (isa (x, "infsup") && not (isa (x, "infsupdec")));
+%!   assert (isequal (x, infsup ({"[1, 2]"; "[3, 4]"; "0.1"; "[Empty]"; "3.56?1"})));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! file = tempname ();
+%! fid = fopen (file, "w");
+%! fputs (fid, "[1, 2]_def\n[3, 4]\n[Entire]\n[Empty]\n[NaI]\n");
+%! fclose (fid);
+%! unwind_protect
+%!   x = interval_read (file);
+%!   assert (isa (x, "infsupdec"));
+%!   assert (isnai (x), logical ([0; 0; 0; 0; 1]));
+%!   assert (decorationpart (x), {"def"; "com"; "dac"; "trv"; "ill"});
+%!   assert (isequal (intervalpart (x(1 : 4)), infsup ({"[1, 2]"; "[3, 4]"; "[Entire]"; "[Empty]"})));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! file = tempname ();
+%! fid = fopen (file, "w");
+%! fputs (fid, "[1]\n[2]\n[3]\n[4]\n[5]\n");
+%! fclose (fid);
+%! unwind_protect
+%!   fid = fopen (file, "r");
+%!   assert (isequal (interval_read (fid, 2), infsup ([1; 2])));
+%!   assert (isequal (interval_read (fid, 2), infsup ([3; 4])));
+%!   assert (isequal (interval_read (fid), infsup (5)));
+%!   assert (numel (interval_read (fid)), 0);
+%!   fclose (fid);
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
@@ -0,0 +1,136 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defun interval_unpack (@var{B})
+## @defunx interval_unpack (@var{B}, @var{CLASS})
+## @defunx interval_unpack (@var{B}, @var{CLASS}, @var{ARCH})
+##
+## Decode interval array from the interchange format of IEEE Std 1788-2015.
+##
+## @var{B} is a uint8 array with 16 octets per bare interval, if @var{CLASS}
+## is @code{"infsup"} (default), or 17 octets per decorated interval, if
+## @var{CLASS} is @code{"infsupdec"}.  The byte order of the interval
+## boundaries can be selected with @var{ARCH}, which defaults to
+## @code{"native"}.  Other possible values are @code{"ieee-le"} for
+## little-endian and @code{"ieee-be"} for big-endian byte order.  The result
+## is a column vector.
+##
+## Illegal interval encodings produce empty intervals (bare) or NaIs
+## (decorated) and a warning is raised.  The encoding (NaN, NaN, ill) of NaI
+## is decoded without warning.
+##
+## Data, which has been produced by @command{interval_pack}, can be read
+## from a file with @code{fread (@var{FID}, inf, "*uint8")}.
+##
+## @example
+## @group
+## b = uint8 ([64 8 0 0 0 0 0 0 64 16 0 0 0 0 0 0 16]);
+## interval_unpack (b, "infsupdec", "ieee-be")
+##   @result{} ans = [3, 4]_com
+## @end group
+## @end example
+## @seealso{interval_pack, interval_bitpack}
+## @end defun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function result = interval_unpack (b, class_name, arch)
+
+  if (nargin < 1 || nargin > 3)
+    print_usage ();
+    return
+  endif
+
+  if (nargin < 2)
+    class_name = "infsup";
+  endif
+  if (nargin < 3)
+    arch = "native";
+  endif
+  if (not (isa (b, "uint8")))
+    error ("interval:InvalidOperand", ...
+           ['interval_unpack: parameter must be a uint8 array, ' ...
+              'was: ' class(b)])
+  endif
+
+  switch (class_name)
+    case "infsup"
+      decorated = false;
+    case "infsupdec"
+      decorated = true;
+    otherwise
+      error ("interval:InvalidOperand", ...
+             ['interval_unpack: invalid class, ' ...
+                'expected: infsup or infsupdec, ' ...
+                'was: ' class_name])
+  endswitch
+
+  [l, u, d] = __interval_unpack__ (b, decorated, arch);
+
+  ## The exchange representation of [Empty] is (+inf, -inf)
+  emptyresult = (l == inf & u == -inf);
+  illegal = not (emptyresult) & not (l <= u & l < inf & u > -inf);
+  if (decorated)
+    ## The exchange representation of [NaI] is (NaN, NaN, ill)
+    nairesult = (d == 0);
+    illegal &= not (nairesult);
+  else
+    nairesult = false (size (l));
+  endif
+  if (any (illegal))
+    warning ("interval:UndefinedOperation", ...
+             "interval_unpack: illegal interval encoding");
+  endif
+
+  placeholder = emptyresult | illegal | nairesult;
+  l(placeholder) = u(placeholder) = 0;
+  result = infsup (l, u);
+  result(placeholder) = infsup ();
+
+  if (decorated)
+    d(illegal | nairesult) = 0;
+    result = infsupdec (result, d);
+  endif
+
+endfunction
+
+%!assert (isequal (interval_unpack (interval_pack (infsup (3, 4))), infsup (3, 4)));
+%!test
+%! x = infsup ([-inf, 0, 1; 2, -3, pi], [inf, 0, 1; 3, 4, inf]);
+%! x(2, 2) = infsup ();
+%! y = interval_unpack (interval_pack (x, "ieee-be"), "infsup", "ieee-be");
+%! assert (isequal (y, x(:)));
+%! assert (signbit (inf (y(3))));
+%! assert (not (signbit (sup (y(3)))));
+%!test
+%! x = infsupdec ([-inf, 0, 1; 2, -3, pi], [inf, 0, 1; 3, 4, inf], ...
+%!                {"dac", "com", "def"; "trv", "com", "dac"});
+%! x(2, 2) = empty ();
+%! x(1, 3) = nai ();
+%! y = interval_unpack (interval_pack (x, "ieee-le"), "infsupdec", "ieee-le");
+%! assert (isequaln (y, x(:)));
+%! assert (decorationpart (y, "uint8"), decorationpart (x, "uint8")(:));
+%!warning id=interval:UndefinedOperation
+%! b = interval_pack (infsup (3, 4), "ieee-be");
+%! assert (isempty (interval_unpack (b([9 : 16, 1 : 8]), "infsup", "ieee-be")));
+%!warning id=interval:UndefinedOperation
+%! b = interval_pack (infsupdec (3, 4), "ieee-be");
+%! assert (isnai (interval_unpack (b([9 : 16, 1 : 8, 17]), "infsupdec", "ieee-be")));
+%!error interval_unpack (1 : 16)
+%!error interval_unpack (uint8 (1 : 16), "double")
@@ -0,0 +1,125 @@
+## Copyright 2026 Oliver Heimlich
+##
+## This program is free software; you can redistribute it and/or modify
+## it under the terms of the GNU General Public License as published by
+## the Free Software Foundation; either version 3 of the License, or
+## (at your option) any later version.
+##
+## This program is distributed in the hope that it will be useful,
+## but WITHOUT ANY WARRANTY; without even the implied warranty of
+## MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+## GNU General Public License for more details.
+##
+## You should have received a copy of the GNU General Public License
+## along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @documentencoding UTF-8
+## @defun interval_write (@var{FID}, @var{X})
+## @defunx interval_write (@var{FILENAME}, @var{X})
+## @defunx interval_write (@dots{}, @var{FORMAT})
+##
+## Write interval array @var{X} to a text file with one interval literal per
+## line.
+##
+## The file can be given by an open file descriptor @var{FID} or by a
+## @var{FILENAME}, which is created or overwritten.  The intervals are written
+## in column-major order, the size of @var{X} is not stored.
+##
+## The interval literals are formatted with @command{intervaltotext} and
+## conversion specifier @var{FORMAT}, which defaults to @code{[.13a]}, an
+## exact hexadecimal representation of the interval boundaries.  Decimal
+## formats can be more convenient for other applications, but may not be
+## exact and the interval boundaries would be rounded outward.
+##
+## The array is converted and written in chunks of fixed size, such that the
+## memory usage does not depend on the number of intervals.
+##
+## @example
+## @group
+## interval_write (stdout, infsup ([1, 2], [3, 4]), "[g]")
+##   @print{} [1, 3]
+##   @print{} [2, 4]
+## @end group
+## @end example
+## @seealso{interval_read, intervaltotext, @@infsup/fprintf}
+## @end defun
+
+## Author: Oliver Heimlich
+## Keywords: interval
+## Created: 2026-10-19
+
+function interval_write (file, x, format)
+
+  if (nargin < 2 || nargin > 3)
+    print_usage ();
+    return
+  endif
+
+  if (nargin < 3)
+    format = "[.13a]";
+  endif
+  if (not (isa (x, "infsup")))
+    x = infsup (x);
+  endif
+
+  if (ischar (file))
+    fid = fopen (file, "w");
+    if (fid < 0)
+      error ("interval:InvalidOperand", ...
+             "interval_write: unable to open file '%s'", file);
+    endif
+    unwind_protect
+      interval_write (fid, x, format);
+    unwind_protect_cleanup
+      fclose (fid);
+    end_unwind_protect
+    return
+  endif
+
+  chunksize = 65536;
+  n = numel (x);
+  for first = 1 : chunksize : n
+    chunk = x(first : min (first + chunksize - 1, n));
+    literals = intervaltotext (chunk, format);
+    if (ischar (literals))
+      ## intervaltotext returns a simple string for scalar intervals
+      literals = {literals};
+    endif
+    fputs (fid, sprintf ("%s\n", literals{:}));
+  endfor
+
+endfunction
+
+%!test
+%! x = infsup ([-inf, 0.1, 2; -1, 3, pi], [1, 0.2, 2; inf, 4, pi]);
+%! file = tempname ();
+%! unwind_protect
+%!   interval_write (file, x);
+%!   assert (isequal (interval_read (file), x(:)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! x = infsupdec ([1, 2, 3], [4, 5, inf]);
+%! x(2) = empty ();
+%! file = tempname ();
+%! unwind_protect
+%!   interval_write (file, x, "[.17g]");
+%!   y = interval_read (file);
+%!   assert (isa (y, "infsupdec"));
+%!   assert (isequal (y, x(:)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
+
+%!test
+%! x = infsup (1 : 70000);
+%! file = tempname ();
+%! unwind_protect
+%!   interval_write (file, x, "g");
+%!   assert (isequal (interval_read (file), x(:)));
+%! unwind_protect_cleanup
+%!   unlink (file);
+%! end_unwind_protect
@@ -0,0 +1,654 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "interval_kernels.h"
+
+// Affine form c + a_1 ε_1 + ... + a_n ε_n + e ε with noise symbols
+// ε_k ∈ [-1, 1].  The noise symbols ε_k are shared between affine forms,
+// whereas ε is specific to this form and accumulates rounding errors and
+// the errors of nonlinear approximations.  An empty interval has center NaN.
+struct affine_form
+{
+  double center;
+  std::vector <octave_idx_type> symbol;  // ascending indices of ε_k
+  std::vector <double> coef;
+  double err;
+};
+
+enum affine_operation
+{
+  AFFINE_PLUS,
+  AFFINE_MINUS,
+  AFFINE_TIMES,
+  AFFINE_SQR,
+  AFFINE_REALSQRT,
+  AFFINE_EXP,
+  AFFINE_LOG,
+  AFFINE_INV,
+  AFFINE_RANGE
+};
+
+inline bool affine_is_empty (const affine_form &x)
+{
+  return std::isnan (x.center);
+}
+
+inline void affine_set_empty (affine_form &z)
+{
+  z.center = NAN;
+  z.symbol.clear ();
+  z.coef.clear ();
+  z.err = 0.0;
+}
+
+inline void affine_set_entire (affine_form &z)
+{
+  z.center = 0.0;
+  z.symbol.clear ();
+  z.coef.clear ();
+  z.err = INFINITY;
+}
+
+// Overflow produces the affine form of the entire set of reals
+inline void affine_check (affine_form &z)
+{
+  bool finite = std::isfinite (z.center) && std::isfinite (z.err);
+  for (std::size_t k = 0; k < z.coef.size (); k ++)
+    finite &= std::isfinite (z.coef[k]);
+  if (! finite)
+    affine_set_entire (z);
+}
+
+// A binary64 number in [lo, hi], the distance to the exact value is added
+// to the error term err
+inline double affine_round (directed_rounding &r, const double lo,
+                            const double hi, double &err)
+{
+  if (lo == hi)
+    return lo;
+  const bare_interval x = {lo, hi};
+  const double m = interval_mid (r, x);
+  const double distance = std::max (r.binary (mpfr_sub, hi, m, MPFR_RNDU),
+                                    r.binary (mpfr_sub, m, lo, MPFR_RNDU));
+  err = r.binary (mpfr_add, err, distance, MPFR_RNDU);
+  return m;
+}
+
+// Sum of the absolute values of all coefficients, rounded upwards
+inline double affine_radius (directed_rounding &r, const affine_form &x)
+{
+  double result = x.err;
+  for (std::size_t k = 0; k < x.coef.size (); k ++)
+    result = r.binary (mpfr_add, result, std::fabs (x.coef[k]), MPFR_RNDU);
+  return result;
+}
+
+inline bare_interval affine_range (directed_rounding &r, const affine_form &x)
+{
+  if (affine_is_empty (x))
+    return empty_interval ();
+  const double radius = affine_radius (r, x);
+  const bare_interval result =
+    {r.binary (mpfr_sub, x.center, radius, MPFR_RNDD),
+     r.binary (mpfr_add, x.center, radius, MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+// Affine form center ± radius of an interval without shared noise symbols
+inline void affine_from_interval (directed_rounding &r, const bare_interval x,
+                                  affine_form &z)
+{
+  if (is_empty (x))
+    {
+      affine_set_empty (z);
+      return;
+    }
+  z.symbol.clear ();
+  z.coef.clear ();
+  z.err = 0.0;
+  z.center = affine_round (r, x.inf, x.sup, z.err);
+  affine_check (z);
+}
+
+// z = alpha x + beta y + c ± extra, where the center c is given by an
+// enclosure and y may be NULL
+inline void affine_linear (directed_rounding &r, const double alpha,
+                           const affine_form &x, const double beta,
+                           const affine_form *y, const bare_interval c,
+                           const double extra, affine_form &z)
+{
+  // A zero coefficient cancels the error term, even if it is unbounded
+  double err = extra;
+  if (alpha != 0.0)
+    err = r.binary (mpfr_add, err,
+                    r.binary (mpfr_mul, std::fabs (alpha), x.err, MPFR_RNDU),
+                    MPFR_RNDU);
+  if (y != NULL && beta != 0.0)
+    err = r.binary (mpfr_add, err,
+                    r.binary (mpfr_mul, std::fabs (beta), y->err, MPFR_RNDU),
+                    MPFR_RNDU);
+
+  // Merge the coefficients of both forms by noise symbol
+  z.symbol.clear ();
+  z.coef.clear ();
+  const std::size_t nx = x.symbol.size ();
+  const std::size_t ny = y != NULL ? y->symbol.size () : 0;
+  std::size_t i = 0;
+  std::size_t j = 0;
+  while (i < nx || j < ny)
+    {
+      octave_idx_type s;
+      double lo, hi;
+      if (j >= ny || (i < nx && x.symbol[i] < y->symbol[j]))
+        {
+          s = x.symbol[i];
+          lo = r.binary (mpfr_mul, alpha, x.coef[i], MPFR_RNDD);
+          hi = r.binary (mpfr_mul, alpha, x.coef[i], MPFR_RNDU);
+          i ++;
+        }
+      else if (i >= nx || y->symbol[j] < x.symbol[i])
+        {
+          s = y->symbol[j];
+          lo = r.binary (mpfr_mul, beta, y->coef[j], MPFR_RNDD);
+          hi = r.binary (mpfr_mul, beta, y->coef[j], MPFR_RNDU);
+          j ++;
+        }
+      else
+        {
+          s = x.symbol[i];
+          lo = r.binary (mpfr_add,
+                         r.binary (mpfr_mul, alpha, x.coef[i], MPFR_RNDD),
+                         r.binary (mpfr_mul, beta, y->coef[j], MPFR_RNDD),
+                         MPFR_RNDD);
+          hi = r.binary (mpfr_add,
+                         r.binary (mpfr_mul, alpha, x.coef[i], MPFR_RNDU),
+                         r.binary (mpfr_mul, beta, y->coef[j], MPFR_RNDU),
+                         MPFR_RNDU);
+          i ++;
+          j ++;
+        }
+      const double a = affine_round (r, lo, hi, err);
+      if (a != 0.0)
+        {
+          z.symbol.push_back (s);
+          z.coef.push_back (a);
+        }
+    }
+
+  z.center = affine_round (r, c.inf, c.sup, err);
+  z.err = err;
+  affine_check (z);
+}
+
+inline void affine_binary (directed_rounding &r, const affine_operation op,
+                           const affine_form &x, const affine_form &y,
+                           affine_form &z)
+{
+  if (affine_is_empty (x) || affine_is_empty (y))
+    {
+      affine_set_empty (z);
+      return;
+    }
+
+  switch (op)
+    {
+      case AFFINE_PLUS:
+        {
+          const bare_interval c =
+            {r.binary (mpfr_add, x.center, y.center, MPFR_RNDD),
+             r.binary (mpfr_add, x.center, y.center, MPFR_RNDU)};
+          affine_linear (r, 1.0, x, 1.0, &y, c, 0.0, z);
+          break;
+        }
+      case AFFINE_MINUS:
+        {
+          const bare_interval c =
+            {r.binary (mpfr_sub, x.center, y.center, MPFR_RNDD),
+             r.binary (mpfr_sub, x.center, y.center, MPFR_RNDU)};
+          affine_linear (r, 1.0, x, -1.0, &y, c, 0.0, z);
+          break;
+        }
+      default:
+        {
+          // x y = c_x c_y + c_y (x - c_x) + c_x (y - c_y)
+          //       + (x - c_x) (y - c_y), where the last term is bounded by
+          //       the product of the radii
+          const double rx = affine_radius (r, x);
+          const double ry = affine_radius (r, y);
+          const double extra = (rx == 0.0 || ry == 0.0)
+                               ? 0.0
+                               : r.binary (mpfr_mul, rx, ry, MPFR_RNDU);
+          const bare_interval c =
+            {r.binary (mpfr_mul, x.center, y.center, MPFR_RNDD),
+             r.binary (mpfr_mul, x.center, y.center, MPFR_RNDU)};
+          affine_linear (r, y.center, x, x.center, &y, c, extra, z);
+          break;
+        }
+    }
+}
+
+// Interval extension of the nonlinear function
+inline bare_interval affine_function (directed_rounding &r,
+                                      const affine_operation op,
+                                      const bare_interval x)
+{
+  const bare_interval one = {1.0, 1.0};
+  switch (op)
+    {
+      case AFFINE_SQR:
+        return interval_sqr (r, x);
+      case AFFINE_REALSQRT:
+        return interval_realsqrt (r, x);
+      case AFFINE_EXP:
+        return interval_exp (r, x);
+      case AFFINE_LOG:
+        return interval_log (r, x);
+      default:
+        return interval_rdivide (r, one, x);
+    }
+}
+
+// Enclosure of f (x) - alpha x
+inline bare_interval affine_residual (directed_rounding &r,
+                                      const affine_operation op,
+                                      const double alpha,
+                                      const bare_interval x)
+{
+  const bare_interval a = {alpha, alpha};
+  return interval_minus (r, affine_function (r, op, x),
+                         interval_times (r, a, x));
+}
+
+// Enclosure of the point in x, where the derivative of the function equals
+// alpha.  The sign of alpha must match the derivative.
+inline bare_interval affine_stationary_point (directed_rounding &r,
+                                              const affine_operation op,
+                                              const double alpha,
+                                              const bare_interval x)
+{
+  const bare_interval a = {alpha, alpha};
+  const bare_interval one = {1.0, 1.0};
+  bare_interval result;
+  switch (op)
+    {
+      case AFFINE_SQR:
+        {
+          // 2 t = alpha
+          const bare_interval half = {0.5, 0.5};
+          result = interval_times (r, half, a);
+          break;
+        }
+      case AFFINE_REALSQRT:
+        {
+          // 1 / (2 sqrt (t)) = alpha
+          const bare_interval four = {4.0, 4.0};
+          result = interval_rdivide (r, one,
+                                     interval_times (r, four,
+                                                     interval_sqr (r, a)));
+          break;
+        }
+      case AFFINE_EXP:
+        result = interval_log (r, a);
+        break;
+      case AFFINE_LOG:
+        result = interval_rdivide (r, one, a);
+        break;
+      default:
+        {
+          // -1 / t^2 = alpha
+          const bare_interval minus_one = {-1.0, -1.0};
+          result = interval_realsqrt (r, interval_rdivide (r, minus_one, a));
+          if (x.sup < 0.0)
+            result = interval_uminus (result);
+          break;
+        }
+    }
+  return interval_intersect (x, result);
+}
+
+// Chebyshev approximation f (x) ∈ alpha x + zeta ± delta of the convex or
+// concave function f over the range of x.  Where the function is not
+// defined on the whole range, or the range is unbounded, the result is the
+// interval extension of f without shared noise symbols.
+inline void affine_unary (directed_rounding &r, const affine_operation op,
+                          const affine_form &x, affine_form &z)
+{
+  if (affine_is_empty (x))
+    {
+      affine_set_empty (z);
+      return;
+    }
+
+  const bare_interval range = affine_range (r, x);
+  const bare_interval fx = affine_function (r, op, range);
+  bool defined;
+  bool convex;
+  switch (op)
+    {
+      case AFFINE_REALSQRT:
+        defined = range.inf >= 0.0;
+        convex = false;
+        break;
+      case AFFINE_LOG:
+        defined = range.inf > 0.0;
+        convex = false;
+        break;
+      case AFFINE_INV:
+        defined = range.inf > 0.0 || range.sup < 0.0;
+        convex = range.inf > 0.0;
+        break;
+      default:
+        defined = true;
+        convex = true;
+        break;
+    }
+  if (! defined || range.inf == range.sup
+      || ! std::isfinite (range.inf) || ! std::isfinite (range.sup)
+      || is_empty (fx) || ! std::isfinite (fx.inf)
+      || ! std::isfinite (fx.sup))
+    {
+      affine_from_interval (r, fx, z);
+      return;
+    }
+
+  // Slope of the secant, any value yields a valid approximation
+  const bare_interval a = {range.inf, range.inf};
+  const bare_interval b = {range.sup, range.sup};
+  const double alpha = (interval_mid (r, affine_function (r, op, b))
+                        - interval_mid (r, affine_function (r, op, a)))
+                       / (range.sup - range.inf);
+  const bool sign_ok = op == AFFINE_SQR
+                       || (op == AFFINE_INV ? alpha < 0.0 : alpha > 0.0);
+  if (! std::isfinite (alpha) || ! sign_ok)
+    {
+      affine_from_interval (r, fx, z);
+      return;
+    }
+
+  // The residual f (t) - alpha t is convex or concave, its extreme values
+  // are at the boundaries of the range and at the stationary point
+  const bare_interval ga = affine_residual (r, op, alpha, a);
+  const bare_interval gb = affine_residual (r, op, alpha, b);
+  bare_interval g = {std::min (ga.inf, gb.inf), std::max (ga.sup, gb.sup)};
+  const bare_interval t = affine_stationary_point (r, op, alpha, range);
+  if (! is_empty (t))
+    {
+      const bare_interval gt = affine_residual (r, op, alpha, t);
+      if (convex)
+        g.inf = std::min (g.inf, gt.inf);
+      else
+        g.sup = std::max (g.sup, gt.sup);
+    }
+  const double zeta = interval_mid (r, g);
+  const double delta = std::max (r.binary (mpfr_sub, zeta, g.inf, MPFR_RNDU),
+                                 r.binary (mpfr_sub, g.sup, zeta, MPFR_RNDU));
+
+  // z = alpha x + zeta ± delta
+  const bare_interval c =
+    {r.binary (mpfr_add,
+               r.binary (mpfr_mul, alpha, x.center, MPFR_RNDD), zeta,
+               MPFR_RNDD),
+     r.binary (mpfr_add,
+               r.binary (mpfr_mul, alpha, x.center, MPFR_RNDU), zeta,
+               MPFR_RNDU)};
+  affine_linear (r, alpha, x, 0.0, NULL, c, delta, z);
+}
+
+inline bool parse_affine_operation (const std::string &name,
+                                    affine_operation &op)
+{
+  static const char *names[] = {"plus", "minus", "times", "sqr", "realsqrt",
+                                "exp", "log", "inv", "range"};
+  for (int k = 0; k <= AFFINE_RANGE; k ++)
+    if (name == names[k])
+      {
+        op = static_cast <affine_operation> (k);
+        return true;
+      }
+
+  error ("__affine__: unsupported operation '%s'", name.c_str ());
+  return false;
+}
+
+// Affine forms of N elements with the centers C, the coefficients A (K×N)
+// of the shared noise symbols, and the error terms E
+struct affine_array
+{
+  ColumnVector c;
+  SparseMatrix a;
+  ColumnVector e;
+
+  bool read (const octave_value_list &args, const int offset)
+  {
+    c = args (offset).column_vector_value ();
+    a = args (offset + 1).sparse_matrix_value ();
+    e = args (offset + 2).column_vector_value ();
+    if (a.cols () != c.numel () || e.numel () != c.numel ())
+      {
+        error ("__affine__: inconsistent affine forms");
+        return false;
+      }
+    return true;
+  }
+
+  void get (const octave_idx_type j, affine_form &x) const
+  {
+    x.center = c(j);
+    x.err = e(j);
+    x.symbol.clear ();
+    x.coef.clear ();
+    for (octave_idx_type i = a.cidx (j); i < a.cidx (j + 1); i ++)
+      {
+        x.symbol.push_back (a.ridx (i));
+        x.coef.push_back (a.data (i));
+      }
+  }
+};
+
+DEFUN_DLD (__affine__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{C}, @var{A}, @var{E}] =} __affine__ (@var{OP}, "
+  "@var{C1}, @var{A1}, @var{E1})\n"
+  "@deftypefnx {} {[@var{C}, @var{A}, @var{E}] =} __affine__ (@var{OP}, "
+  "@var{C1}, @var{A1}, @var{E1}, @var{C2}, @var{A2}, @var{E2})\n"
+  "@deftypefnx {} {[@var{L}, @var{U}] =} __affine__ (\"range\", @var{C1}, "
+  "@var{A1}, @var{E1})\n"
+  "\n"
+  "Compute the element-wise operation @var{OP} on arrays of affine forms."
+  "\n\n"
+  "An array of N affine forms consists of the column vector of centers "
+  "@var{C}, the sparse K×N matrix @var{A}, whose rows are the coefficients "
+  "of K noise symbols, which are shared between affine forms, and the "
+  "column vector @var{E} of nonnegative error terms, which are specific to "
+  "each element.  Empty intervals have center NaN, and the entire set of "
+  "reals has an infinite error term.  Binary operations broadcast arrays "
+  "with a single element."
+  "\n\n"
+  "Supported operations are @code{plus}, @code{minus}, and @code{times}, "
+  "and the functions @code{sqr}, @code{realsqrt}, @code{exp}, @code{log}, "
+  "and @code{inv} (reciprocal), which use Chebyshev approximations.  All "
+  "rounding errors are added to the error terms, such that the result "
+  "is a valid enclosure.  Operation @code{range} computes the interval "
+  "boundaries [@var{L}, @var{U}] of the affine forms.  The elements are "
+  "processed in parallel if the package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@affineform/affineform}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 4 && nargin != 7)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  affine_operation op;
+  if (! parse_affine_operation (args (0).string_value (), op))
+    return octave_value_list ();
+  const bool binary = op == AFFINE_PLUS || op == AFFINE_MINUS
+                      || op == AFFINE_TIMES;
+  if (binary != (nargin == 7))
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  affine_array x, y;
+  if (! x.read (args, 1) || (binary && ! y.read (args, 4)))
+    return octave_value_list ();
+
+  const octave_idx_type nx = x.c.numel ();
+  const octave_idx_type ny = binary ? y.c.numel () : nx;
+  if (nx != ny && nx != 1 && ny != 1)
+    {
+      error ("__affine__: nonconformant arguments");
+      return octave_value_list ();
+    }
+  const octave_idx_type n = (nx == 1) ? ny : nx;
+  const octave_idx_type k = binary ? std::max (x.a.rows (), y.a.rows ())
+                                   : x.a.rows ();
+
+  std::vector <affine_form> z (op == AFFINE_RANGE ? 0 : n);
+  ColumnVector l (op == AFFINE_RANGE ? n : 0);
+  ColumnVector u (op == AFFINE_RANGE ? n : 0);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables and affine forms
+    directed_rounding r;
+    affine_form xj, yj;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type j = 0; j < n; j ++)
+      {
+        x.get (nx == 1 ? 0 : j, xj);
+        if (op == AFFINE_RANGE)
+          {
+            const bare_interval range = affine_range (r, xj);
+            l(j) = range.inf;
+            u(j) = range.sup;
+          }
+        else if (binary)
+          {
+            y.get (ny == 1 ? 0 : j, yj);
+            affine_binary (r, op, xj, yj, z[j]);
+          }
+        else
+          affine_unary (r, op, xj, z[j]);
+      }
+  }
+
+  octave_value_list result;
+  if (op == AFFINE_RANGE)
+    {
+      result (0) = l;
+      result (1) = u;
+      return result;
+    }
+
+  octave_idx_type nnz = 0;
+  for (octave_idx_type j = 0; j < n; j ++)
+    nnz += z[j].symbol.size ();
+  ColumnVector c (n);
+  SparseMatrix a (k, n, nnz);
+  ColumnVector e (n);
+  octave_idx_type *cidx = a.xcidx ();
+  octave_idx_type *ridx = a.xridx ();
+  double *data = a.xdata ();
+  octave_idx_type pos = 0;
+  cidx[0] = 0;
+  for (octave_idx_type j = 0; j < n; j ++)
+    {
+      c(j) = z[j].center;
+      e(j) = z[j].err;
+      for (std::size_t i = 0; i < z[j].symbol.size (); i ++)
+        {
+          ridx[pos] = z[j].symbol[i];
+          data[pos] = z[j].coef[i];
+          pos ++;
+        }
+      cidx[j + 1] = pos;
+    }
+
+  result (0) = c;
+  result (1) = a;
+  result (2) = e;
+  return result;
+}
+
+/*
+%!test
+%! ## x - x = 0 for x = 1 + ε_1
+%! [c, a, e] = __affine__ ("minus", 1, sparse (1), 0, 1, sparse (1), 0);
+%! assert ([c, nnz(a), e], [0, 0, 0]);
+%!test
+%! ## (1 + ε_1) (1 - ε_1) = 1 ± 1 instead of [0, 4]
+%! [c, a, e] = __affine__ ("times", 1, sparse (1), 0, 1, sparse (-1), 0);
+%! assert ([c, nnz(a), e], [1, 0, 1]);
+%! [l, u] = __affine__ ("range", c, a, e);
+%! assert ([l, u], [0, 2]);
+%!test
+%! ## Rounding errors are added to the error term
+%! [c, a, e] = __affine__ ("plus", 1, sparse (0.1), 0, 2, sparse (0.2), 0);
+%! [l, u] = __affine__ ("range", c, a, e);
+%! assert (l <= 3 - 0.1 - 0.2 && 3 + 0.1 + 0.2 <= u);
+%! assert (e > 0);
+%!test
+%! ## Chebyshev approximation of sqr on [1, 3]
+%! [c, a, e] = __affine__ ("sqr", 2, sparse (1), 0);
+%! assert (full (a), 4);
+%! [l, u] = __affine__ ("range", c, a, e);
+%! assert (l <= 1 && 9 <= u);
+%! assert (u - l <= 10);
+%!test
+%! x = [2; 3];
+%! for op = {"exp", "log", "realsqrt", "inv"}
+%!   [c, a, e] = __affine__ (op{1}, x, sparse ([0.5, 0; 0, 1]), [0; 0.25]);
+%!   [l, u] = __affine__ ("range", c, a, e);
+%!   f = str2func (op{1});
+%!   if (strcmp (op{1}, "inv"))
+%!     f = @(x) 1 ./ x;
+%!   endif
+%!   t = [linspace(1.5, 2.5, 11); linspace(1.75, 4.25, 11)];
+%!   assert (all (all (l <= f (t) & f (t) <= u)));
+%! endfor
+%!test
+%! ## Empty and unbounded results
+%! [c, a, e] = __affine__ ("log", -2, sparse (1), 0);
+%! assert (isnan (c));
+%! [c, a, e] = __affine__ ("times", 1, sparse (1), inf, 0, sparse (1, 1), 0);
+%! assert ([c, e], [0, 0]);
+%! [c, a, e] = __affine__ ("exp", 0, sparse (1, 1), inf);
+%! [l, u] = __affine__ ("range", c, a, e);
+%! assert ([l, u], [-inf, inf]);
+%!error __affine__ ("sin", 1, sparse (1), 0)
+%!error __affine__ ("plus", [1; 2], sparse ([1, 1]), [0; 0], [1; 2; 3], sparse ([1, 1, 1]), [0; 0; 0])
+*/
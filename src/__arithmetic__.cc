@@ -0,0 +1,293 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include "interval_kernels.h"
+
+// Decorations of IEEE Std 1788-2015, see @infsupdec/private/_*.m
+const uint8_t DEC_ILL = 0;
+const uint8_t DEC_TRV = 4;
+const uint8_t DEC_DAC = 12;
+const uint8_t DEC_COM = 16;
+
+enum arithmetic_operation {PLUS, MINUS, TIMES, RDIVIDE,
+                          ABS, EXP, LOG, REALSQRT, SIN, COS};
+
+DEFUN_DLD (__arithmetic__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn  {} {[@var{L}, @var{U}, @var{D}] =} __arithmetic__ (@var{OP}, "
+  "@var{XL}, @var{XU}, @var{XD}, @var{YL}, @var{YU}, @var{YD})\n"
+  "@deftypefnx {} {[@var{L}, @var{U}, @var{D}] =} __arithmetic__ (@var{OP}, "
+  "@var{XL}, @var{XU}, @var{XD})\n"
+  "\n"
+  "Evaluate the arithmetic operation or elementary function @var{OP} on "
+  "decorated intervals element-wise."
+  "\n\n"
+  "@var{OP} is @code{\"plus\"}, @code{\"minus\"}, @code{\"times\"}, or "
+  "@code{\"rdivide\"} for two operands, or @code{\"abs\"}, "
+  "@code{\"exp\"}, @code{\"log\"}, @code{\"realsqrt\"}, "
+  "@code{\"sin\"}, or @code{\"cos\"} for one operand.  The operands have "
+  "lower boundaries @var{XL} and @var{YL}, upper boundaries @var{XU} and "
+  "@var{YU}, and uint8 decorations @var{XD} and @var{YD}.  They are "
+  "broadcasted to the size of the result."
+  "\n\n"
+  "The boundaries @var{L} and @var{U} of the tight enclosure, the domain "
+  "check, and the decoration @var{D} of each element are computed in a "
+  "single pass, in parallel if the package has been compiled with OpenMP.  "
+  "Empty results are returned as @var{L} = inf and @var{U} = -inf.  A "
+  "decoration @code{ill} of any operand produces an empty result with "
+  "decoration @code{ill}."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsupdec/plus, @@infsupdec/minus, @@infsupdec/times, "
+  "@@infsupdec/rdivide, @@infsupdec/abs, @@infsupdec/exp, @@infsupdec/log, "
+  "@@infsupdec/realsqrt, @@infsupdec/sin, @@infsupdec/cos}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 4 && nargin != 7)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const std::string op_name = args (0).string_value ();
+  arithmetic_operation op;
+  if (op_name == "plus")
+    op = PLUS;
+  else if (op_name == "minus")
+    op = MINUS;
+  else if (op_name == "times")
+    op = TIMES;
+  else if (op_name == "rdivide")
+    op = RDIVIDE;
+  else if (op_name == "abs")
+    op = ABS;
+  else if (op_name == "exp")
+    op = EXP;
+  else if (op_name == "log")
+    op = LOG;
+  else if (op_name == "realsqrt")
+    op = REALSQRT;
+  else if (op_name == "sin")
+    op = SIN;
+  else if (op_name == "cos")
+    op = COS;
+  else
+    {
+      error ("__arithmetic__: unknown operation '%s'", op_name.c_str ());
+      return octave_value_list ();
+    }
+  const int n = op <= RDIVIDE ? 2 : 1;
+  if (nargin != 1 + 3 * n)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  // Keep the operands alive while their data is in use
+  NDArray boundaries[4];
+  uint8NDArray decorations[2];
+  broadcast_operand operands[2];
+  for (int k = 0; k < n; k ++)
+    {
+      boundaries[2 * k] = args (1 + 3 * k).array_value ();
+      boundaries[2 * k + 1] = args (2 + 3 * k).array_value ();
+      decorations[k] = args (3 + 3 * k).uint8_array_value ();
+      operands[k].dims = boundaries[2 * k].dims ();
+      if (boundaries[2 * k + 1].dims () != operands[k].dims
+          || decorations[k].dims () != operands[k].dims)
+        {
+          error ("%s: nonconformant arguments", op_name.c_str ());
+          return octave_value_list ();
+        }
+      operands[k].inf = boundaries[2 * k].data ();
+      operands[k].sup = boundaries[2 * k + 1].data ();
+      operands[k].dec = decorations[k].data ();
+    }
+
+  // Non-singleton dimensions of the operands must agree
+  dim_vector result_dims;
+  if (! broadcast_operands (operands, n, result_dims))
+    {
+      error ("%s: nonconformant arguments", op_name.c_str ());
+      return octave_value_list ();
+    }
+
+  const octave_idx_type elements = result_dims.numel ();
+  NDArray l (result_dims), u (result_dims);
+  uint8NDArray d (result_dims);
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  octave_uint8 *d_data = d.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (elements >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < elements; i ++)
+      {
+        const octave_idx_type ix = operands[0].index (result_dims, i);
+        const bare_interval x = {operands[0].inf[ix], operands[0].sup[ix]};
+        uint8_t dec = operands[0].dec[ix].value ();
+        bare_interval y = x;
+        if (n == 2)
+          {
+            const octave_idx_type iy = operands[1].index (result_dims, i);
+            y.inf = operands[1].inf[iy];
+            y.sup = operands[1].sup[iy];
+            dec = std::min (dec, operands[1].dec[iy].value ());
+          }
+
+        bare_interval result;
+        if (dec == DEC_ILL)
+          result = empty_interval ();
+        else
+          {
+            // The functions are continuous everywhere, but some are not
+            // defined on the whole input
+            switch (op)
+              {
+              case PLUS:
+                result = interval_plus (r, x, y);
+                break;
+              case MINUS:
+                result = interval_minus (r, x, y);
+                break;
+              case TIMES:
+                result = interval_times (r, x, y);
+                break;
+              case RDIVIDE:
+                result = interval_rdivide (r, x, y);
+                // rdivide is not defined for y = 0
+                if (y.inf <= 0.0 && y.sup >= 0.0)
+                  dec = std::min (dec, DEC_TRV);
+                break;
+              case ABS:
+                result = interval_abs (x);
+                break;
+              case EXP:
+                result = interval_exp (r, x);
+                break;
+              case LOG:
+                result = interval_log (r, x);
+                // log is defined for x > 0 only
+                if (x.inf <= 0.0)
+                  dec = std::min (dec, DEC_TRV);
+                break;
+              case REALSQRT:
+                result = interval_realsqrt (r, x);
+                // realsqrt is defined for x >= 0 only
+                if (x.inf < 0.0)
+                  dec = std::min (dec, DEC_TRV);
+                break;
+              case SIN:
+                result = interval_sin (r, x);
+                break;
+              case COS:
+                result = interval_cos (r, x);
+                break;
+              }
+
+            // Best possible decoration of the result
+            if (is_empty (result))
+              dec = std::min (dec, DEC_TRV);
+            else if (std::isinf (result.inf) || std::isinf (result.sup))
+              dec = std::min (dec, DEC_DAC);
+          }
+
+        l_data[i] = result.inf;
+        u_data[i] = result.sup;
+        d_data[i] = dec;
+      }
+  }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = d;
+  return result;
+}
+
+/*
+%!test
+%! [l, u, d] = __arithmetic__ ("plus", [1, 2], [2, 3], uint8 ([16, 12]), 1, inf, uint8 (16));
+%! assert (l, [2, 3]);
+%! assert (u, [inf, inf]);
+%! assert (d, uint8 ([12, 12]));
+%!test
+%! [l, u, d] = __arithmetic__ ("minus", [1; 2], [2; 3], uint8 ([16; 16]), [0, 1], [0, 1], uint8 ([16, 8]));
+%! assert (l, [1, 0; 2, 1]);
+%! assert (u, [2, 1; 3, 2]);
+%! assert (d, uint8 ([16, 8; 16, 8]));
+%! assert (signbit (l(1, 2)));
+%!test
+%! [l, u, d] = __arithmetic__ ("times", [0, -inf, inf], [0, inf, -inf], uint8 ([16, 12, 4]), -inf, inf, uint8 (12));
+%! assert (l, [0, -inf, inf]);
+%! assert (u, [0, inf, -inf]);
+%! assert (d, uint8 ([12, 12, 4]));
+%!test
+%! [l, u, d] = __arithmetic__ ("rdivide", 1, 1, uint8 (16), [3, 0, -1, 2], [3, 0, 1, 4], uint8 ([16, 16, 16, 0]));
+%! assert (l(1), 1 / 3, eps);
+%! assert (u(1) - l(1), eps / 4);
+%! assert (l(2 : 4), [inf, -inf, inf]);
+%! assert (u(2 : 4), [-inf, inf, -inf]);
+%! assert (d, uint8 ([16, 4, 4, 0]));
+%!test
+%! [l, u, d] = __arithmetic__ ("exp", [0, -inf], [0, 1], uint8 ([16, 12]));
+%! assert (l, [1, 0]);
+%! assert (u(2), exp (1), eps (exp (1)));
+%! assert (d, uint8 ([16, 12]));
+%!test
+%! [l, u, d] = __arithmetic__ ("log", [1, 0, -2], [1, 1, -1], uint8 ([16, 16, 16]));
+%! assert (l, [0, -inf, inf]);
+%! assert (u, [0, 0, -inf]);
+%! assert (d, uint8 ([16, 4, 4]));
+%!test
+%! [l, u, d] = __arithmetic__ ("realsqrt", [4, -1, 0], [4, 4, 0], uint8 ([16, 16, 0]));
+%! assert (l, [2, 0, inf]);
+%! assert (u, [2, 2, -inf]);
+%! assert (d, uint8 ([16, 4, 0]));
+%!test
+%! [l, u, d] = __arithmetic__ ("abs", [-2, -inf], [1, -1], uint8 ([16, 12]));
+%! assert (l, [0, 1]);
+%! assert (u, [2, inf]);
+%! assert (d, uint8 ([16, 12]));
+%!test
+%! [l, u, d] = __arithmetic__ ("sin", [0, 0], [0, 7], uint8 ([16, 16]));
+%! assert (l, [0, -1]);
+%! assert (u, [0, 1]);
+%! assert (d, uint8 ([16, 16]));
+%! [l, u, d] = __arithmetic__ ("cos", 0, 0, uint8 (16));
+%! assert ([l, u, double(d)], [1, 1, 16]);
+%!error __arithmetic__ ("mtimes", 1, 1, uint8 (16), 1, 1, uint8 (16))
+%!error __arithmetic__ ("exp", 1, 1, uint8 (16), 1, 1, uint8 (16))
+%!error <plus: nonconformant arguments> __arithmetic__ ("plus", [1, 2], [1, 2], uint8 ([16, 16]), [1, 2, 3], [1, 2, 3], uint8 ([16, 16, 16]))
+*/
@@ -0,0 +1,381 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "interval_kernels.h"
+
+// Coefficients of a polynomial in d variables on a subbox of [0, 1]^d in
+// tensor Bernstein form, stored in column-major order.  The subbox has been
+// split splits[k] times along dimension k.
+struct bernstein_box
+{
+  std::vector <bare_interval> coef;
+  std::vector <int> splits;
+};
+
+// Shape of the coefficient tensor with degree size[k] - 1 in variable k
+class bernstein_tensor
+{
+public:
+  std::vector <octave_idx_type> size;
+  octave_idx_type elements;
+
+  // Number of coefficients before element 1 in dimension k
+  octave_idx_type stride (const int k) const
+  {
+    octave_idx_type result = 1;
+    for (int j = 0; j < k; j ++)
+      result *= size[j];
+    return result;
+  }
+
+  // Index of the first element of line number l along dimension k
+  octave_idx_type line_start (const int k, const octave_idx_type l) const
+  {
+    const octave_idx_type s = stride (k);
+    return l % s + (l / s) * s * size[k];
+  }
+};
+
+// Binomial coefficients C(n, k) = binomial[n][k] as intervals, which are
+// exact unless they exceed 2^53
+std::vector <std::vector <bare_interval> >
+binomial_table (directed_rounding &r, const octave_idx_type n)
+{
+  const bare_interval one = {1.0, 1.0};
+  std::vector <std::vector <bare_interval> > binomial (n + 1);
+  for (octave_idx_type i = 0; i <= n; i ++)
+    {
+      binomial[i].resize (i + 1, one);
+      for (octave_idx_type j = 1; j < i; j ++)
+        binomial[i][j] = interval_plus (r, binomial[i - 1][j - 1],
+                                        binomial[i - 1][j]);
+    }
+  return binomial;
+}
+
+// Convert the coefficients c of the powers of variable k on [a, b] into
+// Bernstein coefficients.  The substitution x = a + (b - a) t gives the
+// coefficients q of the powers of t in [0, 1],
+//   q(j) = (b - a)^j sum_{i >= j} C(i, j) a^(i - j) c(i),
+// and the Bernstein coefficients are
+//   b(i) = sum_{j <= i} C(i, j) / C(n, j) q(j).
+// Both sums are exact dot products, which are rounded only once.
+void power_to_bernstein (directed_rounding &r, exact_accumulator &accu,
+                         const bernstein_tensor &tensor, const int k,
+                         const double a, const double b,
+                         const std::vector <std::vector <bare_interval> >
+                           &binomial,
+                         std::vector <bare_interval> &c)
+{
+  const octave_idx_type m = tensor.size[k];
+  const octave_idx_type n = m - 1;
+  if (n == 0)
+    return;
+
+  const bare_interval lower = {a, a};
+  const bare_interval upper = {b, b};
+  const bare_interval width = interval_minus (r, upper, lower);
+  std::vector <bare_interval> shift (m * m), basis (m * m);
+  for (octave_idx_type j = 0; j <= n; j ++)
+    {
+      const bare_interval width_j = interval_pown (r, width, j);
+      for (octave_idx_type i = j; i <= n; i ++)
+        shift[j + i * m] =
+          interval_times (r, width_j,
+                          interval_times (r, binomial[i][j],
+                                          interval_pown (r, lower, i - j)));
+      for (octave_idx_type i = j; i <= n; i ++)
+        basis[i + j * m] = interval_rdivide (r, binomial[i][j],
+                                             binomial[n][j]);
+    }
+
+  const octave_idx_type stride = tensor.stride (k);
+  std::vector <bare_interval> q (m);
+  for (octave_idx_type l = 0; l < tensor.elements / m; l ++)
+    {
+      bare_interval *line = &c[tensor.line_start (k, l)];
+      for (octave_idx_type j = 0; j <= n; j ++)
+        {
+          accu.reset ();
+          for (octave_idx_type i = j; i <= n; i ++)
+            accu.add_product (shift[j + i * m], line[i * stride]);
+          q[j] = accu.result ();
+        }
+      for (octave_idx_type i = 0; i <= n; i ++)
+        {
+          accu.reset ();
+          for (octave_idx_type j = 0; j <= i; j ++)
+            accu.add_product (basis[i + j * m], q[j]);
+          line[i * stride] = accu.result ();
+        }
+    }
+}
+
+// Split the box in halves along dimension k with the de Casteljau algorithm
+void de_casteljau (directed_rounding &r, const bernstein_tensor &tensor,
+                   const int k, const bernstein_box &box,
+                   bernstein_box &left, bernstein_box &right)
+{
+  const octave_idx_type m = tensor.size[k];
+  const octave_idx_type n = m - 1;
+  const octave_idx_type stride = tensor.stride (k);
+  const bare_interval half = {0.5, 0.5};
+  left.coef.resize (tensor.elements);
+  right.coef.resize (tensor.elements);
+  std::vector <bare_interval> work (m);
+  for (octave_idx_type l = 0; l < tensor.elements / m; l ++)
+    {
+      const octave_idx_type start = tensor.line_start (k, l);
+      for (octave_idx_type i = 0; i <= n; i ++)
+        work[i] = box.coef[start + i * stride];
+      left.coef[start] = work[0];
+      right.coef[start + n * stride] = work[n];
+      for (octave_idx_type s = 1; s <= n; s ++)
+        {
+          for (octave_idx_type i = 0; i <= n - s; i ++)
+            work[i] = interval_times (r, half,
+                                      interval_plus (r, work[i],
+                                                     work[i + 1]));
+          left.coef[start + s * stride] = work[0];
+          right.coef[start + (n - s) * stride] = work[n - s];
+        }
+    }
+  left.splits = box.splits;
+  left.splits[k] ++;
+  right.splits = left.splits;
+}
+
+DEFUN_DLD (__bernstein__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}, @var{BOXES}] =} __bernstein__ "
+  "(@var{PL}, @var{PU}, @var{XL}, @var{XU}, @var{TOL}, @var{MAXBOXES})\n"
+  "\n"
+  "Compute an enclosure [@var{L}, @var{U}] of the range of a polynomial in "
+  "d = @code{numel (@var{XL})} variables over the box [@var{XL}, @var{XU}]."
+  "\n\n"
+  "The d-dimensional array [@var{PL}, @var{PU}] contains the interval "
+  "coefficients, where element (i1, @dots{}, id) is the coefficient of "
+  "x1^(i1 - 1) @dots{} xd^(id - 1).  The coefficients are converted into "
+  "tensor Bernstein form on the box with exact dot products.  The range is "
+  "enclosed by the smallest and largest Bernstein coefficient.  While the "
+  "bounds are not attained at a vertex of a subbox and can improve the "
+  "overall bounds by more than @var{TOL} relative to the largest vertex "
+  "value, the subbox is split in halves along its widest dimension with the "
+  "de Casteljau algorithm.  At most @var{MAXBOXES} subboxes are used, and "
+  "@var{BOXES} is the number of subboxes, which have been used."
+  "\n\n"
+  "The range over an unbounded box is entire, unless the polynomial is "
+  "constant in the unbounded variables."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/polyrange}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 6)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const NDArray pl = args (0).array_value ();
+  const NDArray pu = args (1).array_value ();
+  const NDArray xl = args (2).array_value ();
+  const NDArray xu = args (3).array_value ();
+  const double tol = args (4).double_value ();
+  const octave_idx_type max_boxes = args (5).idx_type_value ();
+  const int d = xl.numel ();
+  const dim_vector p_dims = pl.dims ();
+  if (pu.dims () != p_dims || xu.numel () != d)
+    {
+      error ("__bernstein__: nonconformant arguments");
+      return octave_value_list ();
+    }
+  if (d < 1 || p_dims.ndims () > std::max (d, 2)
+      || (d == 1 && p_dims(1) != 1))
+    {
+      error ("__bernstein__: P must be an array with one dimension per "
+             "variable");
+      return octave_value_list ();
+    }
+
+  bernstein_tensor tensor;
+  tensor.size.resize (d);
+  for (int k = 0; k < d; k ++)
+    tensor.size[k] = k < p_dims.ndims () ? p_dims(k) : 1;
+  tensor.elements = pl.numel ();
+
+  directed_rounding r;
+  exact_accumulator accu;
+  bernstein_box root;
+  root.coef.resize (tensor.elements);
+  root.splits.resize (d, 0);
+  bool empty = tensor.elements == 0;
+  bool unbounded = false;
+  octave_idx_type max_degree = 0;
+  for (octave_idx_type i = 0; i < tensor.elements; i ++)
+    {
+      root.coef[i].inf = pl(i);
+      root.coef[i].sup = pu(i);
+      empty |= is_empty (root.coef[i]);
+    }
+  for (int k = 0; k < d; k ++)
+    {
+      const bare_interval x_k = {xl(k), xu(k)};
+      empty |= is_empty (x_k);
+      if (tensor.size[k] > 1)
+        unbounded |= ! std::isfinite (x_k.inf) || ! std::isfinite (x_k.sup);
+      max_degree = std::max (max_degree, tensor.size[k] - 1);
+    }
+
+  octave_value_list result (3);
+  result (2) = 0;
+  if (empty)
+    {
+      result (0) = INFINITY;
+      result (1) = -INFINITY;
+      return result;
+    }
+  if (unbounded)
+    {
+      result (0) = -INFINITY;
+      result (1) = INFINITY;
+      return result;
+    }
+
+  const std::vector <std::vector <bare_interval> > binomial =
+    binomial_table (r, max_degree);
+  for (int k = 0; k < d; k ++)
+    power_to_bernstein (r, accu, tensor, k, xl(k), xu(k), binomial,
+                        root.coef);
+
+  // Indices of the coefficients at the vertices of the box
+  std::vector <octave_idx_type> vertices;
+  for (octave_idx_type v = 0; v < (octave_idx_type) 1 << d; v ++)
+    {
+      octave_idx_type idx = 0;
+      for (int k = 0; k < d; k ++)
+        if ((v >> k) & 1)
+          idx += (tensor.size[k] - 1) * tensor.stride (k);
+      vertices.push_back (idx);
+    }
+
+  // Known values of the polynomial at vertices: min_value is an upper bound
+  // of the minimum and max_value is a lower bound of the maximum
+  double min_value = INFINITY;
+  double max_value = -INFINITY;
+  double l = INFINITY;
+  double u = -INFINITY;
+  octave_idx_type boxes = 1;
+  std::vector <bernstein_box> stack (1, root);
+  while (! stack.empty ())
+    {
+      const bernstein_box box = stack.back ();
+      stack.pop_back ();
+
+      double box_l = INFINITY;
+      double box_u = -INFINITY;
+      for (octave_idx_type i = 0; i < tensor.elements; i ++)
+        {
+          box_l = std::min (box_l, box.coef[i].inf);
+          box_u = std::max (box_u, box.coef[i].sup);
+        }
+      double vertex_l = INFINITY;
+      double vertex_u = -INFINITY;
+      for (std::size_t v = 0; v < vertices.size (); v ++)
+        {
+          const bare_interval value = box.coef[vertices[v]];
+          vertex_l = std::min (vertex_l, value.inf);
+          vertex_u = std::max (vertex_u, value.sup);
+          min_value = std::min (min_value, value.sup);
+          max_value = std::max (max_value, value.inf);
+        }
+
+      // Widest dimension of the subbox, which can be split
+      int split = -1;
+      double split_width = 0.0;
+      for (int k = 0; k < d; k ++)
+        {
+          const double width = std::ldexp (xu(k) - xl(k), -box.splits[k]);
+          if (tensor.size[k] > 1 && box.splits[k] < 52
+              && width > split_width)
+            {
+              split = k;
+              split_width = width;
+            }
+        }
+
+      const double margin = tol * std::max (std::abs (min_value),
+                                            std::abs (max_value));
+      const bool refine = (box_l < vertex_l && box_l < min_value - margin)
+                          || (box_u > vertex_u && box_u > max_value + margin);
+      if (refine && split >= 0 && boxes < max_boxes)
+        {
+          bernstein_box left, right;
+          de_casteljau (r, tensor, split, box, left, right);
+          stack.push_back (right);
+          stack.push_back (left);
+          boxes ++;
+        }
+      else
+        {
+          l = std::min (l, box_l);
+          u = std::max (u, box_u);
+        }
+    }
+
+  bare_interval range = {l, u};
+  range = normalize_zero (range);
+  result (0) = range.inf;
+  result (1) = range.sup;
+  result (2) = boxes;
+  return result;
+}
+
+/*
+%!test
+%! ## x^2 - 2 x on [0, 2] has range [-1, 0]
+%! [l, u] = __bernstein__ ([0; -2; 1], [0; -2; 1], 0, 2, 1e-12, 1000);
+%! assert (l <= -1 && -1 - 1e-10 < l);
+%! assert (u, 0);
+%!test
+%! [l, u, boxes] = __bernstein__ ([1; 2; 1], [1; 2; 1], 0, 1, 0, 1000);
+%! assert ([l, u], [1, 4]);
+%! assert (boxes, 1);
+%!test
+%! ## x y - x - y on [0, 2]^2 has range [-2, 0]
+%! [l, u] = __bernstein__ ([0, -1; -1, 1], [0, -1; -1, 1], [0; 0], [2; 2], 1e-12, 1000);
+%! assert ([l, u], [-2, 0]);
+%!test
+%! [l, u] = __bernstein__ ([1; 1], [1; 1], 0, inf, 0, 10);
+%! assert ([l, u], [-inf, inf]);
+%! [l, u] = __bernstein__ ([1; 1], [1; 1], inf, -inf, 0, 10);
+%! assert ([l, u], [inf, -inf]);
+%!test
+%! [l, u, boxes] = __bernstein__ ([0; -2; 1], [0; -2; 1], 0, 2, 0, 5);
+%! assert (boxes <= 5);
+%! assert (l <= -1 && 0 <= u);
+%!error __bernstein__ ([1, 2; 3, 4], [1, 2; 3, 4], 0, 1, 0, 10)
+*/
@@ -0,0 +1,180 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__chol__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{RL}, @var{RU}, @var{NOTPD}, @var{UNCERTAIN}, "
+  "@var{P}] =} __chol__ (@var{L}, @var{U})\n"
+  "\n"
+  "Compute the upper triangular Cholesky factor of the symmetric interval "
+  "matrix with lower boundaries @var{L} and upper boundaries @var{U}."
+  "\n\n"
+  "Only the upper triangle of the matrix is used.  The factor is computed "
+  "row by row on the interval boundaries.  Each element of the factor is "
+  "computed from an exact dot product, which is rounded only once before "
+  "the division by the diagonal element, or the square root."
+  "\n\n"
+  "@var{NOTPD} is true if a diagonal element of the elimination is "
+  "guaranteed to be nonpositive, such that each symmetric matrix in the "
+  "interval matrix is not positive definite.  Then, @var{P} is the negated "
+  "upper boundary of the last such element.  @var{UNCERTAIN} is true if "
+  "another diagonal element contains both, positive and nonpositive "
+  "numbers, and only the positive numbers have been used.  The row "
+  "updates are computed in parallel if the package has been compiled with "
+  "OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/chol}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 2)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  Matrix l = args (0).matrix_value ();
+  Matrix u = args (1).matrix_value ();
+  const octave_idx_type n = l.rows ();
+  if (l.columns () != n || u.rows () != n || u.columns () != n)
+    {
+      error ("__chol__: matrix is not square");
+      return octave_value_list ();
+    }
+
+  // The factor R(i, j) is stored in place of the upper triangle at
+  // i + j * n, such that the dot products run over contiguous columns
+  double *rl = l.fortran_vec ();
+  double *ru = u.fortran_vec ();
+  bool notpd = false;
+  bool uncertain = false;
+  double p = 0.0;
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 64)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    exact_accumulator accu;
+
+    for (octave_idx_type k = 0; k < n; k ++)
+      {
+        const octave_idx_type col_k = k * n;
+
+        // Diagonal element alpha = A(k, k) - R(1 : k - 1, k)' R(1 : k - 1, k)
+#if defined (_OPENMP)
+        #pragma omp single
+#endif
+        {
+          const bare_interval a_kk = {rl[k + col_k], ru[k + col_k]};
+          accu.reset ();
+          accu.add (interval_uminus (a_kk));
+          for (octave_idx_type j = 0; j < k; j ++)
+            {
+              const bare_interval r_jk = {rl[j + col_k], ru[j + col_k]};
+              accu.add_square (r_jk);
+            }
+          const bare_interval alpha = interval_uminus (accu.result ());
+          if (alpha.inf <= 0.0)
+            {
+              if (alpha.sup <= 0.0)
+                {
+                  notpd = true;
+                  p = -alpha.sup;
+                }
+              else
+                uncertain = true;
+            }
+          const bare_interval s = interval_realsqrt (r, alpha);
+          rl[k + col_k] = s.inf;
+          ru[k + col_k] = s.sup;
+        }
+
+        // Row k: R(k, i) = (A(k, i) - R(1 : k - 1, k)' R(1 : k - 1, i)) / s
+        const bare_interval s = {rl[k + col_k], ru[k + col_k]};
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type i = k + 1; i < n; i ++)
+          {
+            const octave_idx_type col_i = i * n;
+            const bare_interval a_ki = {rl[k + col_i], ru[k + col_i]};
+            accu.reset ();
+            accu.add (a_ki);
+            for (octave_idx_type j = 0; j < k; j ++)
+              {
+                const bare_interval r_jk = {rl[j + col_k], ru[j + col_k]};
+                const bare_interval r_ji = {rl[j + col_i], ru[j + col_i]};
+                accu.add_product (interval_uminus (r_jk), r_ji);
+              }
+            const bare_interval r_ki = interval_rdivide (r, accu.result (), s);
+            rl[k + col_i] = r_ki.inf;
+            ru[k + col_i] = r_ki.sup;
+          }
+      }
+  }
+
+  // Lower triangle
+  for (octave_idx_type j = 0; j < n; j ++)
+    for (octave_idx_type i = j + 1; i < n; i ++)
+      {
+        rl[i + j * n] = 0.0;
+        ru[i + j * n] = 0.0;
+      }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = notpd;
+  result (3) = uncertain;
+  result (4) = p;
+  return result;
+}
+
+/*
+%!test
+%! [l, u, notpd, uncertain] = __chol__ (pascal (3), pascal (3));
+%! assert (l, chol (pascal (3)));
+%! assert (u, chol (pascal (3)));
+%! assert ([notpd, uncertain], [false, false]);
+%!test
+%! [l, u] = __chol__ ([2, 1; 1, 1], [2, 1; 1, 1]);
+%! assert (l <= chol ([2, 1; 1, 1]) & chol ([2, 1; 1, 1]) <= u);
+%! assert (u - l <= 2 * eps);
+%!test
+%! A = pascal (3);
+%! B = A;
+%! B(3, 3) = 6;
+%! A(3, 3) = 5;
+%! [l, u, notpd, uncertain] = __chol__ (A, B);
+%! assert ([notpd, uncertain], [false, true]);
+%! assert ([l(3, 3), u(3, 3)], [0, 1]);
+%!test
+%! [~, ~, notpd, uncertain, p] = __chol__ ([1, 2; 2, 1], [1, 2; 2, 1]);
+%! assert ([notpd, uncertain], [true, false]);
+%! assert (p, 3);
+%!error __chol__ (ones (2, 3), ones (2, 3))
+*/
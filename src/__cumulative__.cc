@@ -0,0 +1,154 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__cumulative__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __cumulative__ (@var{OP}, @var{XL}, "
+  "@var{XU}, @var{DIM})\n"
+  "\n"
+  "Compute the cumulative sum (@var{OP} = @code{\"sum\"}) or cumulative "
+  "product (@var{OP} = @code{\"prod\"}) of the interval array with lower "
+  "boundaries @var{XL} and upper boundaries @var{XU} along dimension "
+  "@var{DIM}."
+  "\n\n"
+  "The cumulative sum uses an exact running accumulator, such that each "
+  "partial sum is rounded only once and is tight.  The cumulative product "
+  "is computed with directed rounding after each multiplication.  Once an "
+  "empty interval has been encountered, all following elements of the "
+  "slice are empty.  The slices along @var{DIM} are computed in parallel if "
+  "the package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/cumsum, @@infsup/cumprod}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 4)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const std::string op = args (0).string_value ();
+  if (op != "sum" && op != "prod")
+    {
+      error ("__cumulative__: unknown operation '%s'", op.c_str ());
+      return octave_value_list ();
+    }
+  const bool sum = op == "sum";
+
+  NDArray l = args (1).array_value ();
+  NDArray u = args (2).array_value ();
+  const int dim = args (3).int_value ();
+  const dim_vector dims = l.dims ();
+  if (u.dims () != dims)
+    {
+      error ("__cumulative__: nonconformant arguments");
+      return octave_value_list ();
+    }
+  if (dim < 1)
+    {
+      error ("__cumulative__: DIM must be a valid dimension");
+      return octave_value_list ();
+    }
+
+  // Element k of slice (a, b) is at a + k * before + b * before * n
+  octave_idx_type before = 1;
+  octave_idx_type after = 1;
+  for (int i = 0; i < dims.ndims (); i ++)
+    if (i < dim - 1)
+      before *= dims(i);
+    else if (i > dim - 1)
+      after *= dims(i);
+  const octave_idx_type n = dim <= dims.ndims () ? dims(dim - 1) : 1;
+  const octave_idx_type slices = before * after;
+
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (slices >= 16 && slices * n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    exact_accumulator accu;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type s = 0; s < slices; s ++)
+      {
+        const octave_idx_type a = s % before;
+        const octave_idx_type b = s / before;
+        const octave_idx_type first = a + b * before * n;
+        accu.reset ();
+        bare_interval running = {1.0, 1.0};
+        for (octave_idx_type k = 0; k < n; k ++)
+          {
+            const octave_idx_type idx = first + k * before;
+            const bare_interval x = {l_data[idx], u_data[idx]};
+            if (sum)
+              {
+                accu.add (x);
+                running = accu.result ();
+              }
+            else
+              running = interval_times (r, running, x);
+            l_data[idx] = running.inf;
+            u_data[idx] = running.sup;
+          }
+      }
+  }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __cumulative__ ("sum", [1, 2, 3], [1, 2, 3], 2);
+%! assert (l, [1, 3, 6]);
+%! assert (u, [1, 3, 6]);
+%!test
+%! [l, u] = __cumulative__ ("sum", [1, eps / 2, -1], [1, eps / 2, -1], 2);
+%! assert (l, [1, 1, eps / 2]);
+%! assert (u, [1, 1 + eps, eps / 2]);
+%!test
+%! [l, u] = __cumulative__ ("prod", [1; -2; 3], [2; 2; 3], 1);
+%! assert (l, [1; -4; -12]);
+%! assert (u, [2; 4; 12]);
+%!test
+%! [l, u] = __cumulative__ ("prod", [1, inf, 2], [1, -inf, 2], 2);
+%! assert (l, [1, inf, inf]);
+%! assert (u, [1, -inf, -inf]);
+%!test
+%! [l, u] = __cumulative__ ("sum", ones (2, 2, 3), ones (2, 2, 3), 3);
+%! assert (l, cumsum (ones (2, 2, 3), 3));
+%! [l, u] = __cumulative__ ("sum", ones (2, 2), ones (2, 2), 3);
+%! assert (l, ones (2, 2));
+%!error __cumulative__ ("max", 1, 1, 1)
+*/
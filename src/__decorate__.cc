@@ -0,0 +1,211 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <cmath>
+#include <vector>
+
+// Decorations of IEEE Std 1788-2015, see @infsupdec/private/_*.m
+const uint8_t DEC_TRV = 4;
+const uint8_t DEC_DAC = 12;
+const uint8_t DEC_COM = 16;
+
+// One operand, whose decoration limits the decoration of the result
+struct decoration_operand
+{
+  const octave_uint8 *dec;  // decorations or NULL
+  const bool *domain;       // domain mask or NULL
+  bool scalar;              // the same value applies to all elements
+  bool broadcast;           // needs index computation
+  std::vector <octave_idx_type> stride;
+
+  uint8_t value (octave_idx_type idx) const
+  {
+    if (dec != NULL)
+      return dec[idx].value ();
+    return domain[idx] ? DEC_COM : DEC_TRV;
+  }
+};
+
+DEFUN_DLD (__decorate__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {@var{D} =} __decorate__ (@var{BARE}, @var{D1}, @dots{}, "
+  "@var{DN})\n"
+  "\n"
+  "Compute the decoration @var{D} of the bare interval result @var{BARE} of "
+  "a function evaluation."
+  "\n\n"
+  "Each element of @var{D} is the strongest decoration, which is possible "
+  "for the corresponding element of @var{BARE} (@code{com} for nonempty "
+  "bounded intervals, @code{dac} for nonempty unbounded intervals, and "
+  "@code{trv} for empty intervals), limited by the decorations of the "
+  "function's arguments.  Arguments @var{D1}, @dots{}, @var{DN} of class "
+  "uint8 are the decorations of the function's arguments, logical arguments "
+  "are masks, which are false where the function is not defined on the "
+  "whole input and limit the decoration to @code{trv}.  All arguments must "
+  "be broadcastable to the size of @var{BARE}.  The computation takes a "
+  "single pass over the data."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{newdec}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin < 1)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  if (! args (0).is_instance_of ("infsup")
+      || args (0).is_instance_of ("infsupdec"))
+    {
+      error ("__decorate__: BARE must be a bare interval");
+      return octave_value_list ();
+    }
+
+  const octave_scalar_map bare = args (0).scalar_map_value ();
+  const NDArray inf = bare.getfield ("inf").array_value ();
+  const NDArray sup = bare.getfield ("sup").array_value ();
+  const dim_vector result_dims = inf.dims ();
+  const int dimensions = result_dims.ndims ();
+
+  // Keep the operands alive while their data is in use
+  std::vector <uint8NDArray> decorations;
+  std::vector <boolNDArray> masks;
+  decorations.reserve (nargin - 1);
+  masks.reserve (nargin - 1);
+  std::vector <decoration_operand> operands (nargin - 1);
+
+  for (int k = 1; k < nargin; k ++)
+    {
+      decoration_operand &op = operands[k - 1];
+      dim_vector op_dims;
+      if (args (k).class_name () == "logical")
+        {
+          masks.push_back (args (k).bool_array_value ());
+          op.dec = NULL;
+          op.domain = masks.back ().data ();
+          op_dims = masks.back ().dims ();
+        }
+      else if (args (k).class_name () == "uint8")
+        {
+          decorations.push_back (args (k).uint8_array_value ());
+          op.dec = decorations.back ().data ();
+          op.domain = NULL;
+          op_dims = decorations.back ().dims ();
+        }
+      else
+        {
+          error ("__decorate__: decorations must be uint8 or logical arrays");
+          return octave_value_list ();
+        }
+
+      op.scalar = op_dims.numel () == 1;
+      op.broadcast = ! op.scalar && op_dims != result_dims;
+      if (! op.broadcast)
+        continue;
+
+      // Stride along each dimension of the result, singleton dimensions of
+      // the operand are broadcasted
+      if (op_dims.ndims () > dimensions)
+        {
+          error ("__decorate__: nonconformant arguments");
+          return octave_value_list ();
+        }
+      op_dims = op_dims.redim (dimensions);
+      op.stride.resize (dimensions);
+      octave_idx_type stride = 1;
+      for (int i = 0; i < dimensions; i ++)
+        {
+          if (op_dims(i) == result_dims(i))
+            op.stride[i] = stride;
+          else if (op_dims(i) == 1)
+            op.stride[i] = 0;
+          else
+            {
+              error ("__decorate__: nonconformant arguments");
+              return octave_value_list ();
+            }
+          stride *= op_dims(i);
+        }
+    }
+
+  bool needs_index = false;
+  for (std::size_t k = 0; k < operands.size (); k ++)
+    needs_index |= operands[k].broadcast;
+
+  uint8NDArray result (result_dims);
+  octave_uint8 *result_data = result.fortran_vec ();
+  const double *inf_data = inf.data ();
+  const double *sup_data = sup.data ();
+  const octave_idx_type n = result.numel ();
+  std::vector <octave_idx_type> idx_base (dimensions, 0);
+
+  for (octave_idx_type i = 0; i < n; i ++)
+    {
+      // Strongest decoration, which is possible for the bare result
+      uint8_t d;
+      if (inf_data[i] > sup_data[i])
+        d = DEC_TRV;
+      else if (std::isfinite (inf_data[i]) && std::isfinite (sup_data[i]))
+        d = DEC_COM;
+      else
+        d = DEC_DAC;
+
+      for (std::size_t k = 0; k < operands.size (); k ++)
+        {
+          const decoration_operand &op = operands[k];
+          octave_idx_type idx;
+          if (op.scalar)
+            idx = 0;
+          else if (! op.broadcast)
+            idx = i;
+          else
+            {
+              idx = 0;
+              for (int j = 0; j < dimensions; j ++)
+                idx += idx_base[j] * op.stride[j];
+            }
+          d = std::min (d, op.value (idx));
+        }
+      result_data[i] = d;
+
+      if (needs_index)
+        result_dims.increment_index (idx_base.data ());
+    }
+
+  return octave_value (result);
+}
+
+/*
+%!assert (__decorate__ (infsup ([1, -inf, 2], [2, 3, inf])), uint8 ([16, 12, 12]));
+%!assert (__decorate__ (infsup (), uint8 (16)), uint8 (4));
+%!assert (__decorate__ (infsup (1, 2), uint8 (12)), uint8 (12));
+%!assert (__decorate__ (infsup (1, 2), uint8 (0)), uint8 (0));
+%!assert (__decorate__ (infsup ([1, 2]), uint8 (16), [true, false]), uint8 ([16, 4]));
+%!assert (__decorate__ (infsup (zeros (2, 3)), uint8 ([8; 16]), uint8 ([16, 12, 4])), uint8 ([8, 8, 4; 16, 12, 4]));
+%!assert (__decorate__ (infsup (zeros (2, 2, 2)), true (1, 1, 2), uint8 ([12, 16])), uint8 (cat (3, [12, 16; 12, 16], [12, 16; 12, 16])));
+%!error __decorate__ ()
+%!error __decorate__ (infsupdec (1))
+%!error __decorate__ (infsup (zeros (2, 2)), uint8 ([1, 2, 3]))
+%!error __decorate__ (infsup (1), 1)
+*/
@@ -0,0 +1,189 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <vector>
+#include "interval_tape.h"
+
+DEFUN_DLD (__eval_tape__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __eval_tape__ (@var{OP}, @var{ARG}, "
+  "@var{PARAM}, @var{INF}, @var{SUP}, @var{ROOT})\n"
+  "@deftypefnx {} {[@var{L}, @var{U}, @var{DL}, @var{DU}] =} __eval_tape__ "
+  "(@var{OP}, @var{ARG}, @var{PARAM}, @var{INF}, @var{SUP}, @var{ROOT}, "
+  "@var{WRT})\n"
+  "\n"
+  "Evaluate an interval expression graph element-wise in a single pass."
+  "\n\n"
+  "The graph consists of N nodes in topological order.  @var{OP} is a cell "
+  "array of strings with the operation of each node, @var{ARG} is an N×2 "
+  "matrix with the (one-based) indices of the argument nodes, and "
+  "@var{PARAM} contains the integer exponent of @code{pown} nodes.  For "
+  "nodes with operation @code{input}, the cell arrays @var{INF} and "
+  "@var{SUP} contain the interval boundaries.  Inputs are either scalar or "
+  "of equal size."
+  "\n\n"
+  "The cell arrays @var{L} and @var{U} contain the interval boundaries of the "
+  "nodes with indices @var{ROOT}.  Nodes, which are not needed for the roots, "
+  "are not evaluated."
+  "\n\n"
+  "With indices @var{WRT} of input nodes, the derivatives of the roots with "
+  "respect to these inputs are computed in forward mode in the same pass.  "
+  "@var{DL}@{i, j@} and @var{DU}@{i, j@} contain the interval boundaries of "
+  "the derivative of root i with respect to input @var{WRT}(j).  Outside of "
+  "the domain of the functions, the derivatives are unbounded."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@intervaltape/evaluate}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 6 && nargin != 7)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  interval_tape tape;
+  if (! tape.read ("__eval_tape__", args, 0))
+    return octave_value_list ();
+  const Array <octave_idx_type> root =
+    args (5).octave_idx_type_vector_value (true);
+  if (! tape.mark ("__eval_tape__", root))
+    return octave_value_list ();
+  const bool derivatives = nargin == 7;
+  if (derivatives
+      && ! tape.seed ("__eval_tape__",
+                      args (6).octave_idx_type_vector_value (true)))
+    return octave_value_list ();
+  const octave_idx_type d = tape.derivatives;
+
+  const dim_vector result_dims = tape.dims;
+  std::vector <NDArray> l (root.numel (), NDArray (result_dims));
+  std::vector <NDArray> u (root.numel (), NDArray (result_dims));
+  std::vector <double *> l_data (root.numel ());
+  std::vector <double *> u_data (root.numel ());
+  for (octave_idx_type j = 0; j < root.numel (); j ++)
+    {
+      l_data[j] = l[j].fortran_vec ();
+      u_data[j] = u[j].fortran_vec ();
+    }
+
+  // Derivative of root j with respect to input k at dl[j + k * roots]
+  const octave_idx_type roots = root.numel ();
+  std::vector <NDArray> dl (roots * d, NDArray (result_dims));
+  std::vector <NDArray> du (roots * d, NDArray (result_dims));
+  std::vector <double *> dl_data (roots * d);
+  std::vector <double *> du_data (roots * d);
+  for (octave_idx_type j = 0; j < roots * d; j ++)
+    {
+      dl_data[j] = dl[j].fortran_vec ();
+      du_data[j] = du[j].fortran_vec ();
+    }
+
+  const octave_idx_type elements = result_dims.numel ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (elements >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables and node values
+    directed_rounding r;
+    std::vector <bare_interval> value (tape.nodes.size ());
+    std::vector <bare_interval> gradient (tape.nodes.size () * d);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < elements; i ++)
+      {
+        if (derivatives)
+          tape.evaluate_gradient (r, value, gradient, i);
+        else
+          tape.evaluate (r, value, i);
+        for (octave_idx_type j = 0; j < roots; j ++)
+          {
+            l_data[j][i] = value[root(j) - 1].inf;
+            u_data[j][i] = value[root(j) - 1].sup;
+            const bare_interval *g = &gradient[(root(j) - 1) * d];
+            for (octave_idx_type k = 0; k < d; k ++)
+              {
+                dl_data[j + k * roots][i] = g[k].inf;
+                du_data[j + k * roots][i] = g[k].sup;
+              }
+          }
+      }
+  }
+
+  Cell l_result (root.dims ());
+  Cell u_result (root.dims ());
+  for (octave_idx_type j = 0; j < root.numel (); j ++)
+    {
+      l_result(j) = l[j];
+      u_result(j) = u[j];
+    }
+
+  octave_value_list result;
+  result (0) = l_result;
+  result (1) = u_result;
+  if (derivatives)
+    {
+      Cell dl_result (dim_vector (roots, d));
+      Cell du_result (dim_vector (roots, d));
+      for (octave_idx_type j = 0; j < roots * d; j ++)
+        {
+          dl_result(j) = dl[j];
+          du_result(j) = du[j];
+        }
+      result (2) = dl_result;
+      result (3) = du_result;
+    }
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __eval_tape__ ({"input"; "input"; "plus"}, [0, 0; 0, 0; 1, 2], zeros (3, 1), {1; [2, 3]; []}, {2; [3, 4]; []}, 3);
+%! assert (l, {[3, 4]});
+%! assert (u, {[5, 6]});
+%!test
+%! [l, u] = __eval_tape__ ({"input"; "pown"; "sin"}, [0, 0; 1, 0; 2, 0], [0; 3; 0], {-2; []; []}, {1; []; []}, [2, 1]);
+%! assert (l, {-8, -2});
+%! assert (u, {1, 1});
+%!test
+%! [l, u] = __eval_tape__ ({"input"; "input"; "rdivide"}, [0, 0; 0, 0; 1, 2], zeros (3, 1), {1; 3; []}, {1; 3; []}, 3);
+%! assert (l{1}, 1 / 3, eps);
+%! assert (u{1} - l{1}, eps / 4);
+%!test
+%! [l, u, dl, du] = __eval_tape__ ({"input"; "input"; "times"; "sin"}, [0, 0; 0, 0; 1, 2; 3, 0], zeros (4, 1), {[1, 2]; 3; []; []}, {[1, 2]; 3; []; []}, [3; 4], [1, 2]);
+%! assert (l{1}, [3, 6]);
+%! assert (dl{1, 1}, [3, 3]);
+%! assert (dl{1, 2}, [1, 2]);
+%! assert (dl{2, 1}, 3 .* cos ([3, 6]), 8 * eps);
+%! assert (dl{2, 2}, [1, 2] .* cos ([3, 6]), 8 * eps);
+%! assert (all (cell2mat (dl) <= cell2mat (du)));
+%!test
+%! [~, ~, dl, du] = __eval_tape__ ({"input"; "realsqrt"}, [0, 0; 1, 0], zeros (2, 1), {[-1, 4]}, {[1, 4]}, 2, 1);
+%! assert (dl{1}, [-inf, 0.25]);
+%! assert (du{1}, [inf, 0.25]);
+%!error __eval_tape__ ({"input"; "tan"}, [0, 0; 1, 0], zeros (2, 1), {1; []}, {1; []}, 2)
+%!error __eval_tape__ ({"input"; "input"; "plus"}, [0, 0; 0, 0; 1, 2], zeros (3, 1), {[1, 2]; [1, 2, 3]; []}, {[1, 2]; [1, 2, 3]; []}, 3)
+*/
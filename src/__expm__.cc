@@ -0,0 +1,394 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "interval_kernels.h"
+
+// Dot products in floating-point arithmetic with rounding to nearest.  The
+// result is inflated by an a priori error bound, which accounts for the
+// rounding errors of all products and additions.  The interface is the same
+// as for exact_accumulator.
+class fast_accumulator
+{
+public:
+  fast_accumulator ()
+  {
+    reset ();
+  }
+
+  void reset ()
+  {
+    sum_l = sum_u = 0.0;
+    abs_l = abs_u = 0.0;
+    terms = 0;
+    empty = false;
+  }
+
+  void add (const bare_interval x)
+  {
+    if (is_empty (x))
+      {
+        empty = true;
+        return;
+      }
+    add_bounds (x.inf, x.sup);
+  }
+
+  void add_product (const bare_interval x, const bare_interval y)
+  {
+    if (is_empty (x) || is_empty (y))
+      {
+        empty = true;
+        return;
+      }
+    const double p1 = product (x.inf, y.inf);
+    const double p2 = product (x.inf, y.sup);
+    const double p3 = product (x.sup, y.inf);
+    const double p4 = product (x.sup, y.sup);
+    add_bounds (std::min (std::min (p1, p2), std::min (p3, p4)),
+                std::max (std::max (p1, p2), std::max (p3, p4)));
+  }
+
+  // Add the tight square [mig (x)^2, mag (x)^2]
+  void add_square (const bare_interval x)
+  {
+    if (is_empty (x))
+      {
+        empty = true;
+        return;
+      }
+    add_bounds (mig (x) * mig (x), mag (x) * mag (x));
+  }
+
+  bare_interval result () const
+  {
+    if (empty)
+      return empty_interval ();
+
+    // The error of n rounded products and their sum is bounded by
+    // gamma (n + 1) times the sum of absolute values plus n times the
+    // underflow error of a product.  The bound is overestimated by a factor
+    // of 2, which covers the rounding errors of abs_l, abs_u, and the bound
+    // itself.  The final addition is off by at most half an ulp.
+    const double gamma = (terms + 2) * DBL_EPSILON;
+    const double tiny =
+      (terms + 1) * std::numeric_limits<double>::denorm_min ();
+    bare_interval result =
+      {std::nextafter (sum_l - (gamma * abs_l + tiny), -INFINITY),
+       std::nextafter (sum_u + (gamma * abs_u + tiny), +INFINITY)};
+
+    // Overflow and infinite boundaries
+    if (! std::isfinite (result.inf))
+      result.inf = -INFINITY;
+    if (! std::isfinite (result.sup))
+      result.sup = +INFINITY;
+    return normalize_zero (result);
+  }
+
+private:
+  double sum_l, sum_u, abs_l, abs_u;
+  octave_idx_type terms;
+  bool empty;
+
+  void add_bounds (const double l, const double u)
+  {
+    sum_l += l;
+    sum_u += u;
+    abs_l += std::abs (l);
+    abs_u += std::abs (u);
+    terms ++;
+  }
+
+  // Products 0 × ∞ are zero in interval arithmetic
+  static double product (const double x, const double y)
+  {
+    if (x == 0.0 || y == 0.0)
+      return 0.0;
+    return x * y;
+  }
+};
+
+// Compute expm (A / 2^L) ^ (2^L) for the n×n interval matrix A with
+// boundaries al and au.  The Taylor series of degree K is evaluated with
+// the Horner scheme, and the truncation error is bounded by
+//   rho = ||B||^(K + 1) / ((K + 1)! (1 - ||B|| / (K + 2))),
+// where ||B|| is the infinity norm of the scaled matrix B.  The squares are
+// computed without dependency errors in each single step.
+template <typename accumulator>
+void interval_expm (const octave_idx_type n,
+                    const double *al, const double *au,
+                    const int L, const int K,
+                    double *rl, double *ru)
+{
+  const octave_idx_type elements = n * n;
+
+  // Two workspaces, which are swapped after each step, and the transpose of
+  // the current matrix for contiguous access to its rows
+  std::vector <bare_interval> scaled (elements);
+  std::vector <bare_interval> work1 (elements), work2 (elements);
+  std::vector <bare_interval> transposed (elements);
+  bare_interval *current = &work1[0];
+  bare_interval *next = &work2[0];
+  double norm = 0.0;
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 16)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    accumulator accu;
+    const bare_interval zero = {0.0, 0.0};
+    const bare_interval one = {1.0, 1.0};
+    const bare_interval divisor = {std::ldexp (1.0, L), std::ldexp (1.0, L)};
+
+    // 1. Scale, transposed[p + i * n] = B(i, p), and start with I
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < n; i ++)
+      for (octave_idx_type p = 0; p < n; p ++)
+        {
+          const bare_interval a_ip = {al[i + p * n], au[i + p * n]};
+          scaled[p + i * n] = interval_rdivide (r, a_ip, divisor);
+          current[i + p * n] = (i == p) ? one : zero;
+        }
+
+    // 2. Horner scheme I + B / K * (... (I + B / 1 * I))
+    for (int k = K; k >= 1; k --)
+      {
+        const bare_interval k_interval = {(double) k, (double) k};
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type j = 0; j < n; j ++)
+          for (octave_idx_type i = 0; i < n; i ++)
+            {
+              accu.reset ();
+              for (octave_idx_type p = 0; p < n; p ++)
+                accu.add_product (scaled[p + i * n], current[p + j * n]);
+              bare_interval x = interval_rdivide (r, accu.result (),
+                                                  k_interval);
+              if (i == j)
+                x = interval_plus (r, x, one);
+              next[i + j * n] = x;
+            }
+#if defined (_OPENMP)
+        #pragma omp single
+#endif
+        std::swap (current, next);
+      }
+
+    // Truncation error of the series
+#if defined (_OPENMP)
+    #pragma omp single
+#endif
+    {
+      exact_accumulator row;
+      for (octave_idx_type i = 0; i < n; i ++)
+        {
+          row.reset ();
+          for (octave_idx_type p = 0; p < n; p ++)
+            row.add (interval_abs (scaled[p + i * n]));
+          norm = std::max (norm, row.result ().sup);
+        }
+    }
+    const bare_interval alpha = {norm, norm};
+    const double power = interval_pown (r, alpha, K + 1).sup;
+    double factorial = 1.0;
+    for (int k = 2; k <= K + 1; k ++)
+      factorial = r.binary (mpfr_mul, factorial, k, MPFR_RNDD);
+    const double quotient = r.binary (mpfr_div, norm, K + 2, MPFR_RNDU);
+    const double complement = r.binary (mpfr_sub, 1.0, quotient, MPFR_RNDD);
+    double rho;
+    if (complement <= 0.0)
+      rho = INFINITY;
+    else
+      rho = r.binary (mpfr_div, power,
+                      r.binary (mpfr_mul, factorial, complement, MPFR_RNDD),
+                      MPFR_RNDU);
+    const bare_interval truncation_error = {-rho, rho};
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < elements; i ++)
+      current[i] = interval_plus (r, current[i], truncation_error);
+
+    // 3. Squaring, where X(i, j) * X(i, i) + X(j, j) * X(i, j) is evaluated
+    // as X(i, j) * (X(i, i) + X(j, j)) and X(i, i) * X(i, i) as a square
+    for (int step = 0; step < L; step ++)
+      {
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type i = 0; i < n; i ++)
+          for (octave_idx_type p = 0; p < n; p ++)
+            transposed[p + i * n] = current[i + p * n];
+
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type j = 0; j < n; j ++)
+          for (octave_idx_type i = 0; i < n; i ++)
+            {
+              const bare_interval *row_i = &transposed[i * n];
+              const bare_interval *column_j = &current[j * n];
+              accu.reset ();
+              if (i == j)
+                accu.add_square (column_j[j]);
+              else
+                accu.add_product (row_i[j],
+                                  interval_plus (r, row_i[i], column_j[j]));
+              for (octave_idx_type p = 0; p < n; p ++)
+                if (p != i && p != j)
+                  accu.add_product (row_i[p], column_j[p]);
+              next[i + j * n] = accu.result ();
+            }
+#if defined (_OPENMP)
+        #pragma omp single
+#endif
+        std::swap (current, next);
+      }
+  }
+
+  for (octave_idx_type i = 0; i < elements; i ++)
+    {
+      rl[i] = current[i].inf;
+      ru[i] = current[i].sup;
+    }
+}
+
+DEFUN_DLD (__expm__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __expm__ (@var{AL}, @var{AU}, "
+  "@var{VALID})\n"
+  "\n"
+  "Compute an enclosure of the matrix exponential of the square interval "
+  "matrix with lower boundaries @var{AL} and upper boundaries @var{AU}."
+  "\n\n"
+  "The matrix is scaled by a power of two, the Taylor series is evaluated "
+  "with the Horner scheme and an enclosure of the truncation error, and the "
+  "result is squared.  All steps work on the same workspace and the matrix "
+  "products are computed in parallel if the package has been compiled with "
+  "OpenMP."
+  "\n\n"
+  "If @var{VALID} is false, the dot products are exact and rounded only "
+  "once.  Otherwise, the dot products are computed in floating-point "
+  "arithmetic and inflated by a priori error bounds, which is faster but "
+  "less accurate."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/expm}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 3)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const Matrix al = args (0).matrix_value ();
+  const Matrix au = args (1).matrix_value ();
+  const bool valid = args (2).bool_value ();
+  const octave_idx_type n = al.rows ();
+  if (al.columns () != n || au.rows () != n || au.columns () != n)
+    {
+      error ("__expm__: matrix is not square");
+      return octave_value_list ();
+    }
+
+  const double *l = al.data ();
+  const double *u = au.data ();
+  Matrix rl (n, n);
+  Matrix ru (n, n);
+
+  // An empty element makes the whole result empty.  Otherwise, choose L
+  // such that ||A|| / 2^L < 0.1 and 10 <= L <= 100, and choose K such that
+  // K + 2 > ||A|| and 10 <= K <= 170, where ||A|| is the lower bound of the
+  // infinity norm.
+  double norm = 0.0;
+  bool empty = false;
+  for (octave_idx_type i = 0; i < n; i ++)
+    {
+      double row = 0.0;
+      for (octave_idx_type j = 0; j < n; j ++)
+        {
+          const bare_interval a_ij = {l[i + j * n], u[i + j * n]};
+          empty |= is_empty (a_ij);
+          row += mig (a_ij);
+        }
+      norm = std::max (norm, row);
+    }
+  if (empty)
+    {
+      rl.fill (INFINITY);
+      ru.fill (-INFINITY);
+    }
+  else
+    {
+      const double log_norm = std::ceil (std::log2 (10.0 * norm));
+      const int L = (int) std::min (std::max (log_norm, 10.0), 100.0);
+      const int K = (int) std::min (std::max (std::ceil (norm - 2.0), 10.0),
+                                    170.0);
+      if (valid)
+        interval_expm <fast_accumulator> (n, l, u, L, K,
+                                          rl.fortran_vec (),
+                                          ru.fortran_vec ());
+      else
+        interval_expm <exact_accumulator> (n, l, u, L, K,
+                                           rl.fortran_vec (),
+                                           ru.fortran_vec ());
+    }
+
+  octave_value_list result;
+  result (0) = rl;
+  result (1) = ru;
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __expm__ ([0, 1; 0, -3], [0, 1; 0, -2], false);
+%! assert (l <= [1, 0.316738; 0, 0.0497871]);
+%! assert ([1, 0.432332; 0, 0.135335] <= u);
+%!test
+%! A = [1, 2; 3, 4] / 10;
+%! [l, u] = __expm__ (A, A, false);
+%! assert (l <= expm (A) & expm (A) <= u);
+%! assert (u - l < 1e-12);
+%!test
+%! A = [1, 2; 3, 4] / 10;
+%! [l1, u1] = __expm__ (A, A, true);
+%! [l2, u2] = __expm__ (A, A, false);
+%! assert (l1 <= l2 & u2 <= u1);
+%! assert (u1 - l1 < 1e-9);
+%!test
+%! [l, u] = __expm__ ([1, inf; 0, 1], [2, -inf; 0, 1], false);
+%! assert (l, inf (2, 2));
+%! assert (u, -inf (2, 2));
+%!error __expm__ (1, [1, 2], false)
+*/
@@ -0,0 +1,424 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <queue>
+#include <vector>
+#include "interval_tape.h"
+
+// Candidate box of the branch and bound algorithm
+struct candidate
+{
+  std::vector <bare_interval> box;
+  bare_interval fval;
+  long sequence;        // insertion order
+};
+
+// Order of the priority queue: The candidate with the smallest lower bound
+// of the function value comes first.  Among equal lower bounds, the most
+// recently inserted candidate comes first.
+struct candidate_order
+{
+  bool operator () (const candidate &a, const candidate &b) const
+  {
+    if (a.fval.inf != b.fval.inf)
+      return a.fval.inf > b.fval.inf;
+    return a.sequence < b.sequence;
+  }
+};
+
+// Evaluate the function for several boxes, in parallel if the function is
+// expensive.  For the last boxes k >= n - gradients, the gradient of the
+// function is computed as well.
+void evaluate_boxes (const interval_tape &tape, const octave_idx_type root,
+                     const std::vector <bare_interval> *boxes,
+                     bare_interval *fval,
+                     std::vector <bare_interval> *gradient,
+                     const int n, const int gradients, const bool parallel)
+{
+#if defined (_OPENMP)
+  #pragma omp parallel if (parallel)
+#endif
+  {
+    // Each thread uses its own MPFR variables and node values
+    directed_rounding r;
+    std::vector <bare_interval> value (tape.nodes.size ());
+    std::vector <bare_interval> node_gradient (tape.nodes.size ()
+                                               * tape.derivatives);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (int k = 0; k < n; k ++)
+      {
+        if (k < n - gradients)
+          tape.evaluate (r, value, 0, boxes[k].data ());
+        else
+          {
+            tape.evaluate_gradient (r, value, node_gradient, 0,
+                                    boxes[k].data ());
+            gradient[k].assign (node_gradient.begin ()
+                                + root * tape.derivatives,
+                                node_gradient.begin ()
+                                + (root + 1) * tape.derivatives);
+          }
+        fval[k] = value[root];
+      }
+  }
+}
+
+// Gradients, which are bounded everywhere in the box, imply that the
+// function is defined and Lipschitz continuous on the box
+bool is_bounded (const std::vector <bare_interval> &gradient)
+{
+  for (std::size_t j = 0; j < gradient.size (); j ++)
+    if (is_empty (gradient[j])
+        || gradient[j].inf == -INFINITY || gradient[j].sup == INFINITY)
+      return false;
+  return true;
+}
+
+// Intersect the function value fval over the box with the mean value form
+// f (m) + gradient * (box - m)
+bare_interval mean_value_form (directed_rounding &r,
+                               const std::vector <bare_interval> &box,
+                               const std::vector <bare_interval> &midpoint,
+                               const bare_interval fmid,
+                               const bare_interval fval,
+                               const std::vector <bare_interval> &gradient)
+{
+  if (is_empty (fmid) || is_empty (fval) || ! is_bounded (gradient))
+    return fval;
+
+  bare_interval result = fmid;
+  for (std::size_t j = 0; j < gradient.size (); j ++)
+    result = interval_plus (r, result,
+                            interval_times (r, gradient[j],
+                                            interval_minus (r, box[j],
+                                                            midpoint[j])));
+  result.inf = std::max (result.inf, fval.inf);
+  result.sup = std::min (result.sup, fval.sup);
+  if (is_empty (result))
+    return fval;
+  return normalize_zero (result);
+}
+
+// Monotonicity test: Where the function is strictly monotone in a
+// coordinate of the box, it can only attain its minimum at a face of the
+// initial box X0.  Returns false if the box contains no minimum, otherwise
+// the box is reduced to the face of X0.
+bool monotonicity_test (std::vector <bare_interval> &box,
+                        const std::vector <bare_interval> &gradient,
+                        const ColumnVector &x0_inf,
+                        const ColumnVector &x0_sup)
+{
+  if (! is_bounded (gradient))
+    return true;
+
+  for (std::size_t j = 0; j < gradient.size (); j ++)
+    {
+      if (gradient[j].inf > 0.0)
+        {
+          // Increasing, the minimum is at the lower boundary
+          if (box[j].inf != x0_inf(j))
+            return false;
+          if (std::isfinite (box[j].inf))
+            box[j].sup = box[j].inf;
+        }
+      else if (gradient[j].sup < 0.0)
+        {
+          // Decreasing, the minimum is at the upper boundary
+          if (box[j].sup != x0_sup(j))
+            return false;
+          if (std::isfinite (box[j].sup))
+            box[j].inf = box[j].sup;
+        }
+      box[j] = normalize_zero (box[j]);
+    }
+  return true;
+}
+
+// Midpoint of a box as a box of singletons
+void midpoint_box (directed_rounding &r,
+                   const std::vector <bare_interval> &box,
+                   std::vector <bare_interval> &midpoint)
+{
+  midpoint.resize (box.size ());
+  for (std::size_t k = 0; k < box.size (); k ++)
+    {
+      const double m = interval_mid (r, box[k]);
+      const bare_interval singleton = {m, m};
+      midpoint[k] = normalize_zero (singleton);
+    }
+}
+
+// Maximum width of the coordinates of a box and the first coordinate with
+// maximum width
+double max_wid (directed_rounding &r, const std::vector <bare_interval> &box,
+                octave_idx_type &coord)
+{
+  double result = NAN;
+  coord = 0;
+  for (std::size_t k = 0; k < box.size (); k ++)
+    {
+      const double w = interval_wid (r, box[k]);
+      if (std::isnan (result) || w > result)
+        {
+          result = w;
+          coord = k;
+        }
+    }
+  return result;
+}
+
+DEFUN_DLD (__fminsearch__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{XL}, @var{XU}, @var{FL}, @var{FU}, @var{F_UB}, "
+  "@var{ITER}, @var{CANCEL}] =} __fminsearch__ (@var{OP}, @var{ARG}, "
+  "@var{PARAM}, @var{INF}, @var{SUP}, @var{ROOT}, @var{XL}, @var{XU}, "
+  "@var{TOLFUN}, @var{TOLX}, @var{MAXITER}, @var{MAXFUNEVALS})\n"
+  "\n"
+  "Minimize the traced function of an intervaltape over the box "
+  "[@var{XL}, @var{XU}] with the Skelboe-Moore algorithm."
+  "\n\n"
+  "The function is given by the expression graph @var{OP}, @var{ARG}, "
+  "@var{PARAM}, @var{INF}, @var{SUP}, see @command{__eval_tape__}, with "
+  "scalar inputs and the scalar result at node @var{ROOT}.  Variable k of the "
+  "function is coordinate k of the box.  The algorithm is the same as in "
+  "@code{@@infsup/fminsearch}, but the candidate boxes are kept in a priority "
+  "queue, which is ordered by the lower bound of the function value.  The "
+  "function values of both halves of a bisected box and their midpoints are "
+  "evaluated at once, in parallel if the function is expensive and the "
+  "package has been compiled with OpenMP."
+  "\n\n"
+  "The gradient of the function is computed in forward mode together with "
+  "the function values of both halves.  The function values are improved "
+  "with the mean value form, and boxes, where the function is strictly "
+  "monotone, are discarded or reduced to a face of the initial box."
+  "\n\n"
+  "The result is the best candidate box [@var{XL}, @var{XU}] and its "
+  "function value [@var{FL}, @var{FU}].  @var{F_UB} is the rigorous upper "
+  "bound on the minimum, @var{ITER} is the number of iterations, and "
+  "@var{CANCEL} is true if the algorithm has been cancelled before the "
+  "desired accuracy has been reached."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@intervaltape/fminsearch}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 12)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  interval_tape tape;
+  if (! tape.read ("__fminsearch__", args, 0))
+    return octave_value_list ();
+  const Array <octave_idx_type> root_array =
+    args (5).octave_idx_type_vector_value (true);
+  if (root_array.numel () != 1)
+    {
+      error ("__fminsearch__: the function must be scalar");
+      return octave_value_list ();
+    }
+  if (! tape.mark ("__fminsearch__", root_array))
+    return octave_value_list ();
+  if (tape.dims.numel () != 1)
+    {
+      error ("__fminsearch__: inputs must be scalar");
+      return octave_value_list ();
+    }
+  const octave_idx_type root = root_array(0) - 1;
+
+  const ColumnVector x0_inf = args (6).column_vector_value ();
+  const ColumnVector x0_sup = args (7).column_vector_value ();
+  const double tolfun = args (8).double_value ();
+  const double tolx = args (9).double_value ();
+  const double max_iter = args (10).double_value ();
+  const double max_fun_evals = args (11).double_value ();
+
+  const octave_idx_type d = x0_inf.numel ();
+  if (x0_sup.numel () != d || tape.variables > d)
+    {
+      error ("__fminsearch__: box does not match the function's variables");
+      return octave_value_list ();
+    }
+
+  octave_idx_type needed = 0;
+  for (std::size_t k = 0; k < tape.nodes.size (); k ++)
+    needed += tape.nodes[k].needed;
+  const bool parallel = needed >= 1000;
+  tape.seed_variables ();
+
+  directed_rounding r;
+  candidate current;
+  current.box.resize (d);
+  for (octave_idx_type k = 0; k < d; k ++)
+    {
+      current.box[k].inf = x0_inf(k);
+      current.box[k].sup = x0_sup(k);
+    }
+
+  std::vector <bare_interval> boxes[4];
+  std::vector <bare_interval> gradient[4];
+
+  // 1 Rigorous upper bound on the minimum of f over X
+  bare_interval fval[4];
+  midpoint_box (r, current.box, boxes[0]);
+  evaluate_boxes (tape, root, boxes, fval, gradient, 1, 0, false);
+  double f_ub = is_empty (fval[0]) ? INFINITY : fval[0].sup;
+
+  // 3 Initialize queues
+  // C: Best completed box, where accuracy has been reached
+  // L: Boxes where accuracy has not been reached yet
+  bool has_completed = false;
+  candidate completed;
+  std::priority_queue <candidate, std::vector <candidate>,
+                       candidate_order> work;
+  long sequence = 0;
+
+  double iter = 0.0;
+  double feval_count = 1.0;
+  bool cancel_algorithm = false;
+  while (true)
+    {
+      iter ++;
+
+      // 4 Bisect X at the coordinate i with the widest interval
+      octave_idx_type i;
+      max_wid (r, current.box, i);
+      candidate half1, half2;
+      half1.box = half2.box = current.box;
+      const double m = interval_bisection_point (r, current.box[i]);
+      half1.box[i].sup = m;
+      half2.box[i].inf = m == 0.0 ? -0.0 : m;
+
+      // 5 Improve upper bound and 6 evaluate the function on both halves
+      midpoint_box (r, half1.box, boxes[0]);
+      midpoint_box (r, half2.box, boxes[1]);
+      boxes[2] = half1.box;
+      boxes[3] = half2.box;
+      evaluate_boxes (tape, root, boxes, fval, gradient, 4, 2, parallel);
+      if (! is_empty (fval[0]))
+        f_ub = std::min (f_ub, fval[0].sup);
+      if (! is_empty (fval[1]))
+        f_ub = std::min (f_ub, fval[1].sup);
+      half1.fval = mean_value_form (r, half1.box, boxes[0], fval[0], fval[2],
+                                    gradient[2]);
+      half2.fval = mean_value_form (r, half2.box, boxes[1], fval[1], fval[3],
+                                    gradient[3]);
+      feval_count += 4;
+
+      cancel_algorithm = feval_count >= max_fun_evals
+                         || iter >= max_iter
+                         || f_ub <= -std::numeric_limits <double>::max ();
+
+      octave_idx_type coord;
+      const double half1_wid = max_wid (r, half1.box, coord);
+      if (std::min (f_ub, std::max (half1.fval.sup, half2.fval.sup))
+          - std::min (half1.fval.inf, half2.fval.inf) < tolfun
+          || half1_wid < tolx
+          || cancel_algorithm)
+        {
+          // Accuracy has been reached for X1 and X2
+          if (! has_completed || half1.fval.inf < completed.fval.inf)
+            {
+              completed = half1;
+              has_completed = true;
+            }
+          if (half2.fval.inf < completed.fval.inf)
+            completed = half2;
+        }
+      else
+        {
+          // Put intervals into work queue
+          if (half1.fval.inf < f_ub
+              && monotonicity_test (half1.box, gradient[2], x0_inf, x0_sup))
+            {
+              half1.sequence = sequence ++;
+              work.push (half1);
+            }
+          if (half2.fval.inf < f_ub
+              && monotonicity_test (half2.box, gradient[3], x0_inf, x0_sup))
+            {
+              half2.sequence = sequence ++;
+              work.push (half2);
+            }
+        }
+
+      // More refinement to do on other boxes?
+      if (work.empty () || cancel_algorithm)
+        break;
+      // (i) Use next item from L
+      current = work.top ();
+      work.pop ();
+      // (ii) Check whether improvement is still possible
+      if (current.fval.inf > f_ub)
+        break;
+    }
+
+  if (! has_completed)
+    {
+      error ("__fminsearch__: no candidate box");
+      return octave_value_list ();
+    }
+
+  ColumnVector xl (d);
+  ColumnVector xu (d);
+  for (octave_idx_type k = 0; k < d; k ++)
+    {
+      xl(k) = completed.box[k].inf;
+      xu(k) = completed.box[k].sup;
+    }
+
+  octave_value_list result;
+  result (0) = xl;
+  result (1) = xu;
+  result (2) = completed.fval.inf;
+  result (3) = completed.fval.sup;
+  result (4) = f_ub;
+  result (5) = iter;
+  result (6) = cancel_algorithm;
+  return result;
+}
+
+/*
+%!test
+%! ## (x - 1)^2 over [-2, 2]
+%! [xl, xu, fl, fu, f_ub, iter, cancel] = __fminsearch__ ({"variable"; "input"; "minus"; "pown"}, [0, 0; 0, 0; 1, 2; 3, 0], [1; 0; 0; 2], {[]; 1; []; []}, {[]; 1; []; []}, 4, -2, 2, 1e-4, 1e-10, 1000, 3000);
+%! assert (xl <= 1 && 1 <= xu);
+%! assert (fl <= 0 && 0 <= f_ub);
+%! assert (f_ub < 1e-4);
+%! assert (not (cancel));
+%!test
+%! [~, ~, ~, ~, ~, iter, cancel] = __fminsearch__ ({"variable"; "sin"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, 0, 10, 0, 0, 5, 3000);
+%! assert (iter, 5);
+%! assert (cancel);
+%!test
+%! ## Strictly increasing function, the minimum is at the boundary
+%! [xl, xu, fl, fu, f_ub, iter] = __fminsearch__ ({"variable"; "exp"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, 1, 5, 1e-10, -inf, 1000, 3000);
+%! assert (xl, 1);
+%! assert (fl <= exp (1) && exp (1) <= f_ub);
+%! assert (iter < 10);
+%!error __fminsearch__ ({"variable"}, [0, 0], 2, {[]}, {[]}, 1, 0, 1, 1e-4, 0, 10, 10)
+*/
@@ -0,0 +1,186 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <vector>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__fzero__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{CL}, @var{CU}, @var{PARENT}] =} __fzero__ (@var{L}, "
+  "@var{U})\n"
+  "@deftypefnx {} {[@var{CL}, @var{CU}, @var{PARENT}] =} __fzero__ (@var{L}, "
+  "@var{U}, @var{M}, @var{FML}, @var{FMU}, @var{DL}, @var{DU})\n"
+  "\n"
+  "Compute one step of the interval newton method or bisection for a list "
+  "of intervals."
+  "\n\n"
+  "The column vectors @var{L} and @var{U} contain the boundaries of N "
+  "intervals x, which may contain roots of a function f.  With the function "
+  "values [@var{FML}, @var{FMU}] at the points @var{M} in x and the "
+  "derivatives [@var{DL}, @var{DU}] of f over x, each interval is "
+  "contracted with the interval newton step x ∩ (m - f(m) / f'(x)), where "
+  "the two-output division may split x into two intervals.  If the newton "
+  "step doesn't split x, or if no derivative is given, the result is "
+  "bisected like with @code{bisect}."
+  "\n\n"
+  "The resulting intervals are stored in ascending order in the column "
+  "vectors @var{CL} and @var{CU}, and @var{PARENT} contains the (one-based) "
+  "index of the interval, from which each result stems.  Empty results are "
+  "omitted.  The intervals are processed in parallel if the package has "
+  "been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/fzero}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 2 && nargin != 7)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const ColumnVector l = args (0).column_vector_value ();
+  const ColumnVector u = args (1).column_vector_value ();
+  const octave_idx_type n = l.numel ();
+  const bool newton = nargin == 7;
+  ColumnVector m, fml, fmu, dl, du;
+  if (newton)
+    {
+      m = args (2).column_vector_value ();
+      fml = args (3).column_vector_value ();
+      fmu = args (4).column_vector_value ();
+      dl = args (5).column_vector_value ();
+      du = args (6).column_vector_value ();
+    }
+  if (u.numel () != n
+      || (newton && (m.numel () != n || fml.numel () != n
+                     || fmu.numel () != n || dl.numel () != n
+                     || du.numel () != n)))
+    {
+      error ("__fzero__: inconsistent interval boundaries");
+      return octave_value_list ();
+    }
+
+  // Up to two results per interval
+  std::vector <bare_interval> child (2 * n);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < n; i ++)
+      {
+        const bare_interval x = {l(i), u(i)};
+        bare_interval a = x;
+        bare_interval b = empty_interval ();
+        if (newton)
+          {
+            // Newton step with the two-output division
+            const bare_interval mid = {m(i), m(i)};
+            const bare_interval fm = {fml(i), fmu(i)};
+            const bare_interval dfx = {dl(i), du(i)};
+            bare_interval q1, q2;
+            interval_mulrev_pair (r, dfx, fm, q1, q2);
+            if (! is_empty (q1) || ! is_empty (q2))
+              {
+                // Otherwise, the function has been evaluated outside of its
+                // domain
+                a = interval_intersect (x, interval_minus (r, mid, q1));
+                b = interval_intersect (x, interval_minus (r, mid, q2));
+                if (is_empty (a))
+                  std::swap (a, b);
+              }
+          }
+
+        const bool unchanged = a.inf == x.inf && a.sup == x.sup;
+        if ((unchanged || is_empty (b)) && a.inf < a.sup)
+          {
+            // Bisect, if the newton step did not produce two intervals
+            const double split = interval_bisection_point (r, a);
+            b = normalize_zero ({split, a.sup});
+            a = normalize_zero ({a.inf, split});
+          }
+        else if (b.inf < a.inf && b.sup < a.sup)
+          std::swap (a, b);
+
+        child[2 * i] = a;
+        child[2 * i + 1] = b;
+      }
+  }
+
+  octave_idx_type count = 0;
+  for (octave_idx_type k = 0; k < 2 * n; k ++)
+    count += ! is_empty (child[k]);
+
+  ColumnVector cl (count);
+  ColumnVector cu (count);
+  ColumnVector parent (count);
+  octave_idx_type j = 0;
+  for (octave_idx_type k = 0; k < 2 * n; k ++)
+    if (! is_empty (child[k]))
+      {
+        cl(j) = child[k].inf;
+        cu(j) = child[k].sup;
+        parent(j) = k / 2 + 1;
+        j ++;
+      }
+
+  octave_value_list result;
+  result (0) = cl;
+  result (1) = cu;
+  result (2) = parent;
+  return result;
+}
+
+/*
+%!test
+%! [cl, cu, parent] = __fzero__ ([2; -1], [32; 1]);
+%! assert (cl, [2; 8; -1; 0]);
+%! assert (cu, [8; 32; 0; 1]);
+%! assert (parent, [1; 1; 2; 2]);
+%!test
+%! ## x^2 - 2 on [1, 2] with m = 1.5, newton step contracts the interval
+%! ## and the result is bisected
+%! [cl, cu, parent] = __fzero__ (1, 2, 1.5, 0.25, 0.25, 2, 4);
+%! assert (cl(1), 1.375);
+%! assert (cu(2), 1.4375);
+%! assert (cu(1), cl(2));
+%! assert (parent, [1; 1]);
+%!test
+%! ## x^2 - 1 on [-2, 2] with m = 0, the newton step yields two intervals
+%! [cl, cu, parent] = __fzero__ (-2, 2, 0, -1, -1, -4, 4);
+%! assert (cl, [-2; 0.25]);
+%! assert (cu, [-0.25; 2]);
+%! assert (parent, [1; 1]);
+%!test
+%! ## No root
+%! [cl, cu] = __fzero__ (1, 2, 1.5, 1, 1, 1, 1);
+%! assert (isempty (cl) && isempty (cu));
+%!error __fzero__ ([1; 2], 3)
+*/
@@ -0,0 +1,217 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <vector>
+#include "interval_tape.h"
+
+DEFUN_DLD (__hc4__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}, @var{FL}, @var{FU}] =} __hc4__ "
+  "(@var{OP}, @var{ARG}, @var{PARAM}, @var{INF}, @var{SUP}, @var{ROOT}, "
+  "@var{XL}, @var{XU}, @var{YL}, @var{YU})\n"
+  "\n"
+  "Contract interval boxes to the solutions of f(x) ∈ [@var{YL}, @var{YU}] "
+  "with the forward-backward contractor HC4Revise."
+  "\n\n"
+  "The function f is given by the expression graph @var{OP}, @var{ARG}, "
+  "@var{PARAM}, @var{INF}, @var{SUP}, see @command{__eval_tape__}, with "
+  "scalar inputs and the R results at the nodes @var{ROOT}.  The d×Q "
+  "matrices @var{XL} and @var{XU} contain the boundaries of Q boxes, one box "
+  "per column, and variable k of the function is coordinate k of the box.  "
+  "The codomain has either R elements or a single element, which is "
+  "broadcasted."
+  "\n\n"
+  "For each box, the graph is evaluated in a forward pass and the values of "
+  "the roots are intersected with the codomain.  In a backward pass in "
+  "reverse topological order, the arguments of each node are intersected "
+  "with the reverse operation of the node, see for example "
+  "@code{@@infsup/mulrev}.  The values of the variable nodes yield the "
+  "contracted box [@var{L}, @var{U}].  Boxes without solutions become empty, "
+  "that is, columns of @code{inf} and @code{-inf}.  The R×Q matrices "
+  "@var{FL} and @var{FU} contain the function values of the contracted "
+  "boxes.  The boxes are processed in parallel if the package has been "
+  "compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@intervaltape/contract}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 10)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  interval_tape tape;
+  if (! tape.read ("__hc4__", args, 0))
+    return octave_value_list ();
+  const Array <octave_idx_type> root =
+    args (5).octave_idx_type_vector_value (true);
+  if (! tape.mark ("__hc4__", root))
+    return octave_value_list ();
+  if (tape.dims.numel () != 1)
+    {
+      error ("__hc4__: inputs must be scalar");
+      return octave_value_list ();
+    }
+
+  const Matrix xl = args (6).matrix_value ();
+  const Matrix xu = args (7).matrix_value ();
+  const NDArray yl = args (8).array_value ();
+  const NDArray yu = args (9).array_value ();
+
+  const octave_idx_type d = xl.rows ();
+  const octave_idx_type q = xl.columns ();
+  const octave_idx_type roots = root.numel ();
+  if (xu.dims () != xl.dims () || yu.numel () != yl.numel ())
+    {
+      error ("__hc4__: inconsistent interval boundaries");
+      return octave_value_list ();
+    }
+  if (tape.variables > d)
+    {
+      error ("__hc4__: box does not match the function's variables");
+      return octave_value_list ();
+    }
+  if (yl.numel () != roots && yl.numel () != 1)
+    {
+      error ("__hc4__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  std::vector <bare_interval> y (yl.numel ());
+  for (octave_idx_type j = 0; j < yl.numel (); j ++)
+    {
+      y[j].inf = yl(j);
+      y[j].sup = yu(j);
+    }
+
+  octave_idx_type needed = 0;
+  for (std::size_t k = 0; k < tape.nodes.size (); k ++)
+    needed += tape.nodes[k].needed;
+
+  Matrix l (d, q);
+  Matrix u (d, q);
+  Matrix fl (roots, q);
+  Matrix fu (roots, q);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (q * needed >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables and node values
+    directed_rounding r;
+    std::vector <bare_interval> value (tape.nodes.size ());
+    std::vector <bare_interval> box (d);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type j = 0; j < q; j ++)
+      {
+        for (octave_idx_type k = 0; k < d; k ++)
+          {
+            box[k].inf = xl(k, j);
+            box[k].sup = xu(k, j);
+          }
+
+        bool nonempty = true;
+        for (octave_idx_type k = 0; k < d; k ++)
+          nonempty &= ! is_empty (box[k]);
+        if (nonempty && tape.contract (r, value, root, y, box.data ()))
+          {
+            // Function value of the contracted box
+            tape.evaluate (r, value, 0, box.data ());
+            for (octave_idx_type k = 0; k < d; k ++)
+              {
+                l(k, j) = box[k].inf;
+                u(k, j) = box[k].sup;
+              }
+            for (octave_idx_type i = 0; i < roots; i ++)
+              {
+                fl(i, j) = value[root(i) - 1].inf;
+                fu(i, j) = value[root(i) - 1].sup;
+              }
+          }
+        else
+          {
+            for (octave_idx_type k = 0; k < d; k ++)
+              {
+                l(k, j) = INFINITY;
+                u(k, j) = -INFINITY;
+              }
+            for (octave_idx_type i = 0; i < roots; i ++)
+              {
+                fl(i, j) = INFINITY;
+                fu(i, j) = -INFINITY;
+              }
+          }
+      }
+  }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = fl;
+  result (3) = fu;
+  return result;
+}
+
+/*
+%!test
+%! ## x^2 = [1, 4] with x in [-10, 1.5]
+%! [l, u, fl, fu] = __hc4__ ({"variable"; "sqr"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, -10, 1.5, 1, 4);
+%! assert ([l, u], [-2, 1.5]);
+%! assert ([fl, fu], [0, 4]);
+%!test
+%! ## x + y = 1 and x - y = 0 on [0, 1]^2, two boxes
+%! [l, u] = __hc4__ ({"variable"; "variable"; "plus"; "minus"}, [0, 0; 0, 0; 1, 2; 1, 2], [1; 2; 0; 0], {[]; []; []; []}, {[]; []; []; []}, [3; 4], [0, 0.75; 0, 0], [1, 1; 1, 1], [1; 0], [1; 0]);
+%! assert (l(:, 1), [0; 0]);
+%! assert (u(:, 1), [1; 1]);
+%! assert (l(:, 2), [inf; inf]);
+%! assert (u(:, 2), [-inf; -inf]);
+%!test
+%! ## exp (x) = 2 yields log (2)
+%! [l, u] = __hc4__ ({"variable"; "exp"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, -inf, inf, 2, 2);
+%! assert (l <= log (2) && log (2) <= u);
+%! assert (u - l <= 2 * eps);
+%!test
+%! ## x * y = 1 with x in [1, 2] and y in [-1, 4]
+%! [l, u] = __hc4__ ({"variable"; "variable"; "times"}, [0, 0; 0, 0; 1, 2], [1; 2; 0], {[]; []; []}, {[]; []; []}, 3, [1; -1], [2; 4], 1, 1);
+%! assert (l, [1; 0.5]);
+%! assert (u, [2; 1]);
+%!test
+%! ## sin (x) = 1 with x in [0, 10] yields pi / 2 ... 5 pi / 2
+%! [l, u] = __hc4__ ({"variable"; "sin"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, 0, 10, 1, 1);
+%! assert (l, pi / 2, 4 * eps);
+%! assert (u, 5 * pi / 2, 16 * eps);
+%!test
+%! ## cos (x) = 2 has no solution
+%! [l, u] = __hc4__ ({"variable"; "cos"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, 0, 10, 2, 2);
+%! assert ([l, u], [inf, -inf]);
+%!test
+%! ## cos (x) = 0.5 with x in [1.1, 5.2] has no solution (pi / 3, 5 pi / 3)
+%! [l, u] = __hc4__ ({"variable"; "cos"}, [0, 0; 1, 0], [1; 0], {[]; []}, {[]; []}, 2, 1.1, 5.2, 0.5, 0.5);
+%! assert ([l, u], [inf, -inf]);
+%!error __hc4__ ({"variable"}, [0, 0], 1, {[]}, {[]}, 1, [0, 1], [1, 2], [0; 1], [0; 1])
+*/
@@ -0,0 +1,1167 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+// PKG_ADD: __infsup__ ();
+
+#include <octave/oct.h>
+#include <octave/ov-base.h>
+#include <octave/ov-class.h>
+#include <octave/ov-typeinfo.h>
+#include <cstdlib>
+#include <iomanip>
+#include <istream>
+#include <list>
+#include <ostream>
+#include <string>
+#include "interval_kernels.h"
+
+#if (OCTAVE_MAJOR_VERSION > 4 || (OCTAVE_MAJOR_VERSION == 4 && OCTAVE_MINOR_VERSION >= 4))
+#  define INTERVAL_TYPE_INFO_IN_INTERPRETER 1
+#  include <octave/interpreter.h>
+// Operators are installed into the type_info object of the interpreter since
+// Octave 4.4, and into the static octave_value_typeinfo before.
+#  define INSTALL_INFSUP_UNOP(op, t, f) \
+     ti.install_unary_op (octave_value::op, t::static_type_id (), f)
+#  define INSTALL_INFSUP_BINOP(op, t1, t2, f) \
+     ti.install_binary_op (octave_value::op, t1::static_type_id (), \
+                           t2::static_type_id (), f)
+#  define INSTALL_INFSUP_CATOP(t1, t2, f) \
+     ti.install_cat_op (t1::static_type_id (), t2::static_type_id (), f)
+#  define INSTALL_INFSUP_ASSIGNCONV(t1, t2, f) \
+     ti.install_pref_assign_conv (t1::static_type_id (), \
+                                  t2::static_type_id (), \
+                                  t2::static_type_id ()); \
+     ti.install_widening_op (t1::static_type_id (), t2::static_type_id (), f)
+#else
+#  define INSTALL_INFSUP_UNOP(op, t, f) \
+     octave_value_typeinfo::register_unary_op (octave_value::op, \
+                                               t::static_type_id (), f)
+#  define INSTALL_INFSUP_BINOP(op, t1, t2, f) \
+     octave_value_typeinfo::register_binary_op (octave_value::op, \
+                                                t1::static_type_id (), \
+                                                t2::static_type_id (), f)
+#  define INSTALL_INFSUP_CATOP(t1, t2, f) \
+     octave_value_typeinfo::register_cat_op (t1::static_type_id (), \
+                                             t2::static_type_id (), f)
+#  define INSTALL_INFSUP_ASSIGNCONV(t1, t2, f) \
+     octave_value_typeinfo::register_pref_assign_conv \
+       (t1::static_type_id (), t2::static_type_id (), \
+        t2::static_type_id ()); \
+     octave_value_typeinfo::register_widening_op (t1::static_type_id (), \
+                                                  t2::static_type_id (), f)
+#endif
+
+// The function, which is being evaluated, is tracked by the evaluator since
+// Octave 6, by the call stack of the interpreter since Octave 4.4, and by the
+// static octave_call_stack before.
+#if (OCTAVE_MAJOR_VERSION >= 6)
+#  include <octave/pt-eval.h>
+#  define CURRENT_FUNCTION() \
+     octave::interpreter::the_interpreter ()->get_evaluator () \
+       .current_function ()
+#elif defined (INTERVAL_TYPE_INFO_IN_INTERPRETER)
+#  include <octave/call-stack.h>
+#  define CURRENT_FUNCTION() \
+     octave::interpreter::the_interpreter ()->get_call_stack ().current ()
+#else
+#  include <octave/call-stack.h>
+#  define CURRENT_FUNCTION() octave_call_stack::current ()
+#endif
+
+#if defined (INTERVAL_TYPE_INFO_IN_INTERPRETER)
+typedef octave::mach_info::float_format binary_float_format;
+#else
+typedef oct_mach_info::float_format binary_float_format;
+#endif
+
+// Bare interval array, which is stored natively as the arrays of its lower
+// and upper boundaries.
+//
+// The value has the class name "infsup", thus all methods in @infsup apply to
+// it.  The boundaries are accessible as the fields x.inf and x.sup, like in the
+// old-style class object, so that the m-file implementations keep working
+// without changes.  Indexing, concatenation, size queries, and the core
+// arithmetic operators are evaluated natively.  Other operators are evaluated
+// by the respective methods of the class.
+class octave_infsup : public octave_base_value
+{
+public:
+
+  octave_infsup ()
+    : octave_base_value (),
+      m_inf (dim_vector (1, 1), INFINITY),
+      m_sup (dim_vector (1, 1), -INFINITY)
+  { }
+
+  octave_infsup (const NDArray &l, const NDArray &u)
+    : octave_base_value (), m_inf (l), m_sup (u)
+  { }
+
+  octave_infsup (const octave_infsup &x)
+    : octave_base_value (), m_inf (x.m_inf), m_sup (x.m_sup)
+  { }
+
+  octave_base_value *clone () const
+  {
+    return new octave_infsup (*this);
+  }
+
+  octave_base_value *empty_clone () const
+  {
+    return new octave_infsup (NDArray (dim_vector (0, 0)),
+                              NDArray (dim_vector (0, 0)));
+  }
+
+  const NDArray &inf_array () const { return m_inf; }
+  const NDArray &sup_array () const { return m_sup; }
+
+  dim_vector dims () const { return m_inf.dims (); }
+
+  // The assignments x.inf = ... and x.sup = ... refer to a single field,
+  // regardless of the number of intervals in x.
+  octave_idx_type xnumel (const octave_value_list &idx)
+  {
+    if (idx.length () == 0)
+      return 1;
+    return octave_base_value::xnumel (idx);
+  }
+
+  size_t byte_size () const
+  {
+    return m_inf.byte_size () + m_sup.byte_size ();
+  }
+
+  bool is_defined () const { return true; }
+
+  bool is_constant () const { return true; }
+
+  octave_value subsref (const std::string &type,
+                        const std::list<octave_value_list> &idx);
+
+  octave_value_list subsref (const std::string &type,
+                             const std::list<octave_value_list> &idx,
+                             int)
+  {
+    return subsref (type, idx);
+  }
+
+  octave_value do_index_op (const octave_value_list &idx,
+                            bool resize_ok = false);
+
+  octave_value subsasgn (const std::string &type,
+                         const std::list<octave_value_list> &idx,
+                         const octave_value &rhs);
+
+  octave_value resize (const dim_vector &dv, bool = false) const
+  {
+    NDArray l (m_inf), u (m_sup);
+    l.resize (dv, -0.0);
+    u.resize (dv, +0.0);
+    return octave_value (new octave_infsup (l, u));
+  }
+
+  octave_value reshape (const dim_vector &dv) const
+  {
+    return octave_value (new octave_infsup (NDArray (m_inf.reshape (dv)),
+                                            NDArray (m_sup.reshape (dv))));
+  }
+
+  octave_value permute (const Array<int> &vec, bool inv = false) const
+  {
+    return octave_value (
+      new octave_infsup (NDArray (m_inf.permute (vec, inv)),
+                         NDArray (m_sup.permute (vec, inv))));
+  }
+
+  octave_value squeeze () const
+  {
+    return octave_value (new octave_infsup (NDArray (m_inf.squeeze ()),
+                                            NDArray (m_sup.squeeze ())));
+  }
+
+  // The fields of the old-style class object, which are used by the
+  // inheriting infsupdec class and by the oct-files of the package
+  octave_map map_value () const
+  {
+    return octave_map (scalar_map_value ());
+  }
+
+  octave_scalar_map scalar_map_value () const
+  {
+    octave_scalar_map fields;
+    fields.assign ("inf", m_inf);
+    fields.assign ("sup", m_sup);
+    return fields;
+  }
+
+  // The value can be the parent object of an infsupdec object
+  bool is_instance_of (const std::string &cls_name) const
+  {
+    return cls_name == "infsup";
+  }
+
+  octave_base_value *find_parent_class (const std::string &parent_class_name)
+  {
+    return parent_class_name == "infsup" ? this : 0;
+  }
+
+  octave_base_value *unique_parent_class (const std::string &parent_class_name)
+  {
+    return parent_class_name == "infsup" ? this : 0;
+  }
+
+  void assign (const std::string &key, const octave_value &rhs)
+  {
+    field (key) = rhs.array_value ();
+  }
+
+  // Old-style class object with the same boundaries
+  octave_value class_object () const
+  {
+    return octave_value (new octave_class (map_value (), "infsup",
+                                           std::list<std::string> ()));
+  }
+
+  type_conv_info numeric_conversion_function () const;
+
+  bool print_as_scalar () const { return dims ().numel () == 1; }
+
+  void print (std::ostream &os, bool pr_as_read_syntax = false)
+  {
+    print_raw (os, pr_as_read_syntax);
+  }
+
+  // The disp method of the class formats the intervals, including the
+  // trailing newline
+  void print_raw (std::ostream &os, bool = false) const
+  {
+    octave_value_list args (1, octave_value (clone ()));
+    os << octave::feval ("disp", args, 1) (0).string_value ();
+  }
+
+  bool save_ascii (std::ostream &os);
+
+  bool load_ascii (std::istream &is);
+
+  bool save_binary (std::ostream &os, bool save_as_floats);
+
+  bool load_binary (std::istream &is, bool swap, binary_float_format fmt);
+
+  bool save_hdf5 (octave_hdf5_id loc_id, const char *name,
+                  bool save_as_floats);
+
+  bool load_hdf5 (octave_hdf5_id loc_id, const char *name);
+
+private:
+
+  NDArray &field (const std::string &key)
+  {
+    if (key == "inf")
+      return m_inf;
+    if (key == "sup")
+      return m_sup;
+    error ("interval property '%s' is unknown", key.c_str ());
+    return m_inf;
+  }
+
+  // The boundaries are saved in the binary and HDF5 formats like a scalar
+  // structure with the fields inf and sup
+  octave_value boundary_struct () const
+  {
+    octave_scalar_map fields;
+    fields.assign ("inf", m_inf);
+    fields.assign ("sup", m_sup);
+    return octave_value (fields);
+  }
+
+  bool load_boundary_struct (const octave_value &s)
+  {
+    const octave_scalar_map fields = s.scalar_map_value ();
+    const NDArray l = fields.getfield ("inf").array_value ();
+    const NDArray u = fields.getfield ("sup").array_value ();
+    if (l.dims () != u.dims ())
+      return false;
+    m_inf = l;
+    m_sup = u;
+    return true;
+  }
+
+  NDArray m_inf;
+  NDArray m_sup;
+
+  DECLARE_OV_TYPEID_FUNCTIONS_AND_DATA
+};
+
+DEFINE_OV_TYPEID_FUNCTIONS_AND_DATA (octave_infsup, "infsup", "infsup");
+
+// Operators and functions, which are not implemented natively, are evaluated
+// by the methods of the old-style class
+static octave_base_value *
+infsup_to_class_object (const octave_base_value &a)
+{
+  const octave_infsup &x = dynamic_cast<const octave_infsup &> (a);
+  return new octave_class (x.map_value (), "infsup",
+                           std::list<std::string> ());
+}
+
+octave_base_value::type_conv_info
+octave_infsup::numeric_conversion_function () const
+{
+  return octave_base_value::type_conv_info (infsup_to_class_object,
+                                            octave_class::static_type_id ());
+}
+
+// Subscript structure S, which is passed to the subsasgn method
+static octave_value
+subscript_struct (const std::string &type,
+                  const std::list<octave_value_list> &idx)
+{
+  const octave_idx_type n = type.length ();
+  Cell types (dim_vector (1, n));
+  Cell subs (dim_vector (1, n));
+  std::list<octave_value_list>::const_iterator p = idx.begin ();
+  for (octave_idx_type k = 0; k < n; k ++, p ++)
+    switch (type[k])
+      {
+      case '(':
+        types (k) = "()";
+        subs (k) = Cell (*p);
+        break;
+      case '{':
+        types (k) = "{}";
+        subs (k) = Cell (*p);
+        break;
+      case '.':
+        types (k) = ".";
+        subs (k) = (*p) (0);
+        break;
+      }
+
+  octave_map s (dim_vector (1, n));
+  s.assign ("type", types);
+  s.assign ("subs", subs);
+  return s;
+}
+
+// Boundaries of an interval operand.  Real numbers are converted into
+// singleton intervals.  Other values are converted by the infsup constructor,
+// which also issues the warnings for illegal interval boundaries.
+static void
+interval_operand (const octave_base_value &a, NDArray &l, NDArray &u)
+{
+  if (a.type_id () == octave_infsup::static_type_id ())
+    {
+      const octave_infsup &x = dynamic_cast<const octave_infsup &> (a);
+      l = x.inf_array ();
+      u = x.sup_array ();
+      return;
+    }
+
+  if (a.is_real_scalar () || a.is_real_matrix ())
+    {
+      l = a.array_value ();
+      if (l.all_finite ())
+        {
+          u = l;
+          double *l_data = l.fortran_vec ();
+          double *u_data = u.fortran_vec ();
+          for (octave_idx_type i = 0; i < l.numel (); i ++)
+            if (l_data[i] == 0.0)
+              {
+                l_data[i] = -0.0;
+                u_data[i] = +0.0;
+              }
+          return;
+        }
+    }
+
+  const octave_value_list args (1, octave_value (a.clone ()));
+  const octave_scalar_map x =
+    octave::feval ("infsup", args, 1) (0).scalar_map_value ();
+  l = x.getfield ("inf").array_value ();
+  u = x.getfield ("sup").array_value ();
+}
+
+octave_value
+octave_infsup::subsref (const std::string &type,
+                        const std::list<octave_value_list> &idx)
+{
+  octave_value retval;
+  switch (type[0])
+    {
+    case '(':
+      retval = do_index_op (idx.front ());
+      break;
+
+    case '{':
+      error ("interval cannot be indexed with {}");
+      return octave_value ();
+
+    case '.':
+      {
+        const std::string key = idx.front () (0).string_value ();
+        if (key == "inf")
+          retval = m_inf;
+        else if (key == "sup")
+          retval = m_sup;
+        else
+          // Other interval properties are evaluated by the subsref method
+          return class_object ().subsref (type, idx);
+      }
+      break;
+
+    default:
+      error ("invalid subscript type");
+      return octave_value ();
+    }
+
+  return retval.next_subsref (type, idx);
+}
+
+octave_value
+octave_infsup::do_index_op (const octave_value_list &idx, bool resize_ok)
+{
+  // New elements are filled with [0], like in indexed assignments
+  const octave_idx_type n = idx.length ();
+  NDArray l, u;
+  switch (n)
+    {
+    case 0:
+      return octave_value (clone ());
+
+    case 1:
+      {
+        const index_vector_type i = idx (0).index_vector ();
+        l = NDArray (m_inf.index (i, resize_ok, -0.0));
+        u = NDArray (m_sup.index (i, resize_ok, +0.0));
+      }
+      break;
+
+    case 2:
+      {
+        const index_vector_type i = idx (0).index_vector ();
+        const index_vector_type j = idx (1).index_vector ();
+        l = NDArray (m_inf.index (i, j, resize_ok, -0.0));
+        u = NDArray (m_sup.index (i, j, resize_ok, +0.0));
+      }
+      break;
+
+    default:
+      {
+        Array<index_vector_type> ia (dim_vector (n, 1));
+        for (octave_idx_type k = 0; k < n; k ++)
+          ia (k) = idx (k).index_vector ();
+        l = NDArray (m_inf.index (ia, resize_ok, -0.0));
+        u = NDArray (m_sup.index (ia, resize_ok, +0.0));
+      }
+      break;
+    }
+
+  return octave_value (new octave_infsup (l, u));
+}
+
+// Whether the function, which is being evaluated, is a method of the class.
+// This is the same test as for the fields of old-style class objects.
+static bool
+in_class_method ()
+{
+  const octave_function *fcn = CURRENT_FUNCTION ();
+  return fcn != NULL
+         && (fcn->is_class_method ()
+             || fcn->is_class_constructor ()
+             || fcn->is_anonymous_function_of_class ()
+             || fcn->is_private_function_of_class ("infsup"))
+         && fcn->dispatch_class () == "infsup";
+}
+
+octave_value
+octave_infsup::subsasgn (const std::string &type,
+                         const std::list<octave_value_list> &idx,
+                         const octave_value &rhs)
+{
+  switch (type[0])
+    {
+    case '(':
+      {
+        if (type.length () > 1)
+          {
+            error ("only subscripts with parenthesis allowed");
+            return octave_value ();
+          }
+
+        // Decorated intervals and old-style objects are assigned by their
+        // subsasgn methods
+        if (::isobject (rhs))
+          {
+            octave_value_list args;
+            args (0) = octave_value (clone ());
+            args (1) = subscript_struct (type, idx);
+            args (2) = rhs;
+            return octave::feval ("subsasgn", args, 1) (0);
+          }
+
+        const octave_value_list &i = idx.front ();
+        const octave_idx_type n = i.length ();
+        Array<index_vector_type> ia (dim_vector (n, 1));
+        for (octave_idx_type k = 0; k < n; k ++)
+          ia (k) = i (k).index_vector ();
+
+        if (rhs.is_null_value ())
+          {
+            // Deletion of elements
+            if (n == 1)
+              {
+                m_inf.delete_elements (ia (0));
+                m_sup.delete_elements (ia (0));
+              }
+            else
+              {
+                m_inf.delete_elements (ia);
+                m_sup.delete_elements (ia);
+              }
+          }
+        else
+          {
+            NDArray l, u;
+            interval_operand (*rhs.internal_rep (), l, u);
+            // Any new elements are stored as [-0, +0]
+            if (n == 1)
+              {
+                m_inf.assign (ia (0), l, -0.0);
+                m_sup.assign (ia (0), u, +0.0);
+              }
+            else
+              {
+                m_inf.assign (ia, l, -0.0);
+                m_sup.assign (ia, u, +0.0);
+              }
+          }
+      }
+      break;
+
+    case '{':
+      error ("interval cannot be indexed with {}");
+      return octave_value ();
+
+    case '.':
+      {
+        // Raw access to the boundaries, which is used by the methods of the
+        // class, e.g., x.inf = l or x.inf(idx) = l.  Like for old-style class
+        // objects, other functions must not break the invariants of the
+        // intervals.
+        if (! in_class_method ())
+          {
+            error ("only subscripts with parenthesis allowed");
+            return octave_value ();
+          }
+        NDArray &boundaries = field (idx.front () (0).string_value ());
+        if (type.length () == 1)
+          boundaries = rhs.array_value ();
+        else
+          {
+            std::list<octave_value_list> next_idx (idx);
+            next_idx.erase (next_idx.begin ());
+            octave_value tmp (boundaries);
+            // The array must not be shared to be modified in place
+            boundaries = NDArray ();
+            tmp = tmp.subsasgn (type.substr (1), next_idx, rhs);
+            boundaries = tmp.array_value ();
+          }
+      }
+      break;
+
+    default:
+      error ("invalid subscript type");
+      return octave_value ();
+    }
+
+  return octave_value (this, true);
+}
+
+// The boundaries are stored as decimal numbers with 17 significant digits,
+// which is sufficient to recover the exact binary64 numbers.
+bool
+octave_infsup::save_ascii (std::ostream &os)
+{
+  const dim_vector dv = dims ();
+  os << "# ndims: " << dv.ndims () << "\n";
+  for (int j = 0; j < dv.ndims (); j ++)
+    os << " " << dv (j);
+  os << "\n";
+
+  const std::streamsize precision = os.precision (17);
+  const double *l = m_inf.data ();
+  const double *u = m_sup.data ();
+  for (octave_idx_type i = 0; i < m_inf.numel (); i ++)
+    os << " " << l[i] << " " << u[i] << "\n";
+  os.precision (precision);
+
+  return os.good ();
+}
+
+bool
+octave_infsup::load_ascii (std::istream &is)
+{
+  std::string hash, keyword;
+  int dimensions;
+  if (! (is >> hash >> keyword >> dimensions)
+      || hash != "#" || keyword != "ndims:" || dimensions < 2)
+    return false;
+
+  dim_vector dv = dim_vector (1, 1).redim (dimensions);
+  for (int j = 0; j < dimensions; j ++)
+    if (! (is >> dv (j)))
+      return false;
+
+  // Infinite boundaries are written as inf and -inf, which strtod can read
+  NDArray l (dv), u (dv);
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  std::string l_str, u_str;
+  for (octave_idx_type i = 0; i < l.numel (); i ++)
+    {
+      if (! (is >> l_str >> u_str))
+        return false;
+      l_data[i] = std::strtod (l_str.c_str (), 0);
+      u_data[i] = std::strtod (u_str.c_str (), 0);
+    }
+
+  m_inf = l;
+  m_sup = u;
+  return true;
+}
+
+// Binary files store the boundaries with full precision, even if the option
+// -float-binary has been given, because rounded boundaries might not enclose
+// the original intervals.
+bool
+octave_infsup::save_binary (std::ostream &os, bool)
+{
+  return boundary_struct ().save_binary (os, false);
+}
+
+bool
+octave_infsup::load_binary (std::istream &is, bool swap,
+                            binary_float_format fmt)
+{
+  octave_value s = octave_value (octave_scalar_map ());
+  return s.load_binary (is, swap, fmt) && load_boundary_struct (s);
+}
+
+bool
+octave_infsup::save_hdf5 (octave_hdf5_id loc_id, const char *name, bool)
+{
+  return boundary_struct ().save_hdf5 (loc_id, name, false);
+}
+
+bool
+octave_infsup::load_hdf5 (octave_hdf5_id loc_id, const char *name)
+{
+  octave_value s = octave_value (octave_scalar_map ());
+  return s.load_hdf5 (loc_id, name) && load_boundary_struct (s);
+}
+
+typedef bare_interval (*binary_interval_kernel) (directed_rounding &,
+                                                 const bare_interval,
+                                                 const bare_interval);
+
+// Element-wise evaluation of an arithmetic operation with broadcasting
+static octave_value
+interval_binary_op (const char *op_name, const binary_interval_kernel f,
+                    const octave_base_value &a1, const octave_base_value &a2)
+{
+  // Keep the operands alive while their data is in use
+  NDArray boundaries[4];
+  interval_operand (a1, boundaries[0], boundaries[1]);
+  interval_operand (a2, boundaries[2], boundaries[3]);
+
+  broadcast_operand operands[2];
+  for (int k = 0; k < 2; k ++)
+    {
+      operands[k].inf = boundaries[2 * k].data ();
+      operands[k].sup = boundaries[2 * k + 1].data ();
+      operands[k].dec = NULL;
+      operands[k].dims = boundaries[2 * k].dims ();
+    }
+
+  // Non-singleton dimensions of the operands must agree
+  dim_vector result_dims;
+  if (! broadcast_operands (operands, 2, result_dims))
+    {
+      error ("%s: nonconformant arguments (op1 is %s, op2 is %s)",
+             op_name, operands[0].dims.str ().c_str (),
+             operands[1].dims.str ().c_str ());
+      return octave_value ();
+    }
+
+  const octave_idx_type elements = result_dims.numel ();
+  NDArray l (result_dims), u (result_dims);
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (elements >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < elements; i ++)
+      {
+        const octave_idx_type ix = operands[0].index (result_dims, i);
+        const octave_idx_type iy = operands[1].index (result_dims, i);
+        const bare_interval x = {operands[0].inf[ix], operands[0].sup[ix]};
+        const bare_interval y = {operands[1].inf[iy], operands[1].sup[iy]};
+        const bare_interval result = (*f) (r, x, y);
+        l_data[i] = result.inf;
+        u_data[i] = result.sup;
+      }
+  }
+
+  return octave_value (new octave_infsup (l, u));
+}
+
+// Evaluate the method of the infsup class, which implements an operator
+static octave_value
+interval_method (const std::string &name,
+                 const octave_base_value &a1, const octave_base_value &a2)
+{
+  octave_value_list args;
+  args (0) = octave_value (a1.clone ());
+  args (1) = octave_value (a2.clone ());
+  return octave::feval (name, args, 1) (0);
+}
+
+static octave_value
+oct_binop_infsup_plus (const octave_base_value &a1,
+                       const octave_base_value &a2)
+{
+  return interval_binary_op ("operator +", interval_plus, a1, a2);
+}
+
+static octave_value
+oct_binop_infsup_minus (const octave_base_value &a1,
+                        const octave_base_value &a2)
+{
+  return interval_binary_op ("operator -", interval_minus, a1, a2);
+}
+
+static octave_value
+oct_binop_infsup_times (const octave_base_value &a1,
+                        const octave_base_value &a2)
+{
+  return interval_binary_op ("product", interval_times, a1, a2);
+}
+
+static octave_value
+oct_binop_infsup_rdivide (const octave_base_value &a1,
+                          const octave_base_value &a2)
+{
+  return interval_binary_op ("quotient", interval_rdivide, a1, a2);
+}
+
+// Matrix operations with a scalar are element-wise operations
+static octave_value
+oct_binop_infsup_mtimes (const octave_base_value &a1,
+                         const octave_base_value &a2)
+{
+  if (a1.numel () == 1 || a2.numel () == 1)
+    return interval_binary_op ("operator *", interval_times, a1, a2);
+  return interval_method ("mtimes", a1, a2);
+}
+
+static octave_value
+oct_binop_infsup_mrdivide (const octave_base_value &a1,
+                           const octave_base_value &a2)
+{
+  if (a2.numel () == 1)
+    return interval_binary_op ("operator /", interval_rdivide, a1, a2);
+  return interval_method ("mrdivide", a1, a2);
+}
+
+template <octave_value::binary_op op>
+static octave_value
+oct_binop_infsup_method (const octave_base_value &a1,
+                         const octave_base_value &a2)
+{
+  return interval_method (octave_value::binary_op_fcn_name (op), a1, a2);
+}
+
+static octave_value
+oct_unop_infsup_uminus (const octave_base_value &a)
+{
+  const octave_infsup &x = dynamic_cast<const octave_infsup &> (a);
+  const octave_idx_type n = x.numel ();
+  const double *x_inf = x.inf_array ().data ();
+  const double *x_sup = x.sup_array ().data ();
+  NDArray l (x.dims ()), u (x.dims ());
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  for (octave_idx_type i = 0; i < n; i ++)
+    {
+      const bare_interval element = {x_inf[i], x_sup[i]};
+      const bare_interval result = interval_uminus (element);
+      l_data[i] = result.inf;
+      u_data[i] = result.sup;
+    }
+  return octave_value (new octave_infsup (l, u));
+}
+
+static octave_value
+oct_unop_infsup_uplus (const octave_base_value &a)
+{
+  return octave_value (a.clone ());
+}
+
+static octave_value
+oct_unop_infsup_transpose (const octave_base_value &a)
+{
+  const octave_infsup &x = dynamic_cast<const octave_infsup &> (a);
+  if (x.dims ().ndims () > 2)
+    {
+      error ("transpose not defined for N-D objects");
+      return octave_value ();
+    }
+  return octave_value (
+    new octave_infsup (NDArray (x.inf_array ().transpose ()),
+                       NDArray (x.sup_array ().transpose ())));
+}
+
+// Concatenation: insert the second operand into the first operand, which
+// already has the size of the result
+static octave_value
+oct_catop_infsup (octave_base_value &a1, const octave_base_value &a2,
+                  const Array<octave_idx_type> &ra_idx)
+{
+  NDArray l, u, l2, u2;
+  interval_operand (a1, l, u);
+  interval_operand (a2, l2, u2);
+  if (l2.numel () > 0)
+    {
+      l.insert (l2, ra_idx);
+      u.insert (u2, ra_idx);
+    }
+  return octave_value (new octave_infsup (l, u));
+}
+
+// Indexed assignment of intervals into arrays of real numbers
+static octave_base_value *
+oct_conv_to_infsup (const octave_base_value &a)
+{
+  NDArray l, u;
+  interval_operand (a, l, u);
+  return new octave_infsup (l, u);
+}
+
+static bool infsup_type_installed = false;
+
+#if defined (INTERVAL_TYPE_INFO_IN_INTERPRETER)
+static void
+install_infsup_type (octave::interpreter &interp)
+{
+  octave::type_info &ti = interp.get_type_info ();
+  octave_infsup::register_type (ti);
+#else
+static void
+install_infsup_type ()
+{
+  octave_infsup::register_type ();
+#endif
+
+  INSTALL_INFSUP_UNOP (op_uminus, octave_infsup, oct_unop_infsup_uminus);
+  INSTALL_INFSUP_UNOP (op_uplus, octave_infsup, oct_unop_infsup_uplus);
+  INSTALL_INFSUP_UNOP (op_transpose, octave_infsup,
+                       oct_unop_infsup_transpose);
+  INSTALL_INFSUP_UNOP (op_hermitian, octave_infsup,
+                       oct_unop_infsup_transpose);
+
+#define INSTALL_INFSUP_BINOPS(t1, t2) \
+  INSTALL_INFSUP_BINOP (op_add, t1, t2, oct_binop_infsup_plus); \
+  INSTALL_INFSUP_BINOP (op_sub, t1, t2, oct_binop_infsup_minus); \
+  INSTALL_INFSUP_BINOP (op_el_mul, t1, t2, oct_binop_infsup_times); \
+  INSTALL_INFSUP_BINOP (op_el_div, t1, t2, oct_binop_infsup_rdivide); \
+  INSTALL_INFSUP_BINOP (op_mul, t1, t2, oct_binop_infsup_mtimes); \
+  INSTALL_INFSUP_BINOP (op_div, t1, t2, oct_binop_infsup_mrdivide); \
+  INSTALL_INFSUP_BINOP (op_ldiv, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_ldiv>); \
+  INSTALL_INFSUP_BINOP (op_pow, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_pow>); \
+  INSTALL_INFSUP_BINOP (op_el_ldiv, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_el_ldiv>); \
+  INSTALL_INFSUP_BINOP (op_el_pow, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_el_pow>); \
+  INSTALL_INFSUP_BINOP (op_lt, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_lt>); \
+  INSTALL_INFSUP_BINOP (op_le, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_le>); \
+  INSTALL_INFSUP_BINOP (op_eq, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_eq>); \
+  INSTALL_INFSUP_BINOP (op_ge, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_ge>); \
+  INSTALL_INFSUP_BINOP (op_gt, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_gt>); \
+  INSTALL_INFSUP_BINOP (op_ne, t1, t2, \
+    oct_binop_infsup_method<octave_value::op_ne>)
+
+  INSTALL_INFSUP_BINOPS (octave_infsup, octave_infsup);
+  INSTALL_INFSUP_BINOPS (octave_infsup, octave_scalar);
+  INSTALL_INFSUP_BINOPS (octave_scalar, octave_infsup);
+  INSTALL_INFSUP_BINOPS (octave_infsup, octave_matrix);
+  INSTALL_INFSUP_BINOPS (octave_matrix, octave_infsup);
+
+#undef INSTALL_INFSUP_BINOPS
+
+  INSTALL_INFSUP_CATOP (octave_infsup, octave_infsup, oct_catop_infsup);
+  INSTALL_INFSUP_CATOP (octave_infsup, octave_scalar, oct_catop_infsup);
+  INSTALL_INFSUP_CATOP (octave_infsup, octave_matrix, oct_catop_infsup);
+  INSTALL_INFSUP_CATOP (octave_matrix, octave_infsup, oct_catop_infsup);
+
+  INSTALL_INFSUP_ASSIGNCONV (octave_scalar, octave_infsup, oct_conv_to_infsup);
+  INSTALL_INFSUP_ASSIGNCONV (octave_matrix, octave_infsup, oct_conv_to_infsup);
+
+  infsup_type_installed = true;
+}
+
+#define INFSUP_DOCSTRING \
+  "-*- texinfo -*-\n" \
+  "@documentencoding UTF-8\n" \
+  "@deftypefn  {} {} __infsup__ ()\n" \
+  "@deftypefnx {} {@var{X} =} __infsup__ (@var{L}, @var{U})\n" \
+  "@deftypefnx {} {@var{X} =} __infsup__ (\"object\", @var{X})\n" \
+  "\n" \
+  "Create a bare interval array @var{X} with lower boundaries @var{L} and " \
+  "upper boundaries @var{U}." \
+  "\n\n" \
+  "The interval array is stored natively.  It has the class name " \
+  "@code{infsup}, provides the fields @code{inf} and @code{sup} to the " \
+  "methods of the class, and evaluates indexing, concatenation, size " \
+  "queries, and the operators @code{+}, @code{-}, @code{.*}, @code{./}, " \
+  "and unary minus without calls to m-files.  The boundaries are not " \
+  "checked: @var{L} and @var{U} must be binary64 arrays of equal size, " \
+  "which have been computed by an internal kernel.  Elements with " \
+  "@code{@var{L} > @var{U}} are stored as empty intervals [inf, -inf]." \
+  "\n\n" \
+  "With the option @code{\"object\"}, the interval array is converted into " \
+  "an old-style class object, which can be used as the parent object of " \
+  "the @code{infsupdec} class." \
+  "\n\n" \
+  "Interval arrays can be saved in the text, binary, and HDF5 formats of " \
+  "Octave.  MAT files do not support the data type." \
+  "\n\n" \
+  "Without arguments, the data type is registered, which is done " \
+  "automatically when the package is loaded." \
+  "\n\n" \
+  "This is an internal function of the interval package and should not be " \
+  "called directly.\n" \
+  "@seealso{@@infsup/infsup, @@infsupdec/infsupdec}\n" \
+  "@end deftypefn"
+
+#if defined (INTERVAL_TYPE_INFO_IN_INTERPRETER)
+DEFMETHOD_DLD (__infsup__, interp, args, nargout, INFSUP_DOCSTRING)
+#else
+DEFUN_DLD (__infsup__, args, nargout, INFSUP_DOCSTRING)
+#endif
+{
+  // The operators of the data type are used by the interpreter, thus the
+  // oct-file must not be unloaded
+  if (! infsup_type_installed)
+    {
+#if defined (INTERVAL_TYPE_INFO_IN_INTERPRETER)
+      install_infsup_type (interp);
+      interp.mlock ();
+#else
+      install_infsup_type ();
+      mlock ();
+#endif
+    }
+
+  // Check call syntax
+  const int nargin = args.length ();
+  switch (nargin)
+    {
+    case 0:
+      return octave_value_list ();
+
+    case 2:
+      if (args (0).is_string ())
+        {
+          if (args (0).string_value () != "object"
+              || ! args (1).is_instance_of ("infsup")
+              || args (1).is_instance_of ("infsupdec"))
+            {
+              print_usage ();
+              return octave_value_list ();
+            }
+          if (isobject (args (1)))
+            return octave_value_list (1, args (1));
+          const octave_infsup &x =
+            dynamic_cast<const octave_infsup &> (*args (1).internal_rep ());
+          return octave_value_list (1, x.class_object ());
+        }
+      break;
+
+    default:
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  NDArray l = args (0).array_value ();
+  NDArray u = args (1).array_value ();
+  if (l.dims () != u.dims ())
+    {
+      error ("__infsup__: L and U must have the same size");
+      return octave_value_list ();
+    }
+
+  // Kernels return empty results with arbitrary L > U
+  const octave_idx_type n = l.numel ();
+  for (octave_idx_type i = 0; i < n; i ++)
+    if (l(i) > u(i))
+      {
+        l(i) = INFINITY;
+        u(i) = -INFINITY;
+      }
+
+  return octave_value_list (1, octave_value (new octave_infsup (l, u)));
+}
+
+/*
+%!test
+%! x = __infsup__ ([-0, 1], [0, 2]);
+%! assert (class (x), "infsup");
+%! assert (isa (x, "infsup"));
+%! assert (not (isobject (x)));
+%! assert (size (x), [1, 2]);
+%! assert (numel (x), 2);
+%! assert (inf (x), [0, 1]);
+%! assert (sup (x), [0, 2]);
+%! assert (x.inf, [0, 1]);
+%!test
+%! x = __infsup__ ([1, 3, 5], [0, 4, -inf]);
+%! assert (inf (x), [inf, 3, inf]);
+%! assert (sup (x), [-inf, 4, -inf]);
+%! assert (isempty (x), [true, false, true]);
+%!test
+%! x = __infsup__ ([1, 3, 5], [2, 4, 6]);
+%! assert (inf (x(2)), 3);
+%! assert (sup (x([true, false, true])), [2, 6]);
+%! assert (inf (x(end)), 5);
+%! assert (inf (x(:)), [1; 3; 5]);
+%! assert (x(2).sup, 4);
+%!test
+%! x = __infsup__ ([1, 3, 5], [2, 4, 6]);
+%! x(2) = infsup (7, 8);
+%! assert (inf (x), [1, 7, 5]);
+%! x(5) = 9;
+%! assert (inf (x), [1, 7, 5, 0, 9]);
+%! assert (sup (x), [2, 8, 6, 0, 9]);
+%! assert (signbit (inf (x(4))));
+%! y = [1, 2];
+%! y(2) = infsup (3, 4);
+%! assert (class (y), "infsup");
+%! assert (sup (y), [1, 4]);
+%! x([1, 4]) = [];
+%! assert (inf (x), [7, 5, 9]);
+%!error <only subscripts with parenthesis allowed>
+%! x = __infsup__ ([1, 3], [2, 4]);
+%! x.inf(2) = 5;
+%!error <only subscripts with parenthesis allowed>
+%! x = __infsup__ ([1, 3], [2, 4]);
+%! x.sup = 0;
+%!error <interval cannot be indexed with {}> __infsup__ (1, 2){1}
+%!test
+%! x = __infsup__ (1, 2);
+%! y = __infsup__ (3, 4);
+%! assert (inf ([x, y]), [1, 3]);
+%! assert (sup ([x; y]), [2; 4]);
+%! assert (inf ([x, 5, [6, 7]]), [1, 5, 6, 7]);
+%! assert (sup ([[6; 7]; x]), [6; 7; 2]);
+%!test
+%! x = __infsup__ ([1, 2], [3, 4]);
+%! assert (inf (x'), [1; 2]);
+%! assert (inf (-x), [-3, -4]);
+%! assert (inf (+x), [1, 2]);
+%! assert (inf (x + 1), [2, 3]);
+%! assert (sup (1 - x), [0, -1]);
+%! assert (inf (x .* [2; 3]), [2, 4; 3, 6]);
+%! assert (sup (x ./ 2), [1.5, 2]);
+%! assert (inf (2 * x), [2, 4]);
+%! assert (sup (x / 2), [1.5, 2]);
+%! assert (inf (x * infsup ([1; 1])), 3);
+%! assert (x == infsup ([1, 2], [3, 4]));
+%! assert (x < 5);
+%! assert (inf (x .^ 2), [1, 4]);
+%!test
+%! x = __infsup__ (1, 3) ./ __infsup__ (0, 0);
+%! assert (isempty (x));
+%! x = __infsup__ (0, 0) .* __infsup__ (-inf, inf);
+%! assert ([inf(x), sup(x)], [0, 0]);
+%!error <operator \+: nonconformant arguments> __infsup__ ([1, 2], [1, 2]) + __infsup__ ([1, 2, 3], [1, 2, 3])
+%!test
+%! x = infsupdec (__infsup__ (1, 2));
+%! assert (isa (x, "infsupdec"));
+%! assert (isa (x, "infsup"));
+%! assert (inf (x), 1);
+%! y = x + __infsup__ (1, 1);
+%! assert (isa (y, "infsupdec"));
+%! assert (inf (y), 2);
+%!test
+%! x = __infsup__ ([1, 2], [3, 4]);
+%! o = __infsup__ ("object", x);
+%! assert (isobject (o));
+%! assert (isequal (o, x));
+%! assert (inf (o + x), [2, 4]);
+%!test
+%! x = __infsup__ ([-inf, -0, 1/3], [0, 0, inf]);
+%! f = [tempname(), ".txt"];
+%! unwind_protect
+%!   save ("-text", f, "x");
+%!   y = load (f).x;
+%! unwind_protect_cleanup
+%!   delete (f);
+%! end_unwind_protect
+%! assert (inf (y), inf (x));
+%! assert (sup (y), sup (x));
+%! assert (signbit (inf (y)), [true, true, false]);
+%!test
+%! x = __infsup__ ([-inf, -0, 1/3], [0, 0, inf]);
+%! f = tempname ();
+%! unwind_protect
+%!   save ("-float-binary", f, "x");
+%!   y = load (f).x;
+%! unwind_protect_cleanup
+%!   delete (f);
+%! end_unwind_protect
+%! assert (class (y), "infsup");
+%! assert (inf (y), inf (x));
+%! assert (sup (y), sup (x));
+%!testif HAVE_HDF5
+%! x = __infsup__ ([-inf, -0, 1/3], [0, 0, inf]);
+%! f = tempname ();
+%! unwind_protect
+%!   save ("-hdf5", f, "x");
+%!   y = load (f).x;
+%! unwind_protect_cleanup
+%!   delete (f);
+%! end_unwind_protect
+%! assert (class (y), "infsup");
+%! assert (inf (y), inf (x));
+%! assert (sup (y), sup (x));
+*/
@@ -0,0 +1,101 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include "interval_interchange.h"
+
+DEFUN_DLD (__interval_unpack__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}, @var{D}] =} __interval_unpack__ "
+  "(@var{B}, @var{DECORATED}, @var{ARCH})\n"
+  "\n"
+  "Decode the interchange format of IEEE Std 1788-2015 from uint8 array "
+  "@var{B}."
+  "\n\n"
+  "@var{B} contains 16 octets per bare interval or, if @var{DECORATED} is "
+  "true, 17 octets per decorated interval.  The byte order of the interval "
+  "boundaries is given by @var{ARCH}.  The results are column vectors with "
+  "the raw values of the lower boundaries @var{L}, upper boundaries @var{U}, "
+  "and decorations @var{D}.  The values are not checked."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{interval_unpack}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 3)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const uint8NDArray buffer = args (0).uint8_array_value ();
+  const bool decorated = args (1).bool_value ();
+  const bool big_endian = parse_byte_order (args (2).string_value ());
+
+  const octave_idx_type octets = decorated
+                                 ? DECORATED_INTERCHANGE_OCTETS
+                                 : BARE_INTERCHANGE_OCTETS;
+  if (buffer.numel () % octets != 0)
+    {
+      error ("interval_unpack: number of octets must be a multiple of %d",
+             static_cast <int> (octets));
+      return octave_value_list ();
+    }
+
+  const octave_idx_type n = buffer.numel () / octets;
+  NDArray l (dim_vector (n, 1));
+  NDArray u (dim_vector (n, 1));
+  uint8NDArray d (dim_vector (decorated ? n : 0, 1));
+
+  const uint8_t *source = reinterpret_cast <const uint8_t *> (buffer.data ());
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  octave_uint8 *d_data = d.fortran_vec ();
+  for (octave_idx_type i = 0; i < n; i ++)
+    {
+      l_data[i] = load_binary64 (source, big_endian);
+      u_data[i] = load_binary64 (source + 8, big_endian);
+      if (decorated)
+        d_data[i] = source[16];
+      source += octets;
+    }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = d;
+  return result;
+}
+
+/*
+%!test
+%! [l, u, d] = __interval_unpack__ (uint8 ([64; 8; zeros(6, 1); 64; 16; zeros(6, 1)]), false, "ieee-be");
+%! assert (l, 3);
+%! assert (u, 4);
+%! assert (size (d), [0, 1]);
+%!test
+%! [l, u, d] = __interval_unpack__ (uint8 ([zeros(6, 1); 8; 64; zeros(6, 1); 16; 64; 12]), true, "ieee-le");
+%! assert (l, 3);
+%! assert (u, 4);
+%! assert (d, uint8 (12));
+%!error __interval_unpack__ (uint8 (1 : 20), false, "native")
+*/
@@ -0,0 +1,258 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "interval_kernels.h"
+
+// Maximum number of iterations and epsilon of the epsilon inflation during
+// verification, and of the refinement step, see @infsup/mldivide
+const int MAX_ITER_VER = 5;
+const double EPS_VER = 1e-1;
+const int MAX_ITER_REF = 5;
+const double EPS_REF = 1e-5;
+
+// Epsilon inflation (1 + eps) x - eps x, rounded outwards
+inline bare_interval blow (directed_rounding &r, const bare_interval x,
+                           const double eps)
+{
+  const bare_interval a = {1.0 + eps, 1.0 + eps};
+  const bare_interval b = {eps, eps};
+  const bare_interval y = interval_minus (r, interval_times (r, a, x),
+                                          interval_times (r, b, x));
+  const bare_interval result = {std::nextafter (y.inf, -INFINITY),
+                                std::nextafter (y.sup, INFINITY)};
+  return result;
+}
+
+// x = z + C y with exact dot products, where ct is the transpose of C
+inline void fixed_point_step (exact_accumulator &accu,
+                              const std::vector <bare_interval> &ct,
+                              const std::vector <bare_interval> &z,
+                              const std::vector <bare_interval> &y,
+                              std::vector <bare_interval> &x)
+{
+  const std::size_t n = z.size ();
+  for (std::size_t i = 0; i < n; i ++)
+    {
+      accu.reset ();
+      accu.add (z[i]);
+      for (std::size_t k = 0; k < n; k ++)
+        accu.add_product (ct[k + i * n], y[k]);
+      x[i] = accu.result ();
+    }
+}
+
+DEFUN_DLD (__inv__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}, @var{VERIFIED}] =} __inv__ (@var{AL}, "
+  "@var{AU}, @var{R}, @var{X1})\n"
+  "\n"
+  "Compute a verified enclosure of the inverse of the square interval "
+  "matrix with lower boundaries @var{AL} and upper boundaries @var{AU}."
+  "\n\n"
+  "@var{R} is an approximate inverse of the midpoint matrix and @var{X1} "
+  "is an approximate inverse after one step of residual correction.  The "
+  "enclosure of column j is @code{@var{X1}(:, j) + x}, where x is the "
+  "fixed point of @code{x = z + C x} (Krawczyk operator) with the interval "
+  "residuals @code{z = R (e_j - A @var{X1}(:, j))} and @code{C = I - R A}.  "
+  "The fixed point is verified by an epsilon inflation, and refined by "
+  "intersection, with the same parameters as in @code{mldivide}.  All "
+  "residuals and matrix products are computed with exact dot products."
+  "\n\n"
+  "@var{VERIFIED} is a logical row vector, which is false for columns, "
+  "whose verification failed.  The columns are computed in parallel if the "
+  "package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/inv}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 4)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const Matrix al = args (0).matrix_value ();
+  const Matrix au = args (1).matrix_value ();
+  const Matrix rm = args (2).matrix_value ();
+  const Matrix x1 = args (3).matrix_value ();
+  const octave_idx_type n = al.rows ();
+  if (al.columns () != n || au.rows () != n || au.columns () != n
+      || rm.rows () != n || rm.columns () != n
+      || x1.rows () != n || x1.columns () != n)
+    {
+      error ("__inv__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  Matrix l (n, n);
+  Matrix u (n, n);
+  boolNDArray verified (dim_vector (1, n), false);
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  bool *verified_data = verified.fortran_vec ();
+
+  // Transpose of C = I - R A, such that its rows are contiguous
+  std::vector <bare_interval> ct (n * n);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 16)
+#endif
+  {
+    // Each thread uses its own MPFR variables and vectors
+    directed_rounding r;
+    exact_accumulator accu;
+    std::vector <bare_interval> residual (n), z (n), x (n), y (n);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type j = 0; j < n; j ++)
+      for (octave_idx_type i = 0; i < n; i ++)
+        {
+          const bare_interval delta = {i == j ? 1.0 : 0.0, i == j ? 1.0 : 0.0};
+          accu.reset ();
+          accu.add (delta);
+          for (octave_idx_type k = 0; k < n; k ++)
+            {
+              const bare_interval r_ik = {-rm(i, k), -rm(i, k)};
+              const bare_interval a_kj = {al(k, j), au(k, j)};
+              accu.add_product (r_ik, a_kj);
+            }
+          ct[j + i * n] = accu.result ();
+        }
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type s = 0; s < n; s ++)
+      {
+        // Interval residual z = R (e_s - A X1(:, s))
+        for (octave_idx_type i = 0; i < n; i ++)
+          {
+            const bare_interval delta = {i == s ? 1.0 : 0.0,
+                                         i == s ? 1.0 : 0.0};
+            accu.reset ();
+            accu.add (delta);
+            for (octave_idx_type k = 0; k < n; k ++)
+              {
+                const bare_interval a_ik = {al(i, k), au(i, k)};
+                const bare_interval x_ks = {-x1(k, s), -x1(k, s)};
+                accu.add_product (a_ik, x_ks);
+              }
+            residual[i] = accu.result ();
+          }
+        bool exact = true;
+        for (octave_idx_type i = 0; i < n; i ++)
+          {
+            accu.reset ();
+            for (octave_idx_type k = 0; k < n; k ++)
+              {
+                const bare_interval r_ik = {rm(i, k), rm(i, k)};
+                accu.add_product (r_ik, residual[k]);
+              }
+            z[i] = accu.result ();
+            exact &= z[i].inf == 0.0 && z[i].sup == 0.0;
+          }
+
+        bool ok = exact;
+        if (! exact)
+          {
+            // Verification by epsilon inflation
+            x = z;
+            for (int p = 0; p < MAX_ITER_VER && ! ok; p ++)
+              {
+                for (octave_idx_type i = 0; i < n; i ++)
+                  y[i] = blow (r, x[i], EPS_VER);
+                fixed_point_step (accu, ct, z, y, x);
+                ok = true;
+                for (octave_idx_type i = 0; i < n; i ++)
+                  ok &= y[i].inf <= x[i].inf && x[i].sup <= y[i].sup;
+              }
+
+            // Iterative refinement
+            for (int p = 1; ok && p <= MAX_ITER_REF; p ++)
+              {
+                y = x;
+                fixed_point_step (accu, ct, z, y, x);
+                double distance = 0.0;
+                for (octave_idx_type i = 0; i < n; i ++)
+                  {
+                    x[i] = interval_intersect (x[i], y[i]);
+                    distance = std::max (distance,
+                                         std::max (std::fabs (x[i].inf
+                                                              - y[i].inf),
+                                                   std::fabs (x[i].sup
+                                                              - y[i].sup)));
+                  }
+                if (distance <= EPS_REF)
+                  break;
+              }
+          }
+
+        verified_data[s] = ok;
+        for (octave_idx_type i = 0; i < n; i ++)
+          {
+            const bare_interval x1_is = {x1(i, s), x1(i, s)};
+            const bare_interval result = exact ? x1_is
+                                         : interval_plus (r, x1_is, x[i]);
+            l_data[i + s * n] = result.inf;
+            u_data[i + s * n] = result.sup;
+          }
+      }
+  }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = verified;
+  return result;
+}
+
+/*
+%!test
+%! A = [2, 1; 1, 1];
+%! [l, u, verified] = __inv__ (A, A, inv (A), inv (A));
+%! assert (l, [1, -1; -1, 2]);
+%! assert (u, [1, -1; -1, 2]);
+%! assert (verified, [true, true]);
+%!test
+%! A = magic (4) + eye (4);
+%! [l, u, verified] = __inv__ (A, A, inv (A), inv (A));
+%! assert (all (verified));
+%! assert (l <= inv (A) & inv (A) <= u);
+%! assert (max (max (u - l)) < 1e-14);
+%!test
+%! A = [2, -1; -1, 2];
+%! [l, u, verified] = __inv__ (A - 0.1, A + 0.1, inv (A), inv (A));
+%! assert (all (verified));
+%! assert (l <= inv (A) & inv (A) <= u);
+%!test
+%! ## Singular matrix
+%! [~, ~, verified] = __inv__ ([1, 1; 1, 1], [1, 1; 1, 1], eye (2), eye (2));
+%! assert (verified, [false, false]);
+%!error __inv__ (eye (2), eye (2), eye (3), eye (2))
+*/
@@ -0,0 +1,253 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <vector>
+#include "interval_kernels.h"
+
+// Inverse of the d×d matrix a (column-major) by Gauss-Jordan elimination
+// with partial pivoting.  Returns false if the matrix is singular.
+bool invert (std::vector <double> a, std::vector <double> &c,
+             const octave_idx_type d)
+{
+  c.assign (d * d, 0.0);
+  for (octave_idx_type i = 0; i < d; i ++)
+    c[i + i * d] = 1.0;
+
+  for (octave_idx_type j = 0; j < d; j ++)
+    {
+      octave_idx_type pivot = j;
+      for (octave_idx_type i = j + 1; i < d; i ++)
+        if (std::fabs (a[i + j * d]) > std::fabs (a[pivot + j * d]))
+          pivot = i;
+      const double p = a[pivot + j * d];
+      if (p == 0.0 || ! std::isfinite (p))
+        return false;
+      for (octave_idx_type k = 0; k < d; k ++)
+        {
+          std::swap (a[j + k * d], a[pivot + k * d]);
+          std::swap (c[j + k * d], c[pivot + k * d]);
+        }
+      for (octave_idx_type k = 0; k < d; k ++)
+        {
+          a[j + k * d] /= p;
+          c[j + k * d] /= p;
+        }
+      for (octave_idx_type i = 0; i < d; i ++)
+        {
+          const double factor = a[i + j * d];
+          if (i == j || factor == 0.0)
+            continue;
+          for (octave_idx_type k = 0; k < d; k ++)
+            {
+              a[i + k * d] -= factor * a[j + k * d];
+              c[i + k * d] -= factor * c[j + k * d];
+            }
+        }
+    }
+
+  for (octave_idx_type k = 0; k < d * d; k ++)
+    if (! std::isfinite (c[k]))
+      return false;
+  return true;
+}
+
+inline bool is_bounded (const bare_interval x)
+{
+  return ! is_empty (x) && x.inf != -INFINITY && x.sup != INFINITY;
+}
+
+DEFUN_DLD (__krawczyk__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __krawczyk__ (@var{XL}, @var{XU}, "
+  "@var{M}, @var{FL}, @var{FU}, @var{JL}, @var{JU})\n"
+  "\n"
+  "Contract boxes with the Krawczyk operator of a square system of "
+  "equations f (x) ∈ Y."
+  "\n\n"
+  "The d×Q matrices @var{XL} and @var{XU} contain the boundaries of Q boxes, "
+  "one box per column, and @var{M} contains points in the boxes.  "
+  "[@var{FL}, @var{FU}] are d×Q enclosures of f (@var{M}) - Y and the "
+  "d×d×Q arrays [@var{JL}, @var{JU}] are enclosures of the Jacobian matrix "
+  "of f over the boxes.  With C the inverse of the midpoint of the Jacobian "
+  "matrix, all solutions in a box X are contained in"
+  "\n\n"
+  "@display\n"
+  "K (X) = M - C [F] + (I - C [J]) (X - M)."
+  "\n"
+  "@end display"
+  "\n\n"
+  "The coordinates are contracted one after another, such that the contracted "
+  "coordinates are used for the remaining ones.  The result [@var{L}, @var{U}] "
+  "is the intersection of the boxes with K.  If the intersection is empty, "
+  "the box contains no solution and the column of the result is empty.  Boxes "
+  "with unbounded enclosures or a singular midpoint matrix are not "
+  "contracted.  The boxes are processed in parallel if the package has been "
+  "compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/fsolve}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 7)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  Matrix l = args (0).matrix_value ();
+  Matrix u = args (1).matrix_value ();
+  const Matrix m = args (2).matrix_value ();
+  const Matrix fl = args (3).matrix_value ();
+  const Matrix fu = args (4).matrix_value ();
+  const NDArray jl = args (5).array_value ();
+  const NDArray ju = args (6).array_value ();
+
+  const octave_idx_type d = l.rows ();
+  const octave_idx_type q = l.columns ();
+  if (u.dims () != l.dims () || m.dims () != l.dims ()
+      || fl.dims () != l.dims () || fu.dims () != l.dims ()
+      || jl.numel () != d * d * q || ju.numel () != d * d * q)
+    {
+      error ("__krawczyk__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  const double *m_data = m.data ();
+  const double *fl_data = fl.data ();
+  const double *fu_data = fu.data ();
+  const double *jl_data = jl.data ();
+  const double *ju_data = ju.data ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (q * d * d >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    std::vector <bare_interval> jacobian (d * d);
+    std::vector <double> midpoint (d * d);
+    std::vector <double> c (d * d);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type j = 0; j < q; j ++)
+      {
+        double *xl = l_data + j * d;
+        double *xu = u_data + j * d;
+        const double *mj = m_data + j * d;
+
+        bool bounded = true;
+        for (octave_idx_type k = 0; k < d * d; k ++)
+          {
+            jacobian[k].inf = jl_data[k + j * d * d];
+            jacobian[k].sup = ju_data[k + j * d * d];
+            bounded &= is_bounded (jacobian[k]);
+            if (bounded)
+              midpoint[k] = interval_mid (r, jacobian[k]);
+          }
+        for (octave_idx_type k = 0; k < d; k ++)
+          {
+            const bare_interval f = {fl_data[k + j * d], fu_data[k + j * d]};
+            bounded &= is_bounded (f);
+          }
+        if (! bounded || ! invert (midpoint, c, d))
+          continue;
+
+        for (octave_idx_type i = 0; i < d; i ++)
+          {
+            // M(i) - C(i, :) [F]
+            bare_interval k = {mj[i], mj[i]};
+            for (octave_idx_type s = 0; s < d; s ++)
+              {
+                const bare_interval c_is = {c[i + s * d], c[i + s * d]};
+                const bare_interval f = {fl_data[s + j * d],
+                                         fu_data[s + j * d]};
+                k = interval_minus (r, k, interval_times (r, c_is, f));
+              }
+            // + (I - C [J])(i, :) (X - M)
+            for (octave_idx_type t = 0; t < d; t ++)
+              {
+                bare_interval e = {i == t ? 1.0 : 0.0, i == t ? 1.0 : 0.0};
+                for (octave_idx_type s = 0; s < d; s ++)
+                  {
+                    const bare_interval c_is = {c[i + s * d], c[i + s * d]};
+                    e = interval_minus (r, e,
+                                        interval_times (r, c_is,
+                                                        jacobian[s + t * d]));
+                  }
+                const bare_interval x = {xl[t], xu[t]};
+                const bare_interval mt = {mj[t], mj[t]};
+                k = interval_plus (r, k,
+                                   interval_times (r, e,
+                                                   interval_minus (r, x, mt)));
+              }
+
+            xl[i] = std::max (xl[i], k.inf);
+            xu[i] = std::min (xu[i], k.sup);
+            if (xl[i] > xu[i])
+              {
+                // No solution in the box
+                for (octave_idx_type t = 0; t < d; t ++)
+                  {
+                    xl[t] = INFINITY;
+                    xu[t] = -INFINITY;
+                  }
+                break;
+              }
+            const bare_interval xi = normalize_zero ({xl[i], xu[i]});
+            xl[i] = xi.inf;
+            xu[i] = xi.sup;
+          }
+      }
+  }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  return result;
+}
+
+/*
+%!test
+%! ## x^2 = 2 on [1, 2], f (1.5) - 2 = 0.25, f' = [2, 4]
+%! [l, u] = __krawczyk__ (1, 2, 1.5, 0.25, 0.25, 2, 4);
+%! assert (1 <= l && l <= sqrt (2) && sqrt (2) <= u && u < 2);
+%!test
+%! ## No solution of x^2 = 2 on [2, 3]
+%! [l, u] = __krawczyk__ (2, 3, 2.5, 4.25, 4.25, 4, 6);
+%! assert (l > u);
+%!test
+%! ## Linear system [2, 1; 1, 3] x = [3; 4] with solution [1; 1]
+%! J = [2, 1; 1, 3];
+%! [l, u] = __krawczyk__ ([-5; -5], [5; 5], [0; 0], [-3; -4], [-3; -4], J, J);
+%! assert (l <= [1; 1] & [1; 1] <= u);
+%! assert (u - l < 1e-14);
+%!test
+%! ## Unbounded Jacobian, no contraction
+%! [l, u] = __krawczyk__ (-1, 1, 0, -1, -1, -inf, inf);
+%! assert ([l, u], [-1, 1]);
+%!error __krawczyk__ (1, 2, 1.5, 0.25, 0.25, [2, 2], [4, 4])
+*/
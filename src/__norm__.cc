@@ -0,0 +1,261 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__norm__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __norm__ (@var{AL}, @var{AU}, "
+  "@var{P})\n"
+  "\n"
+  "Compute an enclosure [@var{L}, @var{U}] of the matrix norms of all "
+  "matrices in the interval matrix with lower boundaries @var{AL} and upper "
+  "boundaries @var{AU}."
+  "\n\n"
+  "@var{P} is either 1 (largest column sum), @code{inf} (largest row sum), "
+  "@code{\"fro\"} (Frobenius norm), @code{\"max\"} (largest absolute value), "
+  "or 2 (spectral norm).  The sums of absolute values and squares are exact "
+  "and rounded only once.  The spectral norm is bounded from below by the "
+  "largest euclidean norm of the rows and columns, and bounded from above "
+  "by the Frobenius norm and the geometric mean of the 1-norm and the "
+  "infinity norm.  Columns and rows are processed in parallel if the "
+  "package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/norm}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 3)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const Matrix al = args (0).matrix_value ();
+  const Matrix au = args (1).matrix_value ();
+  const octave_idx_type m = al.rows ();
+  const octave_idx_type n = al.columns ();
+  if (au.rows () != m || au.columns () != n)
+    {
+      error ("__norm__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  enum {NORM_1, NORM_INF, NORM_FRO, NORM_MAX, NORM_2} p;
+  if (args (2).is_string ())
+    {
+      const std::string name = args (2).string_value ();
+      if (name == "fro")
+        p = NORM_FRO;
+      else if (name == "max")
+        p = NORM_MAX;
+      else
+        {
+          error ("__norm__: unsupported norm '%s'", name.c_str ());
+          return octave_value_list ();
+        }
+    }
+  else
+    {
+      const double value = args (2).double_value ();
+      if (value == 1.0)
+        p = NORM_1;
+      else if (value == 2.0)
+        p = NORM_2;
+      else if (std::isinf (value) && value > 0.0)
+        p = NORM_INF;
+      else
+        {
+          error ("__norm__: unsupported norm");
+          return octave_value_list ();
+        }
+    }
+
+  const double *l = al.data ();
+  const double *u = au.data ();
+  const bool columnwise = p != NORM_INF;
+  const bool rowwise = p == NORM_INF || p == NORM_2;
+
+  // Per column: sum of absolute values, sum of squares, and absolute value
+  // of the largest element
+  std::vector <bare_interval> column_abs (columnwise ? n : 0);
+  std::vector <bare_interval> column_sqr (columnwise ? n : 0);
+  std::vector <bare_interval> column_max (columnwise ? n : 0);
+  // Per row: sum of absolute values and sum of squares
+  std::vector <bare_interval> row_abs (rowwise ? m : 0);
+  std::vector <bare_interval> row_sqr (rowwise ? m : 0);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (m * n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    exact_accumulator accu_abs;
+    exact_accumulator accu_sqr;
+
+    if (columnwise)
+      {
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type j = 0; j < n; j ++)
+          {
+            const double *l_j = l + j * m;
+            const double *u_j = u + j * m;
+            accu_abs.reset ();
+            accu_sqr.reset ();
+            bare_interval largest = {0.0, 0.0};
+            for (octave_idx_type i = 0; i < m; i ++)
+              {
+                const bare_interval a_ij = {l_j[i], u_j[i]};
+                const bare_interval a = interval_abs (a_ij);
+                accu_abs.add (a);
+                accu_sqr.add_square (a);
+                if (is_empty (a))
+                  largest = a;
+                else if (! is_empty (largest))
+                  {
+                    largest.inf = std::max (largest.inf, a.inf);
+                    largest.sup = std::max (largest.sup, a.sup);
+                  }
+              }
+            column_abs[j] = accu_abs.result ();
+            column_sqr[j] = accu_sqr.result ();
+            column_max[j] = largest;
+          }
+      }
+
+    if (rowwise)
+      {
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type i = 0; i < m; i ++)
+          {
+            accu_abs.reset ();
+            accu_sqr.reset ();
+            for (octave_idx_type j = 0; j < n; j ++)
+              {
+                const bare_interval a_ij = {l[i + j * m], u[i + j * m]};
+                const bare_interval a = interval_abs (a_ij);
+                accu_abs.add (a);
+                accu_sqr.add_square (a);
+              }
+            row_abs[i] = accu_abs.result ();
+            row_sqr[i] = accu_sqr.result ();
+          }
+      }
+  }
+
+  // Reduction of the columns and rows
+  directed_rounding r;
+  bool empty = false;
+  bare_interval norm_1 = {0.0, 0.0};
+  bare_interval norm_inf = {0.0, 0.0};
+  bare_interval norm_max = {0.0, 0.0};
+  double largest_sqr = 0.0;
+  exact_accumulator accu_fro;
+  for (octave_idx_type j = 0; j < (octave_idx_type) column_abs.size (); j ++)
+    {
+      empty |= is_empty (column_abs[j]);
+      norm_1.inf = std::max (norm_1.inf, column_abs[j].inf);
+      norm_1.sup = std::max (norm_1.sup, column_abs[j].sup);
+      norm_max.inf = std::max (norm_max.inf, column_max[j].inf);
+      norm_max.sup = std::max (norm_max.sup, column_max[j].sup);
+      largest_sqr = std::max (largest_sqr, column_sqr[j].inf);
+      accu_fro.add (column_sqr[j]);
+    }
+  for (octave_idx_type i = 0; i < (octave_idx_type) row_abs.size (); i ++)
+    {
+      empty |= is_empty (row_abs[i]);
+      norm_inf.inf = std::max (norm_inf.inf, row_abs[i].inf);
+      norm_inf.sup = std::max (norm_inf.sup, row_abs[i].sup);
+      largest_sqr = std::max (largest_sqr, row_sqr[i].inf);
+    }
+
+  bare_interval result;
+  if (empty)
+    result = empty_interval ();
+  else
+    switch (p)
+      {
+      case NORM_1:
+        result = norm_1;
+        break;
+      case NORM_INF:
+        result = norm_inf;
+        break;
+      case NORM_MAX:
+        result = norm_max;
+        break;
+      case NORM_FRO:
+        result = interval_realsqrt (r, accu_fro.result ());
+        break;
+      case NORM_2:
+        {
+          // || A ||_2 <= || |A| ||_2 <= sqrt (|| |A| ||_1 || |A| ||_inf)
+          const bare_interval norm_fro =
+            interval_realsqrt (r, accu_fro.result ());
+          const bare_interval mean =
+            interval_realsqrt (r, interval_times (r, norm_1, norm_inf));
+          result.inf = r.unary (mpfr_sqrt, largest_sqr, MPFR_RNDD);
+          result.sup = std::min (norm_fro.sup, mean.sup);
+          break;
+        }
+      }
+
+  result = normalize_zero (result);
+  octave_value_list result_list;
+  result_list (0) = result.inf;
+  result_list (1) = result.sup;
+  return result_list;
+}
+
+/*
+%!test
+%! [l, u] = __norm__ (magic (3), magic (3), 1);
+%! assert ([l, u], [15, 15]);
+%!test
+%! [l, u] = __norm__ (-magic (3), magic (3), inf);
+%! assert ([l, u], [0, 15]);
+%!test
+%! [l, u] = __norm__ ([1, -2; 3, 4], [1, 2; 3, 4], "max");
+%! assert ([l, u], [4, 4]);
+%!test
+%! [l, u] = __norm__ (magic (3), magic (3), "fro");
+%! assert (l <= sqrt (285) && sqrt (285) <= u);
+%! assert (u - l <= 4 * eps (sqrt (285)));
+%!test
+%! A = magic (4);
+%! [l, u] = __norm__ (A, A, 2);
+%! assert (l <= norm (A) && norm (A) <= u);
+%!test
+%! [l, u] = __norm__ ([1, inf], [2, -inf], 1);
+%! assert (l, inf);
+%! assert (u, -inf);
+%!error __norm__ (1, 1, 3)
+%!error __norm__ (1, [1, 2], 1)
+*/
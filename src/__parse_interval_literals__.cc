@@ -0,0 +1,374 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cctype>
+#include <octave/oct.h>
+#include <mpfr.h>
+#include "mpfr_commons.h"
+
+inline
+bool
+is_blank (const char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline
+void
+skip_blanks (const char *&p, const char *end)
+{
+  while (p < end && is_blank (*p))
+    p ++;
+}
+
+// Read a word of letters and convert it to lower case
+std::string
+parse_word (const char *&p, const char *end)
+{
+  std::string word;
+  while (p < end && std::isalpha (*p))
+    word.push_back (std::tolower (*p ++));
+  return word;
+}
+
+// Parse a decimal or hexadecimal number with directed rounding.
+// Returns false if there is no number at position p.
+bool
+parse_number
+(
+  mpfr_t mp,
+  const char *&p,
+  const char *end,
+  const mpfr_rnd_t rnd,
+  double &result
+)
+{
+  // MPFR would skip leading white space, even across line breaks
+  if (p == end || std::isspace (*p))
+    return false;
+
+  char *number_end;
+  int inexact = mpfr_strtofr (mp, p, &number_end, 0, rnd);
+  if (number_end == p || number_end > end || mpfr_nan_p (mp))
+    return false;
+
+  inexact = mpfr_subnormalize (mp, inexact, rnd);
+  result = mpfr_get_d (mp, rnd);
+  p = number_end;
+  return true;
+}
+
+// Parse a single interval literal in inf-sup form from the line
+// [begin, end).  Supported forms are [l, u], [m], [l,], [, u], [,], [],
+// [empty], [entire], and the same forms without square brackets and commas
+// (as produced by intervaltotext without punctuation), each with an optional
+// decoration suffix.  Returns false for any other literal.
+bool
+parse_literal
+(
+  mpfr_t mp,
+  const char *begin,
+  const char *end,
+  double &l,
+  double &u,
+  uint8_t &dec
+)
+{
+  const char *p = begin;
+  bool is_empty = false;
+  dec = 0;
+
+  skip_blanks (p, end);
+  const bool brackets = (p < end && *p == '[');
+  if (brackets)
+    {
+      p ++;
+      skip_blanks (p, end);
+    }
+
+  const char *first_boundary = p;
+  std::string word = parse_word (p, end);
+  if (word == "inf" || word == "infinity")
+    {
+      // Infinite boundaries are parsed as numbers below
+      p = first_boundary;
+      word.clear ();
+    }
+
+  if (word == "empty")
+    is_empty = true;
+  else if (word == "entire")
+    {
+      l = -INFINITY;
+      u = +INFINITY;
+    }
+  else if (! word.empty ())
+    // e. g., [nai], constants, or illegal literals
+    return false;
+  else if (brackets && p < end && *p == ']')
+    is_empty = true;
+  else
+    {
+      if (brackets && p < end && *p == ',')
+        l = -INFINITY;
+      else if (! parse_number (mp, p, end, MPFR_RNDD, l))
+        return false;
+
+      skip_blanks (p, end);
+      if (brackets)
+        {
+          if (p < end && *p == ',')
+            {
+              p ++;
+              skip_blanks (p, end);
+              if (p < end && *p == ']')
+                u = +INFINITY;
+              else if (! parse_number (mp, p, end, MPFR_RNDU, u))
+                return false;
+            }
+          else
+            {
+              // Point interval [m]
+              p = first_boundary;
+              parse_number (mp, p, end, MPFR_RNDU, u);
+            }
+        }
+      else
+        {
+          if (p == end || *p == '_'
+              || ! parse_number (mp, p, end, MPFR_RNDU, u))
+            {
+              // Point interval m
+              p = first_boundary;
+              parse_number (mp, p, end, MPFR_RNDU, u);
+            }
+        }
+    }
+
+  skip_blanks (p, end);
+  if (brackets)
+    {
+      if (p == end || *p != ']')
+        return false;
+      p ++;
+    }
+  else
+    skip_blanks (p, end);
+
+  // Decoration
+  if (p < end && *p == '_')
+    {
+      p ++;
+      const std::string word = parse_word (p, end);
+      if (word == "com")
+        dec = 16;
+      else if (word == "dac")
+        dec = 12;
+      else if (word == "def")
+        dec = 8;
+      else if (word == "trv")
+        dec = 4;
+      else
+        // [NaI] and illegal decorations
+        return false;
+    }
+
+  skip_blanks (p, end);
+  if (p != end)
+    return false;
+
+  if (is_empty)
+    {
+      l = +INFINITY;
+      u = -INFINITY;
+      // Empty intervals may only carry the trv decoration
+      return dec == 0 || dec == 4;
+    }
+
+  if (! (l <= u) || l == +INFINITY || u == -INFINITY)
+    return false;
+
+  // Only common intervals may carry the com decoration
+  if (dec == 16 && (l == -INFINITY || u == +INFINITY))
+    return false;
+
+  // Normalize signed zeros, as in the infsup constructor
+  if (l == 0.0)
+    l = -0.0;
+  if (u == 0.0)
+    u = +0.0;
+
+  return true;
+}
+
+DEFUN_DLD (__parse_interval_literals__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}, @var{D}, @var{VALID}, @var{REJECTED}, "
+  "@var{CONSUMED}] =} __parse_interval_literals__ (@var{S})\n"
+  "@deftypefnx {} {[@dots{}] =} __parse_interval_literals__ (@var{S}, "
+  "@var{N})\n"
+  "\n"
+  "Parse a text @var{S} with one interval literal per line."
+  "\n\n"
+  "Empty lines are skipped.  If @var{N} is given, parsing stops after "
+  "@var{N} interval literals.  The number of characters that have been "
+  "processed is returned in @var{CONSUMED}."
+  "\n\n"
+  "Column vectors @var{L} and @var{U} contain the lower and upper boundaries "
+  "of the interval literals, which are rounded outward.  @var{D} contains the "
+  "numeric decoration of each literal, or zero if the literal is not "
+  "decorated."
+  "\n\n"
+  "Only interval literals in inf-sup form with decimal or hexadecimal "
+  "boundaries are parsed.  Other literals, e. g., in uncertain form, are not "
+  "parsed and @var{VALID} is false for these.  Such literals are returned as "
+  "a cell array of strings @var{REJECTED} and must be parsed with the "
+  "interval constructor."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{interval_read}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin < 1 || nargin > 2)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const std::string text = args (0).string_value ();
+  double max_literals = INFINITY;
+  if (nargin >= 2)
+    max_literals = args (1).scalar_value ();
+
+  std::vector <double> result_l;
+  std::vector <double> result_u;
+  std::vector <uint8_t> result_d;
+  std::vector <bool> result_valid;
+  std::vector <std::string> rejected;
+
+  mpfr_t mp;
+  mpfr_init2 (mp, BINARY64_PRECISION);
+  mpfr_exp_t old_emin = mpfr_get_emin ();
+  mpfr_set_emin (BINARY64_EMIN);
+
+  const char *text_begin = text.c_str ();
+  const char *text_end = text_begin + text.length ();
+  const char *line_begin = text_begin;
+  while (line_begin < text_end && result_l.size () < max_literals)
+    {
+      const char *line_end = line_begin;
+      while (line_end < text_end && *line_end != '\n')
+        line_end ++;
+
+      const char *p = line_begin;
+      skip_blanks (p, line_end);
+      if (p != line_end)
+        {
+          double l = +INFINITY;
+          double u = -INFINITY;
+          uint8_t dec = 0;
+          const bool valid = parse_literal (mp, line_begin, line_end,
+                                            l, u, dec);
+          if (! valid)
+            {
+              l = +INFINITY;
+              u = -INFINITY;
+              dec = 0;
+              rejected.push_back (std::string (line_begin, line_end));
+            }
+          result_l.push_back (l);
+          result_u.push_back (u);
+          result_d.push_back (dec);
+          result_valid.push_back (valid);
+        }
+
+      line_begin = line_end;
+      if (line_begin < text_end)
+        // skip line break
+        line_begin ++;
+    }
+
+  mpfr_clear (mp);
+  mpfr_set_emin (old_emin);
+
+  const octave_idx_type n = result_l.size ();
+  NDArray l (dim_vector (n, 1));
+  NDArray u (dim_vector (n, 1));
+  uint8NDArray d (dim_vector (n, 1));
+  boolNDArray valid (dim_vector (n, 1));
+  for (octave_idx_type i = 0; i < n; i ++)
+    {
+      l.elem (i) = result_l[i];
+      u.elem (i) = result_u[i];
+      d.elem (i) = result_d[i];
+      valid.elem (i) = result_valid[i];
+    }
+
+  Cell rejected_literals (dim_vector (rejected.size (), 1));
+  for (std::size_t i = 0; i < rejected.size (); i ++)
+    rejected_literals.elem (i) = rejected[i];
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = d;
+  result (3) = valid;
+  result (4) = rejected_literals;
+  result (5) = static_cast <double> (line_begin - text_begin);
+  return result;
+}
+
+/*
+%!test
+%! [l, u, d, valid] = __parse_interval_literals__ ("[1, 2]\n[3]\n\n0x1p-2 0x1p-1\n");
+%! assert (l, [1; 3; 0.25]);
+%! assert (u, [2; 3; 0.5]);
+%! assert (d, zeros (3, 1, "uint8"));
+%! assert (valid, true (3, 1));
+%!test
+%! [l, u] = __parse_interval_literals__ ("[0.1, 0.1]");
+%! assert (l, inf (infsup ("0.1")));
+%! assert (u, sup (infsup ("0.1")));
+%!test
+%! [l, u, d, valid] = __parse_interval_literals__ ("[Empty]_trv\n[Entire]_dac\n[, 3]_com\n2 3 _def");
+%! assert (l, [inf; -inf; inf; 2]);
+%! assert (u, [-inf; inf; -inf; 3]);
+%! assert (d, uint8 ([4; 12; 0; 8]));
+%! assert (valid, logical ([1; 1; 0; 1]));
+%!test
+%! [~, ~, ~, valid, rejected] = __parse_interval_literals__ ("[1, 2]\n3.56?1\n[nai]\n");
+%! assert (valid, logical ([1; 0; 0]));
+%! assert (rejected, {"3.56?1"; "[nai]"});
+%!test
+%! [l, ~, ~, ~, ~, consumed] = __parse_interval_literals__ ("[1]\n[2]\n[3]\n", 2);
+%! assert (l, [1; 2]);
+%! assert (consumed, 8);
+%!test
+%! [l, u, ~, valid] = __parse_interval_literals__ ("[-Inf, 1]\n[2, inf]\ninf");
+%! assert (l, [-inf; 2; inf]);
+%! assert (u, [1; inf; -inf]);
+%! assert (valid, logical ([1; 1; 0]));
+%!test
+%! [l, u] = __parse_interval_literals__ ("[0]");
+%! assert (signbit (l), true);
+%! assert (signbit (u), false);
+*/
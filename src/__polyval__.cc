@@ -0,0 +1,286 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <cmath>
+#include <vector>
+#include "interval_kernels.h"
+
+// Maximum number of iterative refinement steps, see @infsup/polyval
+const int MAX_ITER = 20;
+
+// One step of Horner's scheme y * x + p, which is rounded only once
+inline bare_interval horner_step (exact_accumulator &accu,
+                                  const bare_interval y,
+                                  const bare_interval x,
+                                  const bare_interval p)
+{
+  accu.reset ();
+  accu.add_product (y, x);
+  accu.add (p);
+  return accu.result ();
+}
+
+// Horner's scheme for the polynomial p with n > 0 coefficients
+inline bare_interval horner (exact_accumulator &accu,
+                             const std::vector <bare_interval> &p,
+                             const bare_interval x)
+{
+  bare_interval y = p[0];
+  for (std::size_t i = 1; i < p.size (); i ++)
+    y = horner_step (accu, y, x, p[i]);
+  return y;
+}
+
+// Evaluate the polynomial p with n > 2 coefficients at the point x.  The
+// result of Horner's scheme is improved with iterative refinement: The
+// approximations y of the intermediate results of Horner's scheme are
+// corrected with the residuals yy of the linear system
+//   y(1) = p(1),  y(i) - x y(i - 1) = p(i),
+// which are computed with exact dot products.  Workspaces yy and y must
+// hold n and n * MAX_ITER elements.
+bare_interval refined_horner (directed_rounding &r, exact_accumulator &accu,
+                              const std::vector <bare_interval> &p,
+                              const double x,
+                              std::vector <bare_interval> &yy,
+                              std::vector <double> &y)
+{
+  const octave_idx_type n = p.size ();
+  const bare_interval point = {x, x};
+
+  // First approximation
+  yy[0] = p[0];
+  for (octave_idx_type i = 1; i < n; i ++)
+    yy[i] = horner_step (accu, yy[i - 1], point, p[i]);
+  bare_interval result = yy[n - 1];
+
+  for (int k = 0; k < MAX_ITER && ! is_empty (result); k ++)
+    {
+      const bare_interval last_result = result;
+
+      // Store the middle of the residual as the next correction of y
+      for (octave_idx_type i = 0; i < n; i ++)
+        y[i + k * n] = interval_mid (r, yy[i]);
+
+      // Residuals of the system with all corrections so far
+      for (octave_idx_type i = 0; i < n; i ++)
+        {
+          accu.reset ();
+          accu.add (p[i]);
+          if (i > 0)
+            accu.add_product (yy[i - 1], point);
+          for (int j = 0; j <= k; j ++)
+            {
+              const bare_interval y_ij = {-y[i + j * n], -y[i + j * n]};
+              accu.add (y_ij);
+              if (i > 0)
+                {
+                  const bare_interval y_prev = {y[i - 1 + j * n],
+                                                y[i - 1 + j * n]};
+                  accu.add_product (y_prev, point);
+                }
+            }
+          yy[i] = accu.result ();
+        }
+
+      // New enclosure of p (x)
+      accu.reset ();
+      accu.add (yy[n - 1]);
+      for (int j = 0; j <= k; j ++)
+        {
+          const bare_interval y_nj = {y[n - 1 + j * n], y[n - 1 + j * n]};
+          accu.add (y_nj);
+        }
+      result = interval_intersect (result, accu.result ());
+
+      if (result.inf == last_result.inf && result.sup == last_result.sup)
+        // No improvement
+        break;
+      if (std::nextafter (result.inf, INFINITY) >= result.sup)
+        // 1 ULP accuracy reached
+        break;
+    }
+
+  return result;
+}
+
+DEFUN_DLD (__polyval__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __polyval__ (@var{PL}, @var{PU}, "
+  "@var{XL}, @var{XU}, @var{CENTERED})\n"
+  "\n"
+  "Evaluate the polynomial with coefficients [@var{PL}, @var{PU}] at each "
+  "element of the interval array [@var{XL}, @var{XU}]."
+  "\n\n"
+  "Each step of Horner's scheme is computed with an exact dot product and "
+  "rounded only once.  For singleton intervals, the result is improved with "
+  "iterative refinement.  If @var{CENTERED} is true, the result for other "
+  "intervals is intersected with the centered form "
+  "@code{p (c) + p' (X) * (X - c)}, where c is the midpoint of X.  The "
+  "elements are evaluated in parallel if the package has been compiled with "
+  "OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/polyval}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 5)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const NDArray pl = args (0).array_value ();
+  const NDArray pu = args (1).array_value ();
+  const NDArray xl = args (2).array_value ();
+  const NDArray xu = args (3).array_value ();
+  const bool centered = args (4).bool_value ();
+  if (pl.numel () != pu.numel () || xl.dims () != xu.dims ())
+    {
+      error ("__polyval__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  // Coefficients of the polynomial and of its derivative
+  const octave_idx_type n = pl.numel ();
+  std::vector <bare_interval> p (n);
+  std::vector <bare_interval> dp (n > 1 ? n - 1 : 0);
+  {
+    directed_rounding r;
+    for (octave_idx_type i = 0; i < n; i ++)
+      {
+        p[i].inf = pl(i);
+        p[i].sup = pu(i);
+      }
+    for (octave_idx_type i = 0; i + 1 < n; i ++)
+      {
+        const bare_interval power = {(double) (n - 1 - i),
+                                     (double) (n - 1 - i)};
+        dp[i] = interval_times (r, p[i], power);
+      }
+  }
+
+  NDArray result_l (xl.dims ());
+  NDArray result_u (xl.dims ());
+  const double *xl_data = xl.data ();
+  const double *xu_data = xu.data ();
+  double *l_data = result_l.fortran_vec ();
+  double *u_data = result_u.fortran_vec ();
+  const octave_idx_type points = xl.numel ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (points >= 100)
+#endif
+  {
+    // Each thread uses its own MPFR variables and workspaces
+    directed_rounding r;
+    exact_accumulator accu;
+    std::vector <bare_interval> yy (n);
+    std::vector <double> y (n * MAX_ITER);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (dynamic, 64)
+#endif
+    for (octave_idx_type k = 0; k < points; k ++)
+      {
+        const bare_interval x = {xl_data[k], xu_data[k]};
+        bare_interval result;
+        if (n == 0)
+          {
+            // Empty sum
+            result.inf = -0.0;
+            result.sup = +0.0;
+          }
+        else if (n == 1)
+          result = p[0];
+        else if (is_empty (x))
+          result = empty_interval ();
+        else if (n == 2)
+          // A single occurrence of x, which is tight
+          result = horner_step (accu, p[0], x, p[1]);
+        else if (x.inf == 0.0 && x.sup == 0.0)
+          result = p[n - 1];
+        else if (x.inf == x.sup && std::abs (x.inf) == 1.0)
+          {
+            // Exact sum of the coefficients with alternating signs
+            accu.reset ();
+            for (octave_idx_type i = 0; i < n; i ++)
+              if (x.inf == 1.0 || (n - 1 - i) % 2 == 0)
+                accu.add (p[i]);
+              else
+                accu.add (interval_uminus (p[i]));
+            result = accu.result ();
+          }
+        else if (x.inf == x.sup)
+          result = refined_horner (r, accu, p, x.inf, yy, y);
+        else
+          {
+            result = horner (accu, p, x);
+            if (centered)
+              {
+                const double c = interval_mid (r, x);
+                const bare_interval midpoint = {c, c};
+                const bare_interval fc = refined_horner (r, accu, p, c,
+                                                         yy, y);
+                const bare_interval slope = horner (accu, dp, x);
+                accu.reset ();
+                accu.add (fc);
+                accu.add_product (slope, interval_minus (r, x, midpoint));
+                result = interval_intersect (result, accu.result ());
+              }
+          }
+        l_data[k] = result.inf;
+        u_data[k] = result.sup;
+      }
+  }
+
+  octave_value_list result;
+  result (0) = result_l;
+  result (1) = result_u;
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __polyval__ ([3, 4, 2, 1], [3, 4, 2, 1], [42, 41.5], [42, 42.5], false);
+%! assert (l, [229405, 221393.125]);
+%! assert (u, [229405, 237607.875]);
+%!test
+%! [l, u] = __polyval__ ([1, 0, 0], [1, 0, 0], -1, 1, false);
+%! assert ([l, u], [0, 1]);
+%!test
+%! [l, u] = __polyval__ ([1, -2, 1], [1, -2, 1], 0.9, 1.1, true);
+%! [l0, u0] = __polyval__ ([1, -2, 1], [1, -2, 1], 0.9, 1.1, false);
+%! assert (l0 <= l && u <= u0);
+%! assert (l <= 0 && 0.01 <= u);
+%!test
+%! [l, u] = __polyval__ ([42, 42], [42, 42], [0, 1, -1], [0, 1, -1], false);
+%! assert (l, [42, 84, 0]);
+%! assert (u, [42, 84, 0]);
+%!test
+%! [l, u] = __polyval__ ([], [], zeros (2, 2), zeros (2, 2), false);
+%! assert (l, zeros (2, 2));
+%!test
+%! [l, u] = __polyval__ ([1, 2, 3], [1, 2, 3], inf, -inf, false);
+%! assert ([l, u], [inf, -inf]);
+%!error __polyval__ (1, [1, 2], 1, 1, false)
+*/
@@ -0,0 +1,159 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__prod__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __prod__ (@var{XL}, @var{XU}, "
+  "@var{DIM})\n"
+  "\n"
+  "Compute the product of the interval array with lower boundaries @var{XL} "
+  "and upper boundaries @var{XU} along dimension @var{DIM}."
+  "\n\n"
+  "Each slice along @var{DIM} is multiplied in a single pass with the "
+  "interval product and directed rounding.  Once the running product is "
+  "empty, zero, or entire, the remaining factors can change the result "
+  "only if they are empty (or zero for an entire product), and they are "
+  "not multiplied anymore.  The slices are computed in parallel if the "
+  "package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/prod}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 3)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const NDArray l = args (0).array_value ();
+  const NDArray u = args (1).array_value ();
+  const int dim = args (2).int_value ();
+  const dim_vector dims = l.dims ();
+  if (u.dims () != dims)
+    {
+      error ("__prod__: nonconformant arguments");
+      return octave_value_list ();
+    }
+  if (dim < 1)
+    {
+      error ("__prod__: DIM must be a valid dimension");
+      return octave_value_list ();
+    }
+
+  // Element k of slice (a, b) is at a + k * before + b * before * n
+  octave_idx_type before = 1;
+  octave_idx_type after = 1;
+  for (int i = 0; i < dims.ndims (); i ++)
+    if (i < dim - 1)
+      before *= dims(i);
+    else if (i > dim - 1)
+      after *= dims(i);
+  const octave_idx_type n = dim <= dims.ndims () ? dims(dim - 1) : 1;
+  const octave_idx_type slices = before * after;
+
+  dim_vector result_dims = dims;
+  if (dim <= result_dims.ndims ())
+    result_dims(dim - 1) = 1;
+  NDArray result_l (result_dims);
+  NDArray result_u (result_dims);
+  const double *l_data = l.data ();
+  const double *u_data = u.data ();
+  double *result_l_data = result_l.fortran_vec ();
+  double *result_u_data = result_u.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (slices >= 16 && slices * n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type s = 0; s < slices; s ++)
+      {
+        const octave_idx_type a = s % before;
+        const octave_idx_type b = s / before;
+        const octave_idx_type first = a + b * before * n;
+        bare_interval product = {1.0, 1.0};
+        for (octave_idx_type k = 0; k < n; k ++)
+          {
+            const octave_idx_type idx = first + k * before;
+            const bare_interval x = {l_data[idx], u_data[idx]};
+            if (is_empty (x))
+              {
+                product = empty_interval ();
+                break;
+              }
+            if (product.inf == 0.0 && product.sup == 0.0)
+              // [0] × anything but [Empty] = [0]
+              continue;
+            if (product.inf == -INFINITY && product.sup == INFINITY
+                && ! (x.inf == 0.0 && x.sup == 0.0))
+              // [Entire] × anything but [0] or [Empty] = [Entire]
+              continue;
+            product = interval_times (r, product, x);
+          }
+        result_l_data[s] = product.inf;
+        result_u_data[s] = product.sup;
+      }
+  }
+
+  octave_value_list result;
+  result (0) = result_l;
+  result (1) = result_u;
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __prod__ ([1, 2, 3, 4], [1, 2, 3, 4], 2);
+%! assert ([l, u], [24, 24]);
+%!test
+%! [l, u] = __prod__ (magic (3), magic (3), 1);
+%! assert (l, prod (magic (3)));
+%! [l, u] = __prod__ (magic (3), magic (3), 2);
+%! assert (u, prod (magic (3), 2));
+%!test
+%! [l, u] = __prod__ ([-1, 0, inf], [2, 0, -inf], 2);
+%! assert ([l, u], [inf, -inf]);
+%!test
+%! [l, u] = __prod__ ([-inf, 0, 1], [inf, 0, 2], 2);
+%! assert ([l, u], [0, 0]);
+%!test
+%! [l, u] = __prod__ ([-1, -inf, 2], [1, inf, 3], 2);
+%! assert ([l, u], [-inf, inf]);
+%!test
+%! [l, u] = __prod__ (zeros (0, 3), zeros (0, 3), 1);
+%! assert (l, ones (1, 3));
+%! assert (u, ones (1, 3));
+%!test
+%! x = reshape (1 : 24, 1, 2, 3, 4);
+%! [l, u] = __prod__ (x, x, 3);
+%! assert (l, prod (x, 3));
+%!error __prod__ (1, [1, 2], 1)
+*/
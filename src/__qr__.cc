@@ -0,0 +1,226 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <vector>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__qr__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{QL}, @var{QU}, @var{RL}, @var{RU}, @var{PERM}] =} "
+  "__qr__ (@var{L}, @var{U}, @var{PIVOT})\n"
+  "\n"
+  "Compute the QR decomposition of the interval matrix with lower "
+  "boundaries @var{L} and upper boundaries @var{U} by the Gram-Schmidt "
+  "process."
+  "\n\n"
+  "The M×C matrix is padded with zeros to a square matrix of size "
+  "N = max (M, C).  The N×N matrices Q and R are returned by their "
+  "boundaries.  Each column of Q is normalized with the reverse operation "
+  "of multiplication, norms and projections are computed with exact dot "
+  "products."
+  "\n\n"
+  "If @var{PIVOT} is true, the column with the largest norm is chosen as "
+  "the next pivot among the first C - 1 columns.  @var{PERM} is the "
+  "resulting order of the columns.  The projections onto each pivot "
+  "column are computed in parallel if the package has been compiled with "
+  "OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/qr}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 3)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  Matrix l = args (0).matrix_value ();
+  Matrix u = args (1).matrix_value ();
+  const bool pivot = args (2).bool_value ();
+  const octave_idx_type m = l.rows ();
+  const octave_idx_type c = l.columns ();
+  if (u.rows () != m || u.columns () != c)
+    {
+      error ("__qr__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  const octave_idx_type n = std::max (m, c);
+  Matrix ql (n, n, 0.0);
+  Matrix qu (n, n, 0.0);
+  Matrix rl (n, n, 0.0);
+  Matrix ru (n, n, 0.0);
+  for (octave_idx_type j = 0; j < c; j ++)
+    for (octave_idx_type i = 0; i < m; i ++)
+      {
+        ql(i, j) = l(i, j);
+        qu(i, j) = u(i, j);
+      }
+  double *ql_data = ql.fortran_vec ();
+  double *qu_data = qu.fortran_vec ();
+  double *rl_data = rl.fortran_vec ();
+  double *ru_data = ru.fortran_vec ();
+
+  Matrix perm (1, n);
+  for (octave_idx_type j = 0; j < n; j ++)
+    perm(j) = j + 1;
+  std::vector <double> norm_mig (n);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 64)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    exact_accumulator accu;
+    const bare_interval unit = {-1.0, 1.0};
+
+    for (octave_idx_type i = 0; i < n; i ++)
+      {
+        const octave_idx_type col_i = i * n;
+        if (pivot && i < c - 1)
+          {
+            // Lower bound of the squared norm of each remaining column
+#if defined (_OPENMP)
+            #pragma omp for schedule (static)
+#endif
+            for (octave_idx_type j = i; j < n; j ++)
+              {
+                accu.reset ();
+                for (octave_idx_type k = 0; k < n; k ++)
+                  {
+                    const bare_interval q = {ql_data[k + j * n],
+                                             qu_data[k + j * n]};
+                    accu.add_square (q);
+                  }
+                norm_mig[j] = mig (accu.result ());
+              }
+
+            // Swap columns of Q and R, choose the column with maximum norm
+            // as next pivot
+#if defined (_OPENMP)
+            #pragma omp single
+#endif
+            {
+              const octave_idx_type j =
+                std::max_element (norm_mig.begin () + i, norm_mig.end ())
+                - norm_mig.begin ();
+              if (j != i)
+                {
+                  for (octave_idx_type k = 0; k < n; k ++)
+                    {
+                      std::swap (ql_data[k + col_i], ql_data[k + j * n]);
+                      std::swap (qu_data[k + col_i], qu_data[k + j * n]);
+                      std::swap (rl_data[k + col_i], rl_data[k + j * n]);
+                      std::swap (ru_data[k + col_i], ru_data[k + j * n]);
+                    }
+                  std::swap (perm(i), perm(j));
+                }
+            }
+          }
+
+        // Normalize column i
+#if defined (_OPENMP)
+        #pragma omp single
+#endif
+        {
+          accu.reset ();
+          for (octave_idx_type k = 0; k < n; k ++)
+            {
+              const bare_interval q = {ql_data[k + col_i], qu_data[k + col_i]};
+              accu.add_square (q);
+            }
+          const bare_interval d = interval_realsqrt (r, accu.result ());
+          for (octave_idx_type k = 0; k < n; k ++)
+            {
+              const bare_interval q = {ql_data[k + col_i], qu_data[k + col_i]};
+              const bare_interval q_k = interval_mulrev (r, d, q, unit);
+              ql_data[k + col_i] = q_k.inf;
+              qu_data[k + col_i] = q_k.sup;
+            }
+          rl_data[i + col_i] = d.inf;
+          ru_data[i + col_i] = d.sup;
+        }
+
+        // Subtract the projections onto column i from the other columns
+#if defined (_OPENMP)
+        #pragma omp for schedule (static)
+#endif
+        for (octave_idx_type j = i + 1; j < n; j ++)
+          {
+            const octave_idx_type col_j = j * n;
+            accu.reset ();
+            for (octave_idx_type k = 0; k < n; k ++)
+              {
+                const bare_interval q_i = {ql_data[k + col_i],
+                                           qu_data[k + col_i]};
+                const bare_interval q_j = {ql_data[k + col_j],
+                                           qu_data[k + col_j]};
+                accu.add_product (q_j, q_i);
+              }
+            const bare_interval d = accu.result ();
+            for (octave_idx_type k = 0; k < n; k ++)
+              {
+                const bare_interval q_i = {ql_data[k + col_i],
+                                           qu_data[k + col_i]};
+                const bare_interval q_j = {ql_data[k + col_j],
+                                           qu_data[k + col_j]};
+                const bare_interval q =
+                  interval_minus (r, q_j, interval_times (r, d, q_i));
+                ql_data[k + col_j] = q.inf;
+                qu_data[k + col_j] = q.sup;
+              }
+            rl_data[i + col_j] = d.inf;
+            ru_data[i + col_j] = d.sup;
+          }
+      }
+  }
+
+  octave_value_list result;
+  result (0) = ql;
+  result (1) = qu;
+  result (2) = rl;
+  result (3) = ru;
+  result (4) = perm;
+  return result;
+}
+
+/*
+%!test
+%! [ql, qu, rl, ru] = __qr__ ([3, 0; 4, 1], [3, 0; 4, 1], false);
+%! assert (ql <= [0.6, -0.8; 0.8, 0.6] & [0.6, -0.8; 0.8, 0.6] <= qu);
+%! assert ([rl(1, 1), ru(1, 1)], [5, 5]);
+%! assert (rl(1, 2) <= 0.8 && 0.8 <= ru(1, 2));
+%! assert ([rl(2, 1), ru(2, 1)], [0, 0]);
+%!test
+%! [ql, qu, rl, ru, perm] = __qr__ ([1, 2, 3; 4, 5, 6], [1, 2, 3; 4, 5, 6], true);
+%! assert (size (ql), [3, 3]);
+%! assert (perm(1), 3);
+%! assert (sort (perm), 1 : 3);
+%!test
+%! [ql, qu] = __qr__ (magic (5), magic (5), false);
+%! assert (max (max (qu - ql)) < 1e-10);
+%!error __qr__ (ones (2), ones (3), false)
+*/
@@ -0,0 +1,297 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "interval_kernels.h"
+
+// Decorations of IEEE Std 1788-2015, see @infsupdec/private/_*.m
+const uint8_t DEC_ILL = 0;
+const uint8_t DEC_TRV = 4;
+const uint8_t DEC_DAC = 12;
+const uint8_t DEC_COM = 16;
+
+enum set_operation {HULL, INTERSECT, UNION, SETDIFF, SETXOR};
+
+DEFUN_DLD (__set_operation__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}, @var{D}] =} __set_operation__ "
+  "(@var{OP}, @var{L1}, @var{U1}, @var{D1}, @dots{}, @var{LN}, @var{UN}, "
+  "@var{DN})\n"
+  "@deftypefnx {} {[@var{L}, @var{U}, @var{D}, @var{L1}, @var{U1}, "
+  "@var{L2}, @var{U2}] =} __set_operation__ (\"setxor\", @var{LA}, @var{UA}, "
+  "@var{DA}, @var{LB}, @var{UB}, @var{DB})\n"
+  "\n"
+  "Compute the interval set operation @var{OP} of the intervals with lower "
+  "boundaries @var{Lk}, upper boundaries @var{Uk}, and uint8 decorations "
+  "@var{Dk} in a single pass."
+  "\n\n"
+  "@var{OP} is @code{\"hull\"}, @code{\"intersect\"}, or @code{\"union\"} "
+  "for any number of operands, or @code{\"setdiff\"} or @code{\"setxor\"} "
+  "for two operands.  Empty decorations @var{Dk} denote undecorated "
+  "operands.  All operands are broadcasted to the size of the result.  Empty "
+  "results are returned as @var{L} = inf and @var{U} = -inf.  Errors "
+  "concerning the operands are reported with the name @var{OP}."
+  "\n\n"
+  "With @code{\"hull\"}, NaN boundaries are ignored and @var{D} is the best "
+  "possible decoration of the result, which is @code{trv} if any boundary "
+  "is NaN, limited by the decorations of the operands, see @code{hull}.  A "
+  "decoration @code{ill} of any operand produces an empty result with "
+  "decoration @code{ill}.  For the other operations, @var{D} is @code{trv} "
+  "or @code{ill}."
+  "\n\n"
+  "With @code{\"setxor\"}, the parts of the symmetric difference below and "
+  "above the intersection are returned additionally, see "
+  "@code{@@infsup/setxor}."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{hull, @@infsup/intersect, @@infsup/union, @@infsup/setdiff, "
+  "@@infsup/setxor}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin < 1 || (nargin - 1) % 3 != 0)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const std::string op_name = args (0).string_value ();
+  set_operation op;
+  if (op_name == "hull")
+    op = HULL;
+  else if (op_name == "intersect")
+    op = INTERSECT;
+  else if (op_name == "union")
+    op = UNION;
+  else if (op_name == "setdiff")
+    op = SETDIFF;
+  else if (op_name == "setxor")
+    op = SETXOR;
+  else
+    {
+      error ("__set_operation__: unknown operation '%s'", op_name.c_str ());
+      return octave_value_list ();
+    }
+  const int n = (nargin - 1) / 3;
+  if (n == 0 || ((op == SETDIFF || op == SETXOR) && n != 2))
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  // Errors concerning the operands are reported with the name of the public
+  // function, which is the name of the operation
+  const char *mismatch = op == HULL ? "dimensions mismatch"
+                                    : "nonconformant arguments";
+
+  // Keep the operands alive while their data is in use
+  std::vector <NDArray> boundaries;
+  std::vector <uint8NDArray> decorations;
+  boundaries.reserve (2 * n);
+  decorations.reserve (n);
+  std::vector <broadcast_operand> operands (n);
+  for (int k = 0; k < n; k ++)
+    {
+      boundaries.push_back (args (1 + 3 * k).array_value ());
+      boundaries.push_back (args (2 + 3 * k).array_value ());
+      const NDArray &l = boundaries[2 * k];
+      const NDArray &u = boundaries[2 * k + 1];
+      if (l.dims () != u.dims ())
+        {
+          error ("%s: %s", op_name.c_str (), mismatch);
+          return octave_value_list ();
+        }
+      operands[k].inf = l.data ();
+      operands[k].sup = u.data ();
+      operands[k].dec = NULL;
+      operands[k].dims = l.dims ();
+      if (! args (3 + 3 * k).isempty ())
+        {
+          decorations.push_back (args (3 + 3 * k).uint8_array_value ());
+          if (decorations.back ().dims () != l.dims ())
+            {
+              error ("%s: %s", op_name.c_str (), mismatch);
+              return octave_value_list ();
+            }
+          operands[k].dec = decorations.back ().data ();
+        }
+    }
+
+  // Non-singleton dimensions of the operands must agree
+  dim_vector result_dims;
+  if (! broadcast_operands (operands.data (), n, result_dims))
+    {
+      error ("%s: %s", op_name.c_str (), mismatch);
+      return octave_value_list ();
+    }
+
+  const octave_idx_type elements = result_dims.numel ();
+  NDArray l (result_dims), u (result_dims);
+  NDArray l1, u1, l2, u2;
+  uint8NDArray d (result_dims);
+  if (op == SETXOR)
+    {
+      l1 = u1 = l2 = u2 = NDArray (result_dims);
+    }
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  octave_uint8 *d_data = d.fortran_vec ();
+  double *l1_data = op == SETXOR ? l1.fortran_vec () : NULL;
+  double *u1_data = op == SETXOR ? u1.fortran_vec () : NULL;
+  double *l2_data = op == SETXOR ? l2.fortran_vec () : NULL;
+  double *u2_data = op == SETXOR ? u2.fortran_vec () : NULL;
+
+  // The operations are cheap, such that only large arrays benefit from
+  // multiple threads
+#if defined (_OPENMP)
+  #pragma omp parallel for schedule (static) if (elements * n >= 100000)
+#endif
+  for (octave_idx_type i = 0; i < elements; i ++)
+    {
+      bare_interval result = op == INTERSECT ? entire_interval ()
+                                             : empty_interval ();
+      bare_interval c1, c2;
+      uint8_t dec = DEC_COM;
+      bool missing = false;
+      bare_interval x[2];
+      for (int k = 0; k < n; k ++)
+        {
+          const broadcast_operand &operand = operands[k];
+          const octave_idx_type idx = operand.index (result_dims, i);
+          const bare_interval operand_value = {operand.inf[idx],
+                                               operand.sup[idx]};
+          if (operand.dec != NULL)
+            dec = std::min (dec, operand.dec[idx].value ());
+          switch (op)
+            {
+            case HULL:
+              // NaNs represent missing values
+              if (std::isnan (operand_value.inf)
+                  || std::isnan (operand_value.sup))
+                missing = true;
+              if (! std::isnan (operand_value.inf))
+                result.inf = std::min (result.inf, operand_value.inf);
+              if (! std::isnan (operand_value.sup))
+                result.sup = std::max (result.sup, operand_value.sup);
+              break;
+            case INTERSECT:
+              result = interval_intersect (result, operand_value);
+              break;
+            case UNION:
+              result = interval_hull (result, operand_value);
+              break;
+            default:
+              x[k] = operand_value;
+            }
+        }
+
+      if (op == SETDIFF)
+        result = interval_setdiff (x[0], x[1]);
+      else if (op == SETXOR)
+        result = interval_setxor (x[0], x[1], c1, c2);
+
+      if (op != HULL)
+        dec = std::min (dec, DEC_TRV);
+      else if (dec == DEC_ILL || is_empty (result))
+        {
+          result = empty_interval ();
+          dec = std::min (dec, DEC_TRV);
+        }
+      else
+        {
+          // Best possible decoration
+          if (missing)
+            dec = std::min (dec, DEC_TRV);
+          else if (std::isinf (result.inf) || std::isinf (result.sup))
+            dec = std::min (dec, DEC_DAC);
+        }
+      if (! is_empty (result))
+        result = normalize_zero (result);
+
+      l_data[i] = result.inf;
+      u_data[i] = result.sup;
+      d_data[i] = dec;
+      if (op == SETXOR)
+        {
+          l1_data[i] = c1.inf;
+          u1_data[i] = c1.sup;
+          l2_data[i] = c2.inf;
+          u2_data[i] = c2.sup;
+        }
+    }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  result (2) = d;
+  if (op == SETXOR)
+    {
+      result (3) = l1;
+      result (4) = u1;
+      result (5) = l2;
+      result (6) = u2;
+    }
+  return result;
+}
+
+/*
+%!test
+%! [l, u, d] = __set_operation__ ("hull", 2, 2, [], NaN, NaN, [], [3, 1], [3, 1], [], 5, 5, []);
+%! assert (l, [2, 1]);
+%! assert (u, [5, 5]);
+%! assert (d, uint8 ([4, 4]));
+%!test
+%! [l, u, d] = __set_operation__ ("hull", [1, 2, 3], [1, 2, 3], [], [5; 0], [5; 0], []);
+%! assert (l, [1, 2, 3; 0, 0, 0]);
+%! assert (u, [5, 5, 5; 1, 2, 3]);
+%! assert (d, uint8 (16 (ones (2, 3))));
+%!test
+%! [l, u, d] = __set_operation__ ("hull", [inf, 1, 1], [-inf, 2, inf], uint8 ([4, 8, 16]), [-inf, 1, 2], [inf, 1, 2], uint8 ([12, 0, 16]));
+%! assert (l, [-inf, inf, 1]);
+%! assert (u, [inf, -inf, inf]);
+%! assert (d, uint8 ([4, 0, 12]));
+%!test
+%! [l, u, d] = __set_operation__ ("intersect", [1; 2], [3; 4], [], 2.5, 5, [], [0, 4], [3, 4], []);
+%! assert (l, [2.5, inf; 2.5, 4]);
+%! assert (u, [3, -inf; 3, 4]);
+%! assert (d, uint8 (4 (ones (2, 2))));
+%!test
+%! [l, u] = __set_operation__ ("union", inf, -inf, [], [1, 0], [2, 0], []);
+%! assert (l, [1, 0]);
+%! assert (signbit (l(2)));
+%! assert (u, [2, 0]);
+%!test
+%! [l, u, d] = __set_operation__ ("setdiff", [1, 1, 1], [3, 3, 3], uint8 ([16, 16, 0]), [2, 1, 0], [4, 4, 0], []);
+%! assert (l, [1, inf, 1]);
+%! assert (u, [2, -inf, 3]);
+%! assert (d, uint8 ([4, 4, 0]));
+%!test
+%! [l, u, d, l1, u1, l2, u2] = __set_operation__ ("setxor", 1, 3, [], 2, 4, []);
+%! assert ([l, u, l1, u1, l2, u2], [1, 4, 1, 2, 3, 4]);
+%!error <hull: dimensions mismatch> __set_operation__ ("hull", 1 : 2, 1 : 2, [], 1 : 3, 1 : 3, [])
+%!error <union: nonconformant arguments> __set_operation__ ("union", 1 : 2, 1 : 2, [], 1 : 3, 1 : 3, [])
+%!error __set_operation__ ("setdiff", 1, 1, [])
+%!error __set_operation__ ("split", 1, 1, [])
+*/
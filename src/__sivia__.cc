@@ -0,0 +1,327 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <vector>
+#include "interval_kernels.h"
+
+// Result of the comparison of a box's function value with the codomain
+enum box_state
+{
+  BOX_OUTSIDE,   // the box is outside of the preimage
+  BOX_INSIDE,    // the box is inside of the preimage
+  BOX_BOUNDARY,  // the box is undecided and shall not be bisected further
+  BOX_BISECT     // the box is undecided and shall be bisected
+};
+
+DEFUN_DLD (__sivia__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{QL}, @var{QU}, @var{PL}, @var{PU}, @var{INNER}, "
+  "@var{XL}, @var{XU}] =} __sivia__ (@var{L}, @var{U}, @var{FL}, @var{FU}, "
+  "@var{YL}, @var{YU}, @var{TOLX}, @var{TOLFUN}, @var{FINAL}, @var{PRUNE}, "
+  "@var{XL}, @var{XU})\n"
+  "\n"
+  "Compute one iteration of set inversion via interval arithmetic (SIVIA) "
+  "on a queue of interval boxes."
+  "\n\n"
+  "The d×Q matrices @var{L} and @var{U} contain the boundaries of Q boxes, "
+  "one box per column.  The R×Q matrices @var{FL} and @var{FU} contain the "
+  "function values of the boxes, which are compared with the codomain "
+  "[@var{YL}, @var{YU}] of R elements.  Function values or codomains with a "
+  "single row (and function values with a single column) are broadcasted."
+  "\n\n"
+  "Boxes, whose function value is disjoint from the codomain, are "
+  "discarded.  Boxes, whose function value is a subset of the codomain, are "
+  "stored as inner boxes in the columns of [@var{PL}, @var{PU}].  Other boxes "
+  "are stored as boundary boxes if @var{FINAL} is true, if the maximum width "
+  "of their function value is less than @var{TOLFUN}, or if their maximum "
+  "width is less than @var{TOLX}.  The remaining boxes are bisected at their "
+  "widest coordinate, the halves form the new queue [@var{QL}, @var{QU}]."
+  "\n\n"
+  "Inner boxes precede the boundary boxes in the result and the logical row "
+  "vector @var{INNER} marks them.  The hull [@var{XL}, @var{XU}] of all "
+  "stored boxes is updated with the boxes of this iteration.  If @var{PRUNE} "
+  "is true, halves which are subsets of the hull are removed from the new "
+  "queue.  The classification and bisection of boxes run in parallel if the "
+  "package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/fsolve}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 12)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const Matrix l = args (0).matrix_value ();
+  const Matrix u = args (1).matrix_value ();
+  const Matrix fl = args (2).matrix_value ();
+  const Matrix fu = args (3).matrix_value ();
+  const NDArray yl = args (4).array_value ();
+  const NDArray yu = args (5).array_value ();
+  const double tolx = args (6).double_value ();
+  const double tolfun = args (7).double_value ();
+  const bool final = args (8).bool_value ();
+  const bool prune = args (9).bool_value ();
+  ColumnVector xl = args (10).column_vector_value ();
+  ColumnVector xu = args (11).column_vector_value ();
+
+  const octave_idx_type d = l.rows ();
+  const octave_idx_type q = l.columns ();
+  const octave_idx_type rf = fl.rows ();
+  const octave_idx_type ry = yl.numel ();
+  if (u.dims () != l.dims () || fu.dims () != fl.dims ()
+      || yu.numel () != ry || xl.numel () != d || xu.numel () != d)
+    {
+      error ("__sivia__: inconsistent interval boundaries");
+      return octave_value_list ();
+    }
+  if ((fl.columns () != q && fl.columns () != 1)
+      || (rf != ry && rf != 1 && ry != 1))
+    {
+      error ("__sivia__: nonconformant arguments");
+      return octave_value_list ();
+    }
+  const octave_idx_type r_max = std::max (rf, ry);
+  const bool broadcast_f = fl.columns () != q;
+
+  std::vector <box_state> state (q);
+  std::vector <octave_idx_type> coord (q, 0);
+  std::vector <double> middle (q);
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (q >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type j = 0; j < q; j ++)
+      {
+        const octave_idx_type fj = broadcast_f ? 0 : j;
+
+        // Compare the function value with the codomain, the maximum width
+        // ignores empty intervals
+        bool outside = false;
+        bool inside = true;
+        double fwid = NAN;
+        for (octave_idx_type i = 0; i < r_max; i ++)
+          {
+            const octave_idx_type fi = rf == 1 ? 0 : i;
+            const octave_idx_type yi = ry == 1 ? 0 : i;
+            const bare_interval f = {fl(fi, fj), fu(fi, fj)};
+            const bare_interval y = {yl(yi), yu(yi)};
+            if (is_empty (f) || is_empty (y)
+                || f.sup < y.inf || y.sup < f.inf)
+              outside = true;
+            if (! (y.inf <= f.inf && f.sup <= y.sup))
+              inside = false;
+            const double w = interval_wid (r, f);
+            if (std::isnan (fwid) || w > fwid)
+              fwid = w;
+          }
+
+        if (outside)
+          {
+            state[j] = BOX_OUTSIDE;
+            continue;
+          }
+        if (inside)
+          {
+            state[j] = BOX_INSIDE;
+            continue;
+          }
+        if (final)
+          {
+            state[j] = BOX_BOUNDARY;
+            continue;
+          }
+
+        // Find the first coordinate with maximum width
+        double xwid = NAN;
+        for (octave_idx_type k = 0; k < d; k ++)
+          {
+            const bare_interval x = {l(k, j), u(k, j)};
+            const double w = interval_wid (r, x);
+            if (std::isnan (xwid) || w > xwid)
+              {
+                xwid = w;
+                coord[j] = k;
+              }
+          }
+
+        if (fwid < tolfun || xwid < tolx)
+          {
+            state[j] = BOX_BOUNDARY;
+            continue;
+          }
+        state[j] = BOX_BISECT;
+        const bare_interval x = {l(coord[j], j), u(coord[j], j)};
+        middle[j] = interval_mid (r, x);
+      }
+  }
+
+  octave_idx_type n_inside = 0;
+  octave_idx_type n_boundary = 0;
+  octave_idx_type n_bisect = 0;
+  for (octave_idx_type j = 0; j < q; j ++)
+    switch (state[j])
+      {
+        case BOX_INSIDE:
+          n_inside ++;
+          break;
+        case BOX_BOUNDARY:
+          n_boundary ++;
+          break;
+        case BOX_BISECT:
+          n_bisect ++;
+          break;
+        default:
+          break;
+      }
+
+  // Store inner boxes first, then boundary boxes
+  Matrix pl (d, n_inside + n_boundary);
+  Matrix pu (d, n_inside + n_boundary);
+  boolNDArray inner (dim_vector (1, n_inside + n_boundary), false);
+  octave_idx_type next_inside = 0;
+  octave_idx_type next_boundary = n_inside;
+  for (octave_idx_type j = 0; j < q; j ++)
+    {
+      octave_idx_type p;
+      if (state[j] == BOX_INSIDE)
+        {
+          p = next_inside ++;
+          inner(p) = true;
+        }
+      else if (state[j] == BOX_BOUNDARY)
+        p = next_boundary ++;
+      else
+        continue;
+
+      for (octave_idx_type k = 0; k < d; k ++)
+        {
+          pl(k, p) = l(k, j);
+          pu(k, p) = u(k, j);
+          xl(k) = std::min (xl(k), l(k, j));
+          xu(k) = std::max (xu(k), u(k, j));
+        }
+    }
+
+  // Bisect the remaining boxes, the new queue contains all lower halves
+  // followed by all upper halves
+  std::vector <bool> keep (2 * n_bisect, true);
+  Matrix ql (d, 2 * n_bisect);
+  Matrix qu (d, 2 * n_bisect);
+  octave_idx_type b = 0;
+  for (octave_idx_type j = 0; j < q; j ++)
+    {
+      if (state[j] != BOX_BISECT)
+        continue;
+
+      for (octave_idx_type k = 0; k < d; k ++)
+        {
+          ql(k, b) = ql(k, n_bisect + b) = l(k, j);
+          qu(k, b) = qu(k, n_bisect + b) = u(k, j);
+        }
+      qu(coord[j], b) = middle[j];
+      ql(coord[j], n_bisect + b) = middle[j];
+      b ++;
+    }
+
+  octave_idx_type n_queue = 2 * n_bisect;
+  if (prune)
+    {
+      // Remove halves, which are subsets of the hull of stored boxes
+      n_queue = 0;
+      for (octave_idx_type j = 0; j < 2 * n_bisect; j ++)
+        {
+          bool subset = true;
+          for (octave_idx_type k = 0; k < d && subset; k ++)
+            subset = xl(k) <= ql(k, j) && qu(k, j) <= xu(k);
+          keep[j] = ! subset;
+          if (keep[j])
+            n_queue ++;
+        }
+      if (n_queue < 2 * n_bisect)
+        {
+          Matrix ql_kept (d, n_queue);
+          Matrix qu_kept (d, n_queue);
+          octave_idx_type p = 0;
+          for (octave_idx_type j = 0; j < 2 * n_bisect; j ++)
+            {
+              if (! keep[j])
+                continue;
+              for (octave_idx_type k = 0; k < d; k ++)
+                {
+                  ql_kept(k, p) = ql(k, j);
+                  qu_kept(k, p) = qu(k, j);
+                }
+              p ++;
+            }
+          ql = ql_kept;
+          qu = qu_kept;
+        }
+    }
+
+  octave_value_list result;
+  result (0) = ql;
+  result (1) = qu;
+  result (2) = pl;
+  result (3) = pu;
+  result (4) = inner;
+  result (5) = xl;
+  result (6) = xu;
+  return result;
+}
+
+/*
+%!test
+%! ## x^2 on [-3, 3] with codomain [1, 4]
+%! [ql, qu, pl, pu, inner, xl, xu] = __sivia__ ([-3, 0, 1.5], [0, 1, 2], [0, 0, 2.25], [9, 1, 4], 1, 4, 1e-2, -inf, false, false, inf, -inf);
+%! assert (ql, [-3, 0, -1.5, 0.5]);
+%! assert (qu, [-1.5, 0.5, 0, 1]);
+%! assert (pl, 1.5);
+%! assert (pu, 2);
+%! assert (inner, true);
+%! assert ([xl, xu], [1.5, 2]);
+%!test
+%! ## broadcasting of the codomain, boundary boxes in the final iteration
+%! [ql, qu, pl, pu, inner] = __sivia__ ([0, 2; 0, 2], [1, 3; 1, 3], [0, 5; 2, 5], [2, 6; 3, 6], [0; 2], [1; 3], 1e-2, -inf, true, false, inf (2, 1), -inf (2, 1));
+%! assert (size (ql), [2, 0]);
+%! assert (pl, [0; 0]);
+%! assert (pu, [1; 1]);
+%! assert (inner, false);
+%!test
+%! ## small boxes and pruning
+%! [ql, qu, pl, pu, inner, xl, xu] = __sivia__ ([0, 1], [1e-3, 2], [0, 0], [1, 1], 1, 2, 1e-2, -inf, false, true, 1, 1.5);
+%! assert ([pl; pu], [0; 1e-3]);
+%! assert (inner, false);
+%! assert ([xl, xu], [0, 1.5]);
+%! assert ([ql; qu], [1.5; 2]);
+%!error __sivia__ ([0, 0], [1, 1], [0; 0; 0], [1; 1; 1], [0; 0], [1; 1], 0, 0, false, false, 0, 0)
+*/
@@ -0,0 +1,442 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <octave/oct.h>
+#include <algorithm>
+#include <cmath>
+#include "interval_kernels.h"
+
+// Products, whose magnitude is within these limits, have an exact error term
+// and can be added without overflow
+static const double EFT_MIN = std::ldexp (1.0, -969);
+static const double EFT_MAX = std::ldexp (1.0, 1000);
+
+// Error-free transformation p + e = a × b.  Returns false, if the error term
+// is subject to underflow or the product is too large.
+inline bool two_product (const double a, const double b, double &p, double &e)
+{
+  p = a * b;
+  e = std::fma (a, b, -p);
+  if (p == 0.0)
+    return a == 0.0 || b == 0.0;
+  return std::abs (p) >= EFT_MIN && std::abs (p) <= EFT_MAX;
+}
+
+// Sign of numerator - v × n for the exact numerator of a grid point
+inline bool residual_sign (const double *numerator, const double v,
+                           const double n, int &sign)
+{
+  double p, e;
+  if (! two_product (v, n, p, e))
+    return false;
+  double residual[6];
+  std::copy (numerator, numerator + 4, residual);
+  int length = grow_expansion (residual, 4, -e);
+  length = grow_expansion (residual, length, -p);
+  sign = expansion_sign (residual, length);
+  return true;
+}
+
+// The binary64 numbers next to the grid point (j × l + (n - j) × b) / n
+// with finite b and l, and 0 < j < n.  The numerator is computed exactly as
+// an expansion.  An approximate quotient is moved towards the grid point
+// until the exact sign of the residual changes, such that down and up are
+// correctly rounded, and equal if the grid point is a binary64 number.
+// Returns false, if an intermediate result is out of range for the
+// error-free transformations.
+inline bool grid_point (const double b, const double l, const double j,
+                        const double n, double &down, double &up)
+{
+  double numerator[4], p, e;
+  int length = 0;
+  if (! two_product (j, l, p, e))
+    return false;
+  length = grow_expansion (numerator, length, e);
+  length = grow_expansion (numerator, length, p);
+  if (! two_product (n - j, b, p, e))
+    return false;
+  length = grow_expansion (numerator, length, e);
+  length = grow_expansion (numerator, length, p);
+
+  double approximation = 0.0;
+  for (int i = 0; i < length; i ++)
+    approximation += numerator[i];
+  double v = approximation / n;
+
+  int sign;
+  if (! residual_sign (numerator, v, n, sign))
+    return false;
+  if (sign == 0)
+    {
+      down = up = v;
+      return true;
+    }
+
+  // The approximation is off by a few ulps at most
+  const double direction = sign > 0 ? INFINITY : -INFINITY;
+  for (int step = 0; step < 4; step ++)
+    {
+      const double w = std::nextafter (v, direction);
+      int next_sign;
+      if (! residual_sign (numerator, w, n, next_sign))
+        return false;
+      if (next_sign == 0)
+        {
+          down = up = w;
+          return true;
+        }
+      if (next_sign != sign)
+        {
+          down = std::min (v, w);
+          up = std::max (v, w);
+          return true;
+        }
+      v = w;
+    }
+  return false;
+}
+
+// Enclosure of grid point j of the n + 1 equally spaced points between the
+// binary64 numbers b (j = 0) and l (j = n).  The enclosure is tight, except
+// for intermediate results near the limits of the binary64 format, where
+// the grid point is enclosed with interval arithmetic instead.
+inline bare_interval subdivision_point (directed_rounding &r,
+                                        exact_accumulator &accu,
+                                        const double b, const double l,
+                                        const octave_idx_type j,
+                                        const octave_idx_type n)
+{
+  bare_interval result;
+  if (j == 0 || b == l)
+    result.inf = result.sup = b;
+  else if (j == n)
+    result.inf = result.sup = l;
+  else if (std::isinf (b) || std::isinf (l))
+    result.inf = result.sup = std::isinf (b) ? b : l;
+  else if (! grid_point (b, l, j, n, result.inf, result.sup))
+    {
+      const bare_interval j_point = {double (j), double (j)};
+      const bare_interval n_point = {double (n), double (n)};
+      const bare_interval k_point = {double (n - j), double (n - j)};
+      const bare_interval b_point = {b, b};
+      const bare_interval l_point = {l, l};
+      accu.reset ();
+      accu.add_product (interval_rdivide (r, j_point, n_point), l_point);
+      accu.add_product (interval_rdivide (r, k_point, n_point), b_point);
+      result = accu.result ();
+    }
+  return result;
+}
+
+// Row i of the L and U matrices with n columns, which enclose n equally
+// spaced points between the intervals [bl, bu] and [ll, lu]
+static void linspace_kernel (const NDArray &bl, const NDArray &bu,
+                             const NDArray &ll, const NDArray &lu,
+                             const octave_idx_type n, NDArray &l, NDArray &u)
+{
+  const octave_idx_type m = l.rows ();
+  const bool broadcast_base = bl.numel () == 1;
+  const bool broadcast_limit = ll.numel () == 1;
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (m * n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    exact_accumulator accu;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type idx = 0; idx < m * n; idx ++)
+      {
+        const octave_idx_type i = idx % m;
+        const octave_idx_type j = idx / m;
+        const octave_idx_type b = broadcast_base ? 0 : i;
+        const octave_idx_type k = broadcast_limit ? 0 : i;
+        bare_interval result;
+        if (bl(b) > bu(b) || ll(k) > lu(k))
+          result = empty_interval ();
+        else if (n == 1)
+          {
+            result.inf = ll(k);
+            result.sup = lu(k);
+          }
+        else
+          {
+            result.inf = subdivision_point (r, accu, bl(b), ll(k),
+                                            j, n - 1).inf;
+            result.sup = subdivision_point (r, accu, bu(b), lu(k),
+                                            j, n - 1).sup;
+          }
+        result = normalize_zero (result);
+        l_data[idx] = result.inf;
+        u_data[idx] = result.sup;
+      }
+  }
+}
+
+// Row i of the L and U matrices with n columns contains the pieces of the
+// interval [xl(i), xu(i)].  Each of the n + 1 grid points is computed once
+// and gives the upper boundary of one piece and the lower boundary of the
+// next piece.
+static void mince_kernel (const NDArray &xl, const NDArray &xu,
+                          const octave_idx_type n, NDArray &l, NDArray &u)
+{
+  const octave_idx_type m = xl.numel ();
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (m * n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+    exact_accumulator accu;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type idx = 0; idx < m * (n + 1); idx ++)
+      {
+        const octave_idx_type i = idx % m;
+        const octave_idx_type j = idx / m;
+        const bare_interval x = {xl(i), xu(i)};
+        bare_interval point;
+        if (is_empty (x))
+          point = empty_interval ();
+        else if (std::isinf (x.inf) || std::isinf (x.sup))
+          // Each piece of an unbounded interval is unbounded, too
+          point = x;
+        else
+          point = subdivision_point (r, accu, x.inf, x.sup, j, n);
+        point = normalize_zero (point);
+        if (j < n)
+          l_data[i + j * m] = point.inf;
+        if (j > 0)
+          u_data[i + (j - 1) * m] = point.sup;
+      }
+  }
+}
+
+// Upper boundary AU of the first half and lower boundary BL of the second
+// half of each interval [xl, xu], see interval_bisection_point
+static void bisect_kernel (const NDArray &xl, const NDArray &xu,
+                           NDArray &au, NDArray &bl)
+{
+  const octave_idx_type n = xl.numel ();
+  double *au_data = au.fortran_vec ();
+  double *bl_data = bl.fortran_vec ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < n; i ++)
+      {
+        const bare_interval x = {xl(i), xu(i)};
+        bare_interval split;
+        if (is_empty (x))
+          {
+            split.inf = INFINITY;
+            split.sup = -INFINITY;
+          }
+        else
+          split.inf = split.sup = interval_bisection_point (r, x);
+        split = normalize_zero (split);
+        au_data[i] = split.sup;
+        bl_data[i] = split.inf;
+      }
+  }
+}
+
+DEFUN_DLD (__subdivide__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __subdivide__ (\"linspace\", "
+  "@var{BL}, @var{BU}, @var{LL}, @var{LU}, @var{N})\n"
+  "@deftypefnx {} {[@var{L}, @var{U}] =} __subdivide__ (\"mince\", "
+  "@var{XL}, @var{XU}, @var{N})\n"
+  "@deftypefnx {} {[@var{AU}, @var{BL}] =} __subdivide__ (\"bisect\", "
+  "@var{XL}, @var{XU})\n"
+  "\n"
+  "Compute the points of equally spaced subdivisions of many intervals at "
+  "once."
+  "\n\n"
+  "With @code{\"linspace\"}, row i of the M×@var{N} matrices @var{L} and "
+  "@var{U} encloses @var{N} equally spaced points between the intervals "
+  "[@var{BL}(i), @var{BU}(i)] and [@var{LL}(i), @var{LU}(i)].  With "
+  "@code{\"mince\"}, row i contains the @var{N} pieces of the interval "
+  "[@var{XL}(i), @var{XU}(i)].  The boundaries must be vectors of equal "
+  "length or scalars."
+  "\n\n"
+  "Each grid point (j × l + (n - j) × b) / n is computed with error-free "
+  "transformations in binary64 arithmetic and is correctly rounded in both "
+  "directions, that is, exact if it is a binary64 number.  Only near the "
+  "limits of the binary64 format, the grid point is enclosed with interval "
+  "arithmetic in MPFR."
+  "\n\n"
+  "With @code{\"bisect\"}, @var{AU} and @var{BL} are the upper and lower "
+  "boundaries where each interval is bisected, see @code{@@infsup/bisect}."
+  "\n\n"
+  "The points are computed in parallel if the package has been compiled "
+  "with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/linspace, @@infsup/mince, @@infsup/bisect}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin < 1)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const std::string op = args (0).string_value ();
+  octave_value_list result;
+  if (op == "linspace")
+    {
+      if (nargin != 6)
+        {
+          print_usage ();
+          return octave_value_list ();
+        }
+      const NDArray bl = args (1).array_value ();
+      const NDArray bu = args (2).array_value ();
+      const NDArray ll = args (3).array_value ();
+      const NDArray lu = args (4).array_value ();
+      const octave_idx_type n = std::max (args (5).idx_type_value (),
+                                          octave_idx_type (1));
+      if (bl.numel () != bu.numel () || ll.numel () != lu.numel ()
+          || (bl.numel () != ll.numel ()
+              && bl.numel () != 1 && ll.numel () != 1))
+        {
+          error ("__subdivide__: vectors must be of equal length");
+          return octave_value_list ();
+        }
+      const octave_idx_type m = bl.numel () == 1 ? ll.numel () : bl.numel ();
+      NDArray l (dim_vector (m, n));
+      NDArray u (dim_vector (m, n));
+      linspace_kernel (bl, bu, ll, lu, n, l, u);
+      result (0) = l;
+      result (1) = u;
+    }
+  else if (op == "mince")
+    {
+      if (nargin != 4)
+        {
+          print_usage ();
+          return octave_value_list ();
+        }
+      const NDArray xl = args (1).array_value ();
+      const NDArray xu = args (2).array_value ();
+      const octave_idx_type n = std::max (args (3).idx_type_value (),
+                                          octave_idx_type (0));
+      if (xl.numel () != xu.numel ())
+        {
+          error ("__subdivide__: vectors must be of equal length");
+          return octave_value_list ();
+        }
+      NDArray l (dim_vector (xl.numel (), n));
+      NDArray u (dim_vector (xl.numel (), n));
+      mince_kernel (xl, xu, n, l, u);
+      result (0) = l;
+      result (1) = u;
+    }
+  else if (op == "bisect")
+    {
+      if (nargin != 3)
+        {
+          print_usage ();
+          return octave_value_list ();
+        }
+      const NDArray xl = args (1).array_value ();
+      const NDArray xu = args (2).array_value ();
+      if (xl.dims () != xu.dims ())
+        {
+          error ("__subdivide__: nonconformant arguments");
+          return octave_value_list ();
+        }
+      NDArray au (xl.dims ());
+      NDArray bl (xl.dims ());
+      bisect_kernel (xl, xu, au, bl);
+      result (0) = au;
+      result (1) = bl;
+    }
+  else
+    {
+      error ("__subdivide__: unknown operation '%s'", op.c_str ());
+      return octave_value_list ();
+    }
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __subdivide__ ("linspace", 0, 0, 10, 10, 5);
+%! assert (l, [0, 2.5, 5, 7.5, 10]);
+%! assert (u, [0, 2.5, 5, 7.5, 10]);
+%!test
+%! [l, u] = __subdivide__ ("linspace", 0, 0, 1, 1, 4);
+%! assert (l, [0, 1/3, 2/3, 1]);
+%! assert (u - l, [0, pow2 (-54), pow2 (-53), 0]);
+%!test
+%! [l, u] = __subdivide__ ("linspace", 1, 1, 10, 10, 8);
+%! assert (u - l, [0, 2, 2, 2, 4, 4, 4, 0] .* eps);
+%! assert (all (l <= 1 + (0 : 7) .* 9 / 7 & 1 + (0 : 7) .* 9 / 7 <= u));
+%!test
+%! [l, u] = __subdivide__ ("linspace", [-inf; 1], [1; 1], [2; 2], [3; inf], 3);
+%! assert (l, [-inf, -inf, 2; 1, 1.5, 2]);
+%! assert (u, [1, 2, 3; 1, inf, inf]);
+%!test
+%! [l, u] = __subdivide__ ("linspace", realmax, realmax, -realmax, -realmax, 3);
+%! assert (l, [realmax, -0, -realmax]);
+%! assert (signbit (l(2)));
+%! assert (u, [realmax, 0, -realmax]);
+%!test
+%! [l, u] = __subdivide__ ("linspace", pow2 (-1074), pow2 (-1074), 2 * pow2 (-1074), 2 * pow2 (-1074), 3);
+%! assert (l(2) <= 1.5 * pow2 (-1074) && 1.5 * pow2 (-1074) <= u(2));
+%!test
+%! [l, u] = __subdivide__ ("mince", [0; 1; inf], [10; inf; -inf], 4);
+%! assert (l, [0, 2.5, 5, 7.5; 1, 1, 1, 1; inf, inf, inf, inf]);
+%! assert (u, [2.5, 5, 7.5, 10; inf, inf, inf, inf; -inf, -inf, -inf, -inf]);
+%!test
+%! [l, u] = __subdivide__ ("mince", 0, 1, 3);
+%! assert (u(1 : 2) - l(2 : 3), [pow2 (-54), pow2 (-53)]);
+%!test
+%! [au, bl] = __subdivide__ ("bisect", [2, 0, -inf, inf], [32, 0, inf, -inf]);
+%! assert (au, [8, 0, 0, -inf]);
+%! assert (bl, [8, 0, 0, inf]);
+%! assert (signbit (bl(2)) && not (signbit (au(2))));
+%!error __subdivide__ ("linspace", [1, 2], [1, 2], [1, 2, 3], [1, 2, 3], 2)
+%!error __subdivide__ ("split", 1, 1)
+*/
@@ -0,0 +1,165 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <string>
+#include "interval_kernels.h"
+
+DEFUN_DLD (__trigonometric__, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefn {} {[@var{L}, @var{U}] =} __trigonometric__ (@var{F}, "
+  "@var{XL}, @var{XU})\n"
+  "\n"
+  "Evaluate the trigonometric function @var{F} on the intervals "
+  "[@var{XL}, @var{XU}] element-wise.  @var{F} is one of @code{\"sin\"}, "
+  "@code{\"cos\"}, @code{\"tan\"}, @code{\"sec\"}, @code{\"csc\"}, or "
+  "@code{\"cot\"}.  The result [@var{L}, @var{U}] is a tight enclosure."
+  "\n\n"
+  "Both boundaries are reduced to quadrants k × pi / 2, ..., (k + 1) × pi "
+  "/ 2.  The reduction uses a Cody-Waite splitting of pi / 2 with an exact "
+  "remainder for arguments up to 2^20 and an exact reduction in MPFR for "
+  "larger arguments.  The quadrants determine, which extrema and poles lie "
+  "inside of the interval, such that the function is evaluated only at the "
+  "boundaries, which are needed for the result.  The intervals are "
+  "processed in parallel if the package has been compiled with OpenMP."
+  "\n\n"
+  "This is an internal function of the interval package and should not be "
+  "called directly.\n"
+  "@seealso{@@infsup/sin, @@infsup/cos, @@infsup/tan, @@infsup/sec, "
+  "@@infsup/csc, @@infsup/cot}\n"
+  "@end deftypefn"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin != 3)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  const std::string name = args (0).string_value ();
+  trig_function function;
+  if (name == "sin")
+    function = TRIG_SIN;
+  else if (name == "cos")
+    function = TRIG_COS;
+  else if (name == "tan")
+    function = TRIG_TAN;
+  else if (name == "sec")
+    function = TRIG_SEC;
+  else if (name == "csc")
+    function = TRIG_CSC;
+  else if (name == "cot")
+    function = TRIG_COT;
+  else
+    {
+      error ("__trigonometric__: unknown function '%s'", name.c_str ());
+      return octave_value_list ();
+    }
+
+  const NDArray xl = args (1).array_value ();
+  const NDArray xu = args (2).array_value ();
+  if (xl.dims () != xu.dims ())
+    {
+      error ("__trigonometric__: nonconformant arguments");
+      return octave_value_list ();
+    }
+
+  NDArray l (xl.dims ());
+  NDArray u (xl.dims ());
+  const double *xl_data = xl.data ();
+  const double *xu_data = xu.data ();
+  double *l_data = l.fortran_vec ();
+  double *u_data = u.fortran_vec ();
+  const octave_idx_type n = xl.numel ();
+
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 1000)
+#endif
+  {
+    // Each thread uses its own MPFR variables
+    directed_rounding r;
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < n; i ++)
+      {
+        const bare_interval x = {xl_data[i], xu_data[i]};
+        const bare_interval y = interval_trig (r, function, x);
+        l_data[i] = y.inf;
+        u_data[i] = y.sup;
+      }
+  }
+
+  octave_value_list result;
+  result (0) = l;
+  result (1) = u;
+  return result;
+}
+
+/*
+%!test
+%! [l, u] = __trigonometric__ ("sin", [0, 1, 1, -inf, inf], [0, 2, 7, inf, -inf]);
+%! assert (l, [0, sin(1), -1, -1, inf], eps);
+%! assert (u, [0, 1, 1, 1, -inf]);
+%! assert (signbit (l(1)) && ! signbit (u(1)));
+%!test
+%! [l, u] = __trigonometric__ ("cos", [0, 1, 3], [0, 3, 4]);
+%! assert (l, [1, cos(3), -1], eps);
+%! assert (u, [1, cos(1), cos(4)], eps);
+%!test
+%! [l, u] = __trigonometric__ ("tan", [-1, 1, 3], [1, 2, 3]);
+%! assert (l, [tan(-1), -inf, tan(3)], 2 * eps);
+%! assert (u, [tan(1), inf, tan(3)], 2 * eps);
+%!test
+%! [l, u] = __trigonometric__ ("sec", [-1, 1, 3], [1, 2, 4]);
+%! assert (l, [1, -inf, sec(4)], 2 * eps);
+%! assert (u, [sec(1), inf, -1], 2 * eps);
+%!test
+%! [l, u] = __trigonometric__ ("csc", [0, 0, -1, 1], [0, 1, 1, 2]);
+%! assert (l, [inf, csc(1), -inf, 1], 2 * eps);
+%! assert (u, [-inf, inf, inf, max(csc (1), csc (2))], 2 * eps);
+%!test
+%! [l, u] = __trigonometric__ ("cot", [-1, 0, 1], [0, 1, 4]);
+%! assert (l, [-inf, cot(1), -inf], 2 * eps);
+%! assert (u, [cot(-1), inf, inf], 2 * eps);
+%!test
+%! ## Unbounded intervals contain a whole period
+%! l = [-inf, 0, -inf, -inf, -realmax];
+%! u = [0, inf, inf, -realmax, realmax];
+%! for f = {"sin", "cos"}
+%!   [yl, yu] = __trigonometric__ (f{1}, l, u);
+%!   assert (yl, [-1, -1, -1, -1, -1]);
+%!   assert (yu, [1, 1, 1, 1, 1]);
+%! endfor
+%! for f = {"tan", "sec", "csc", "cot"}
+%!   [yl, yu] = __trigonometric__ (f{1}, l, u);
+%!   assert (yl, -inf (1, 5));
+%!   assert (yu, inf (1, 5));
+%! endfor
+%!test
+%! ## Large arguments are reduced exactly
+%! x = pow2 (1000);
+%! [l, u] = __trigonometric__ ("sin", x, x);
+%! assert (l <= sin (x) && sin (x) <= u);
+%! assert (u - l <= eps (sin (x)));
+%!error __trigonometric__ ("exp", 1, 1)
+%!error __trigonometric__ ("sin", [1, 2], 3)
+*/
@@ -24,6 +24,7 @@
 
 bool isvector (const Array <double> x);
 bool isempty (const octave_value x);
+bool isobject (const octave_value x);
 
 #if (OCTAVE_MAJOR_VERSION > 4 || (OCTAVE_MAJOR_VERSION == 4 && OCTAVE_MINOR_VERSION >= 4))
 
@@ -39,6 +40,11 @@ bool isempty (const octave_value x)
   return x.isempty ();
 }
 
+bool isobject (const octave_value x)
+{
+  return x.isobject ();
+}
+
 #else
 
 // Implementation for Octave version 4.2 and older.
@@ -55,6 +61,12 @@ bool isempty (const octave_value x)
   return x.is_empty ();
 }
 
+// The is_object method has been replaced by isobject in Octave 4.4.
+bool isobject (const octave_value x)
+{
+  return x.is_object ();
+}
+
 // feval has been moved into octave::feval in Octave 4.4.
 namespace octave
 {
@@ -70,3 +82,10 @@ namespace octave
 }
 
 #endif
+
+// The idx_vector class has been moved into the octave namespace in Octave 7.
+#if (OCTAVE_MAJOR_VERSION >= 7)
+typedef octave::idx_vector index_vector_type;
+#else
+typedef idx_vector index_vector_type;
+#endif
@@ -0,0 +1,76 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Interchange encoding of intervals, IEEE Std 1788-2015, clause 14.4:
+// A bare interval is encoded by the binary64 encodings of its lower and
+// upper boundary (16 octets).  A decorated interval additionally carries
+// one octet with the decoration (17 octets).
+
+#ifndef INTERVAL_INTERCHANGE_H
+#define INTERVAL_INTERCHANGE_H
+
+#include <cstring>
+#include <stdint.h>
+#include <octave/oct.h>
+
+#define BARE_INTERCHANGE_OCTETS 16
+#define DECORATED_INTERCHANGE_OCTETS 17
+
+// Determine the byte order from a string, which is compatible with the
+// ARCH parameter of fopen.  Returns true for big-endian byte order.
+inline
+bool parse_byte_order (const std::string &arch)
+{
+  if (arch == "native" || arch == "n")
+    {
+      const uint16_t probe = 1;
+      uint8_t first_octet;
+      std::memcpy (&first_octet, &probe, 1);
+      return first_octet == 0;
+    }
+  if (arch == "ieee-le" || arch == "l")
+    return false;
+  if (arch == "ieee-be" || arch == "b")
+    return true;
+
+  error ("invalid byte order '%s', expected: native, ieee-le, or ieee-be",
+         arch.c_str ());
+  return false;
+}
+
+inline
+void store_binary64 (uint8_t *target, const double x, const bool big_endian)
+{
+  uint64_t bits;
+  std::memcpy (&bits, &x, sizeof (bits));
+  for (int i = 0; i < 8; i ++)
+    target[big_endian ? 7 - i : i] = static_cast <uint8_t> (bits >> (8 * i));
+}
+
+inline
+double load_binary64 (const uint8_t *source, const bool big_endian)
+{
+  uint64_t bits = 0;
+  for (int i = 0; i < 8; i ++)
+    bits |= static_cast <uint64_t> (source[big_endian ? 7 - i : i])
+            << (8 * i);
+  double x;
+  std::memcpy (&x, &bits, sizeof (x));
+  return x;
+}
+
+#endif
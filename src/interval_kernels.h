@@ -0,0 +1,1268 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Scalar bare interval functions for oct-files, which evaluate whole
+// interval expressions element by element.  The functions compute the same
+// tight enclosures as the corresponding methods of the infsup class
+// (inst/@infsup/*.m), and use the same correctly rounded GNU MPFR functions
+// as mpfr_function_d.
+
+#ifndef INTERVAL_KERNELS_H
+#define INTERVAL_KERNELS_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "mpfr_commons.h"
+
+// The binary64 numbers next to pi and 2 pi towards positive infinity, which
+// are sup (infsup ("pi")) and sup (2 .* infsup ("pi")), and the binary64
+// number next to pi towards negative infinity
+const double PI_INF =
+  3.141592653589793115997963468544185161590576171875;
+const double PI_SUP =
+  3.141592653589793560087173318606801331043243408203125;
+const double TWO_PI_SUP =
+  6.28318530717958712017434663721360266208648681640625;
+
+typedef int (*mpfr_unary_kernel) (mpfr_t, const mpfr_t, mpfr_rnd_t);
+typedef int (*mpfr_binary_kernel) (mpfr_t, const mpfr_t, const mpfr_t,
+                                   mpfr_rnd_t);
+
+struct bare_interval
+{
+  double inf;
+  double sup;
+};
+
+// One interval operand of an element-wise operation, which is broadcasted to
+// the size of the result
+struct broadcast_operand
+{
+  const double *inf;
+  const double *sup;
+  const octave_uint8 *dec;  // decorations or NULL
+  dim_vector dims;          // dimensions of the operand
+  bool scalar;              // the same value applies to all elements
+  bool broadcast;           // needs index computation
+  std::vector <octave_idx_type> stride;
+
+  // Index of the operand's element, which corresponds to element i of the
+  // result with dimensions result_dims
+  octave_idx_type index (const dim_vector &result_dims,
+                         octave_idx_type i) const
+  {
+    if (scalar)
+      return 0;
+    if (! broadcast)
+      return i;
+    octave_idx_type idx = 0;
+    for (int j = 0; j < result_dims.ndims (); j ++)
+      {
+        idx += (i % result_dims(j)) * stride[j];
+        i /= result_dims(j);
+      }
+    return idx;
+  }
+};
+
+// Compute the dimensions of the result, to which the n operands are
+// broadcasted, and prepare the index computation of the operands.  Returns
+// false if non-singleton dimensions of the operands do not agree.
+inline bool broadcast_operands (broadcast_operand *operands, const int n,
+                                dim_vector &result_dims)
+{
+  int dimensions = 2;
+  for (int k = 0; k < n; k ++)
+    dimensions = std::max (dimensions, operands[k].dims.ndims ());
+
+  result_dims = dim_vector (1, 1).redim (dimensions);
+  for (int k = 0; k < n; k ++)
+    {
+      const dim_vector dv = operands[k].dims.redim (dimensions);
+      for (int j = 0; j < dimensions; j ++)
+        if (dv(j) != 1)
+          {
+            if (result_dims(j) != 1 && result_dims(j) != dv(j))
+              return false;
+            result_dims(j) = dv(j);
+          }
+    }
+
+  for (int k = 0; k < n; k ++)
+    {
+      broadcast_operand &operand = operands[k];
+      const dim_vector dv = operand.dims.redim (dimensions);
+      operand.scalar = dv.numel () == 1;
+      operand.broadcast = ! operand.scalar && dv != result_dims;
+      if (! operand.broadcast)
+        continue;
+      operand.stride.resize (dimensions);
+      octave_idx_type stride = 1;
+      for (int j = 0; j < dimensions; j ++)
+        {
+          operand.stride[j] = dv(j) == 1 ? 0 : stride;
+          stride *= dv(j);
+        }
+    }
+  return true;
+}
+
+// Correctly rounded binary64 functions.  Each thread must use its own
+// instance, which reuses the MPFR variables for all evaluations.
+class directed_rounding
+{
+public:
+  directed_rounding ()
+  {
+    mpfr_init2 (mp1, BINARY64_PRECISION);
+    mpfr_init2 (mp2, BINARY64_PRECISION);
+    old_emin = mpfr_get_emin ();
+    mpfr_set_emin (BINARY64_EMIN);
+  }
+
+  ~directed_rounding ()
+  {
+    mpfr_clear (mp1);
+    mpfr_clear (mp2);
+    mpfr_set_emin (old_emin);
+  }
+
+  double unary (const mpfr_unary_kernel f, const double x,
+                const mpfr_rnd_t rnd)
+  {
+    mpfr_set_d (mp1, x, MPFR_RNDZ);
+    (*f) (mp1, mp1, rnd);
+    return mpfr_get_d (mp1, rnd);
+  }
+
+  double binary (const mpfr_binary_kernel f, const double x, const double y,
+                 const mpfr_rnd_t rnd)
+  {
+    mpfr_set_d (mp1, x, MPFR_RNDZ);
+    mpfr_set_d (mp2, y, MPFR_RNDZ);
+    (*f) (mp1, mp1, mp2, rnd);
+    return mpfr_get_d (mp1, rnd);
+  }
+
+  double pown (const double x, const long p, const mpfr_rnd_t rnd)
+  {
+    mpfr_set_d (mp1, x, MPFR_RNDZ);
+    mpfr_pow_si (mp1, mp1, p, rnd);
+    return mpfr_get_d (mp1, rnd);
+  }
+
+  double rootn (const double x, const unsigned long p, const mpfr_rnd_t rnd)
+  {
+    mpfr_set_d (mp1, x, MPFR_RNDZ);
+    mpfr_rootn_ui (mp1, mp1, p, rnd);
+    return mpfr_get_d (mp1, rnd);
+  }
+
+private:
+  mpfr_t mp1, mp2;
+  mpfr_exp_t old_emin;
+};
+
+inline bare_interval empty_interval ()
+{
+  const bare_interval result = {INFINITY, -INFINITY};
+  return result;
+}
+
+inline bare_interval entire_interval ()
+{
+  const bare_interval result = {-INFINITY, INFINITY};
+  return result;
+}
+
+inline bool is_empty (const bare_interval x)
+{
+  return x.inf > x.sup;
+}
+
+// Interval boundaries use the signed zeros -0 (lower) and +0 (upper)
+inline bare_interval normalize_zero (bare_interval x)
+{
+  if (x.inf == 0.0)
+    x.inf = -0.0;
+  if (x.sup == 0.0)
+    x.sup = +0.0;
+  return x;
+}
+
+inline double signum (const double x)
+{
+  return (x > 0.0) - (x < 0.0);
+}
+
+inline bare_interval interval_plus (directed_rounding &r,
+                                    const bare_interval x,
+                                    const bare_interval y)
+{
+  if (is_empty (x) || is_empty (y))
+    return empty_interval ();
+  const bare_interval result = {r.binary (mpfr_add, x.inf, y.inf, MPFR_RNDD),
+                                r.binary (mpfr_add, x.sup, y.sup, MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_minus (directed_rounding &r,
+                                     const bare_interval x,
+                                     const bare_interval y)
+{
+  if (is_empty (x) || is_empty (y))
+    return empty_interval ();
+  const bare_interval result = {r.binary (mpfr_sub, x.inf, y.sup, MPFR_RNDD),
+                                r.binary (mpfr_sub, x.sup, y.inf, MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_uminus (const bare_interval x)
+{
+  if (is_empty (x))
+    return empty_interval ();
+  const bare_interval result = {-x.sup, -x.inf};
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_abs (const bare_interval x)
+{
+  if (is_empty (x) || x.inf >= 0.0)
+    return normalize_zero (x);
+  if (x.sup <= 0.0)
+    return interval_uminus (x);
+  const bare_interval result = {-0.0, std::max (-x.inf, x.sup)};
+  return result;
+}
+
+inline bare_interval interval_times (directed_rounding &r,
+                                     const bare_interval x,
+                                     const bare_interval y)
+{
+  if (is_empty (x) || is_empty (y))
+    return empty_interval ();
+  // [0] × anything = [0] × [0]
+  if ((x.inf == 0.0 && x.sup == 0.0) || (y.inf == 0.0 && y.sup == 0.0))
+    {
+      const bare_interval result = {-0.0, +0.0};
+      return result;
+    }
+  // [Entire] × anything but [0] = [Entire] × [Entire]
+  if ((x.inf == -INFINITY && x.sup == INFINITY)
+      || (y.inf == -INFINITY && y.sup == INFINITY))
+    return entire_interval ();
+
+  // Products of the form 0 × inf evaluate to NaN and are ignored by fmin
+  // and fmax, like in the min and max functions of GNU Octave.
+  bare_interval result;
+  result.inf = std::fmin (
+    std::fmin (r.binary (mpfr_mul, x.inf, y.inf, MPFR_RNDD),
+               r.binary (mpfr_mul, x.inf, y.sup, MPFR_RNDD)),
+    std::fmin (r.binary (mpfr_mul, x.sup, y.inf, MPFR_RNDD),
+               r.binary (mpfr_mul, x.sup, y.sup, MPFR_RNDD)));
+  result.sup = std::fmax (
+    std::fmax (r.binary (mpfr_mul, x.inf, y.inf, MPFR_RNDU),
+               r.binary (mpfr_mul, x.inf, y.sup, MPFR_RNDU)),
+    std::fmax (r.binary (mpfr_mul, x.sup, y.inf, MPFR_RNDU),
+               r.binary (mpfr_mul, x.sup, y.sup, MPFR_RNDU)));
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_rdivide (directed_rounding &r,
+                                       const bare_interval x,
+                                       const bare_interval y)
+{
+  if (is_empty (x) || is_empty (y) || (y.inf == 0.0 && y.sup == 0.0))
+    return empty_interval ();
+  if (x.inf == 0.0 && x.sup == 0.0)
+    {
+      const bare_interval result = {-0.0, +0.0};
+      return result;
+    }
+  if ((y.inf < 0.0 && y.sup > 0.0)
+      || (x.inf < 0.0 && x.sup > 0.0 && (y.inf == 0.0 || y.sup == 0.0)))
+    return entire_interval ();
+
+  // Partitionize the function's domain, see @infsup/rdivide.m
+  bare_interval result;
+  if (x.sup <= 0.0)
+    {
+      if (y.sup < 0.0)
+        {
+          result.inf = r.binary (mpfr_div, x.sup, y.inf, MPFR_RNDD);
+          result.sup = r.binary (mpfr_div, x.inf, y.sup, MPFR_RNDU);
+        }
+      else if (y.inf > 0.0)
+        {
+          result.inf = r.binary (mpfr_div, x.inf, y.inf, MPFR_RNDD);
+          result.sup = r.binary (mpfr_div, x.sup, y.sup, MPFR_RNDU);
+        }
+      else if (y.sup == 0.0)
+        {
+          result.inf = r.binary (mpfr_div, x.sup, y.inf, MPFR_RNDD);
+          result.sup = INFINITY;
+        }
+      else
+        {
+          result.inf = -INFINITY;
+          result.sup = r.binary (mpfr_div, x.sup, y.sup, MPFR_RNDU);
+        }
+    }
+  else if (x.inf >= 0.0)
+    {
+      if (y.sup < 0.0)
+        {
+          result.inf = r.binary (mpfr_div, x.sup, y.sup, MPFR_RNDD);
+          result.sup = r.binary (mpfr_div, x.inf, y.inf, MPFR_RNDU);
+        }
+      else if (y.inf > 0.0)
+        {
+          result.inf = r.binary (mpfr_div, x.inf, y.sup, MPFR_RNDD);
+          result.sup = r.binary (mpfr_div, x.sup, y.inf, MPFR_RNDU);
+        }
+      else if (y.sup == 0.0)
+        {
+          result.inf = -INFINITY;
+          result.sup = r.binary (mpfr_div, x.inf, y.inf, MPFR_RNDU);
+        }
+      else
+        {
+          result.inf = r.binary (mpfr_div, x.inf, y.sup, MPFR_RNDD);
+          result.sup = INFINITY;
+        }
+    }
+  else if (y.sup < 0.0)
+    {
+      result.inf = r.binary (mpfr_div, x.sup, y.sup, MPFR_RNDD);
+      result.sup = r.binary (mpfr_div, x.inf, y.sup, MPFR_RNDU);
+    }
+  else
+    {
+      result.inf = r.binary (mpfr_div, x.inf, y.inf, MPFR_RNDD);
+      result.sup = r.binary (mpfr_div, x.sup, y.inf, MPFR_RNDU);
+    }
+  return normalize_zero (result);
+}
+
+// Mignitude and magnitude of a nonempty interval
+inline double mig (const bare_interval x)
+{
+  if (x.inf >= 0.0)
+    return x.inf;
+  if (x.sup <= 0.0)
+    return -x.sup;
+  return 0.0;
+}
+
+inline double mag (const bare_interval x)
+{
+  return std::max (std::fabs (x.inf), std::fabs (x.sup));
+}
+
+inline bare_interval interval_sqr (directed_rounding &r,
+                                   const bare_interval x)
+{
+  if (is_empty (x))
+    return empty_interval ();
+  const bare_interval result = {r.unary (mpfr_sqr, mig (x), MPFR_RNDD),
+                                r.unary (mpfr_sqr, mag (x), MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_pown (directed_rounding &r,
+                                    const bare_interval x,
+                                    const long p)
+{
+  if (is_empty (x))
+    return empty_interval ();
+  if (p == 0)
+    {
+      const bare_interval result = {1.0, 1.0};
+      return result;
+    }
+  if (p == 2)
+    return interval_sqr (r, x);
+  if (x.inf == 0.0 && x.sup == 0.0)
+    {
+      if (p < 0)
+        return empty_interval ();
+      const bare_interval result = {-0.0, +0.0};
+      return result;
+    }
+
+  bare_interval result;
+  if (p % 2 == 0)
+    {
+      if (p > 0)
+        {
+          result.inf = r.pown (mig (x), p, MPFR_RNDD);
+          result.sup = r.pown (mag (x), p, MPFR_RNDU);
+        }
+      else
+        {
+          result.inf = r.pown (mag (x), p, MPFR_RNDD);
+          result.sup = mig (x) == 0.0
+                       ? INFINITY
+                       : r.pown (mig (x), p, MPFR_RNDU);
+        }
+    }
+  else if (p > 0)
+    {
+      // Odd powers are monotonically increasing
+      result.inf = r.pown (x.inf, p, MPFR_RNDD);
+      result.sup = r.pown (x.sup, p, MPFR_RNDU);
+    }
+  else
+    {
+      // Odd powers with negative exponent are monotonically decreasing on
+      // both sides of the pole at zero
+      if (x.inf < 0.0 && x.sup > 0.0)
+        return entire_interval ();
+      if (x.inf >= 0.0)
+        {
+          result.inf = r.pown (x.sup, p, MPFR_RNDD);
+          result.sup = x.inf == 0.0
+                       ? INFINITY
+                       : r.pown (x.inf, p, MPFR_RNDU);
+        }
+      else
+        {
+          result.inf = x.sup == 0.0
+                       ? -INFINITY
+                       : r.pown (x.sup, p, MPFR_RNDD);
+          result.sup = r.pown (x.inf, p, MPFR_RNDU);
+        }
+    }
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_realsqrt (directed_rounding &r,
+                                        const bare_interval x)
+{
+  if (is_empty (x) || x.sup < 0.0)
+    return empty_interval ();
+  const bare_interval result =
+    {r.unary (mpfr_sqrt, std::max (0.0, x.inf), MPFR_RNDD),
+     r.unary (mpfr_sqrt, std::max (0.0, x.sup), MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_exp (directed_rounding &r,
+                                   const bare_interval x)
+{
+  if (is_empty (x))
+    return empty_interval ();
+  const bare_interval result = {r.unary (mpfr_exp, x.inf, MPFR_RNDD),
+                                r.unary (mpfr_exp, x.sup, MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_log (directed_rounding &r,
+                                   const bare_interval x)
+{
+  if (is_empty (x) || x.sup <= 0.0)
+    return empty_interval ();
+  const bare_interval result =
+    {r.unary (mpfr_log, std::max (0.0, x.inf), MPFR_RNDD),
+     r.unary (mpfr_log, x.sup, MPFR_RNDU)};
+  return normalize_zero (result);
+}
+
+// Error-free transformation s + e = a + b in binary64 arithmetic with
+// rounding to nearest
+inline void two_sum (const double a, const double b, double &s, double &e)
+{
+  s = a + b;
+  const double z = s - a;
+  e = (a - (s - z)) + (b - z);
+}
+
+// Add b to the nonoverlapping expansion e of increasing magnitude, see
+// J. R. Shewchuk (1997), Adaptive precision floating-point arithmetic and
+// fast robust geometric predicates.  The result is nonoverlapping again and
+// has one more component.
+inline int grow_expansion (double *e, const int length, const double b)
+{
+  double q = b;
+  for (int i = 0; i < length; i ++)
+    two_sum (q, e[i], q, e[i]);
+  e[length] = q;
+  return length + 1;
+}
+
+// The sign of a nonoverlapping expansion is the sign of its largest nonzero
+// component
+inline int expansion_sign (const double *e, const int length)
+{
+  for (int i = length - 1; i >= 0; i --)
+    if (e[i] != 0.0)
+      return e[i] > 0.0 ? 1 : -1;
+  return 0;
+}
+
+// Cody-Waite splitting of pi / 2 into three parts with at most 33 significant
+// bits each, such that their products with integers below 2^20 are exact,
+// see pio2_1, pio2_2, and pio2_3 in fdlibm's __ieee754_rem_pio2.  The
+// remainder pi / 2 - PIO2_1 - PIO2_2 - PIO2_3 is below 2^-103.
+const double PIO2_1 = 1.57079632673412561417e+00;
+const double PIO2_2 = 6.07710050630396597660e-11;
+const double PIO2_3 = 2.02226624871116645580e-21;
+const double PIO2_3T_BOUND = 9.8607613152626476e-32; // 2^-103
+const double CODY_WAITE_LIMIT = 1048576.0;           // 2^20
+const double EXACT_QUADRANT_LIMIT = 9007199254740992.0; // 2^53
+
+// Quadrant floor (x / (pi / 2)) of x with an exact range reduction in MPFR,
+// which works for all binary64 numbers: 2 / pi is enclosed with enough bits
+// to determine the floor of the product.  For |x| >= 2^53 the quadrant is
+// only returned modulo 4.
+inline double large_quadrant (const double x)
+{
+  int exponent;
+  std::frexp (x, &exponent);
+  mpfr_prec_t precision = std::max (exponent, 0) + 128;
+  mpfr_t lower, upper;
+  while (true)
+    {
+      mpfr_init2 (lower, precision);
+      mpfr_init2 (upper, precision);
+      mpfr_const_pi (lower, MPFR_RNDU);
+      mpfr_ui_div (lower, 2, lower, MPFR_RNDD);
+      mpfr_const_pi (upper, MPFR_RNDD);
+      mpfr_ui_div (upper, 2, upper, MPFR_RNDU);
+      if (x >= 0.0)
+        {
+          mpfr_mul_d (lower, lower, x, MPFR_RNDD);
+          mpfr_mul_d (upper, upper, x, MPFR_RNDU);
+        }
+      else
+        {
+          mpfr_mul_d (lower, lower, x, MPFR_RNDU);
+          mpfr_mul_d (upper, upper, x, MPFR_RNDD);
+          mpfr_swap (lower, upper);
+        }
+      mpfr_floor (lower, lower);
+      mpfr_floor (upper, upper);
+
+      const bool determined = mpfr_equal_p (lower, upper);
+      double quadrant = 0.0;
+      if (determined && std::abs (x) < EXACT_QUADRANT_LIMIT)
+        quadrant = mpfr_get_d (lower, MPFR_RNDN);
+      else if (determined)
+        {
+          // The fraction of quadrant / 4 is exact
+          mpfr_div_2ui (lower, lower, 2, MPFR_RNDN);
+          mpfr_frac (lower, lower, MPFR_RNDN);
+          quadrant = 4.0 * mpfr_get_d (lower, MPFR_RNDN);
+          if (quadrant < 0.0)
+            quadrant += 4.0;
+        }
+      mpfr_clear (lower);
+      mpfr_clear (upper);
+      if (determined)
+        return quadrant;
+      precision *= 2;
+    }
+}
+
+// Quadrant floor (x / (pi / 2)) of x, which is exact for |x| < 2^53 and
+// modulo 4 otherwise.  For |x| <= 2^20 the quadrant k nearest to x × 2 / pi
+// is corrected by the sign of the remainder x - k × pi / 2 of a Cody-Waite
+// reduction, which is computed exactly as an expansion.  Zero, the only
+// binary64 number on a quadrant boundary, belongs to quadrant -1 as the
+// upper boundary of an interval, such that the quadrant boundaries between
+// the quadrants of the interval boundaries lie in the interior of the
+// interval.
+inline double trig_quadrant (const double x, const bool upper)
+{
+  if (x == 0.0)
+    return upper ? -1.0 : 0.0;
+  if (std::abs (x) > CODY_WAITE_LIMIT)
+    return large_quadrant (x);
+
+  const double k = std::nearbyint (x * (2.0 / M_PI));
+  double remainder[5], s, e;
+  two_sum (x, -k * PIO2_1, s, e);
+  int length = grow_expansion (remainder, 0, e);
+  length = grow_expansion (remainder, length, s);
+  length = grow_expansion (remainder, length, -k * PIO2_2);
+  length = grow_expansion (remainder, length, -k * PIO2_3);
+
+  // The neglected part of pi / 2 could change the sign of a tiny remainder
+  double largest = 0.0;
+  for (int i = 0; i < length; i ++)
+    largest = std::max (largest, std::abs (remainder[i]));
+  if (largest <= 2.0 * std::abs (k) * PIO2_3T_BOUND)
+    return large_quadrant (x);
+  return expansion_sign (remainder, length) > 0 ? k : k - 1.0;
+}
+
+// Non-negative remainder of a quadrant modulo 4
+inline int quadrant_mod4 (const double q)
+{
+  double result = std::fmod (q, 4.0);
+  if (result < 0.0)
+    result += 4.0;
+  return static_cast <int> (result);
+}
+
+// Whether the interior of an interval, whose lower boundary lies in quadrant
+// first (modulo 4) and which contains the given number of quadrant
+// boundaries, contains boundary b (modulo 4)
+inline bool contains_quadrant_boundary (const int b, const int first,
+                                        const double boundaries)
+{
+  return b >= 0 && boundaries >= (b - first + 3) % 4 + 1;
+}
+
+enum trig_function {TRIG_SIN, TRIG_COS, TRIG_TAN, TRIG_SEC, TRIG_CSC, TRIG_COT};
+
+// Shape of a trigonometric function.  The quadrant boundaries k × pi / 2
+// and the quadrants between k × pi / 2 and (k + 1) × pi / 2 are identified
+// by k modulo 4.
+struct trig_properties
+{
+  mpfr_unary_kernel f;
+  int poles;          // bit mask of boundaries with a pole
+  int min_boundary;   // boundary with a local minimum, or -1
+  double min_value;
+  int max_boundary;   // boundary with a local maximum, or -1
+  double max_value;
+  int increasing;     // bit mask of quadrants, where f is increasing
+};
+
+const trig_properties TRIG_PROPERTIES[] =
+{
+  {mpfr_sin, 0x0, 3, -1.0, 1, 1.0, 0x9},
+  {mpfr_cos, 0x0, 2, -1.0, 0, 1.0, 0xC},
+  {mpfr_tan, 0xA, -1, 0.0, -1, 0.0, 0xF},
+  {mpfr_sec, 0xA, 0, 1.0, 2, -1.0, 0x3},
+  {mpfr_csc, 0x5, 1, 1.0, 3, -1.0, 0x6},
+  {mpfr_cot, 0x5, -1, 0.0, -1, 0.0, 0x0}
+};
+
+// Range of the trigonometric function over x, see @infsup/sin, @infsup/cos,
+// @infsup/tan, @infsup/sec, @infsup/csc, and @infsup/cot.  The quadrants of
+// both boundaries determine, which extrema and poles lie in the interior of
+// x, and the function is evaluated only at the boundaries, which are needed
+// for the tight enclosure.
+inline bare_interval interval_trig (directed_rounding &r,
+                                    const trig_function function,
+                                    const bare_interval x)
+{
+  const trig_properties &p = TRIG_PROPERTIES[function];
+  const bool zero_pole = p.poles & 0x1;
+  if (is_empty (x) || (zero_pole && x.inf == 0.0 && x.sup == 0.0))
+    return empty_interval ();
+
+  // A whole period lies in x if it is unbounded or wider than 2 pi.  The
+  // quadrants of infinite boundaries are undefined.
+  const double width = x.sup - x.inf;
+  if (! (width <= 7.0))
+    {
+      if (p.poles != 0x0)
+        return entire_interval ();
+      const bare_interval result = {p.min_value, p.max_value};
+      return result;
+    }
+
+  // Number of quadrant boundaries in the interior of x, where four or more
+  // boundaries contain a whole period
+  const double ql = trig_quadrant (x.inf, false);
+  const double qu = trig_quadrant (x.sup, true);
+  double boundaries;
+  if (std::abs (x.inf) < EXACT_QUADRANT_LIMIT
+      && std::abs (x.sup) < EXACT_QUADRANT_LIMIT)
+    boundaries = std::max (0.0, qu - ql);
+  else
+    {
+      // Both boundaries are integers and the width is exact.  Zero
+      // boundaries are possible only for width < pi / 2 and four
+      // boundaries only for width > 3 pi / 2.
+      boundaries = quadrant_mod4 (qu - ql);
+      if (width > 6.0 || (boundaries == 0.0 && width > 3.0))
+        boundaries = 4.0;
+    }
+
+  const int first = quadrant_mod4 (ql);
+  for (int b = 0; b < 4; b ++)
+    if (((p.poles >> b) & 0x1)
+        && contains_quadrant_boundary (b, first, boundaries))
+      return entire_interval ();
+  const bool has_min =
+    contains_quadrant_boundary (p.min_boundary, first, boundaries);
+  const bool has_max =
+    contains_quadrant_boundary (p.max_boundary, first, boundaries);
+
+  // Poles at zero are approached from the interior of x
+  const double l = (zero_pole && x.inf == 0.0) ? +0.0 : x.inf;
+  const double u = (zero_pole && x.sup == 0.0) ? -0.0 : x.sup;
+
+  bare_interval result;
+  if (has_min || has_max)
+    {
+      result.inf = has_min ? p.min_value
+                           : std::min (r.unary (p.f, l, MPFR_RNDD),
+                                       r.unary (p.f, u, MPFR_RNDD));
+      result.sup = has_max ? p.max_value
+                           : std::max (r.unary (p.f, l, MPFR_RNDU),
+                                       r.unary (p.f, u, MPFR_RNDU));
+    }
+  else if ((p.increasing >> first) & 0x1)
+    {
+      result.inf = r.unary (p.f, l, MPFR_RNDD);
+      result.sup = r.unary (p.f, u, MPFR_RNDU);
+    }
+  else
+    {
+      result.inf = r.unary (p.f, u, MPFR_RNDD);
+      result.sup = r.unary (p.f, l, MPFR_RNDU);
+    }
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_sin (directed_rounding &r,
+                                   const bare_interval x)
+{
+  return interval_trig (r, TRIG_SIN, x);
+}
+
+inline bare_interval interval_cos (directed_rounding &r,
+                                   const bare_interval x)
+{
+  return interval_trig (r, TRIG_COS, x);
+}
+
+// Set operations
+inline bare_interval interval_intersect (const bare_interval x,
+                                         const bare_interval y)
+{
+  const bare_interval result = {std::max (x.inf, y.inf),
+                                std::min (x.sup, y.sup)};
+  if (is_empty (result))
+    return empty_interval ();
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_hull (const bare_interval x,
+                                    const bare_interval y)
+{
+  if (is_empty (x))
+    return y;
+  if (is_empty (y))
+    return x;
+  const bare_interval result = {std::min (x.inf, y.inf),
+                                std::max (x.sup, y.sup)};
+  return normalize_zero (result);
+}
+
+// Interval hull of the set difference of x and y, see @infsup/setdiff
+inline bare_interval interval_setdiff (const bare_interval x,
+                                       const bare_interval y)
+{
+  if (y.inf <= x.inf && y.sup >= x.sup)
+    return empty_interval ();
+  bare_interval result = x;
+  if (y.sup >= x.sup && y.inf > x.inf)
+    result.sup = std::min (result.sup, y.inf);
+  if (y.inf <= x.inf && y.sup < x.sup)
+    result.inf = std::max (result.inf, y.sup);
+  return normalize_zero (result);
+}
+
+// Interval hull of the symmetric difference of x and y, and of its parts
+// below (c1) and above (c2) the intersection, see @infsup/setxor
+inline bare_interval interval_setxor (const bare_interval x,
+                                      const bare_interval y,
+                                      bare_interval &c1, bare_interval &c2)
+{
+  // Sort the four boundaries in ascending order b1 <= b2 <= b3 <= b4, if
+  // only one empty interval is present, then [b2, b3] = [Empty], with two
+  // empty intervals we also have [b1, b4] = [Empty].
+  double b1 = std::min (x.inf, y.inf);
+  double b2 = std::max (x.inf, y.inf);
+  double b3 = std::min (x.sup, y.sup);
+  double b4 = std::max (x.sup, y.sup);
+  if (b2 > b3)
+    std::swap (b2, b3);
+
+  bare_interval result = {x.inf == y.inf ? b3 : b1,
+                          x.sup == y.sup ? b2 : b4};
+  if ((x.inf == y.inf && x.sup == y.sup) || is_empty (result))
+    result = empty_interval ();
+
+  if (is_empty (x) || is_empty (y))
+    {
+      b1 = x.inf;
+      b2 = x.sup;
+      b3 = y.inf;
+      b4 = y.sup;
+    }
+  c1.inf = b1;
+  c1.sup = b2;
+  if (x.inf == y.inf || is_empty (c1))
+    c1 = empty_interval ();
+  c2.inf = b3;
+  c2.sup = b4;
+  if (x.sup == y.sup || is_empty (c2))
+    c2 = empty_interval ();
+
+  c1 = normalize_zero (c1);
+  c2 = normalize_zero (c2);
+  return normalize_zero (result);
+}
+
+// Reverse operations: the tightest enclosure of all elements x of X, for
+// which f (x) lies in C, see @infsup/*rev.m
+
+inline bare_interval interval_absrev (const bare_interval c,
+                                      const bare_interval x)
+{
+  const bare_interval nonnegative = {0.0, INFINITY};
+  const bare_interval y = interval_intersect (c, nonnegative);
+  if (is_empty (y) || is_empty (x))
+    return empty_interval ();
+  return interval_hull (interval_intersect (x, y),
+                        interval_intersect (x, interval_uminus (y)));
+}
+
+inline bare_interval interval_pownrev (directed_rounding &r,
+                                       bare_interval c,
+                                       const bare_interval x,
+                                       long p)
+{
+  if (is_empty (c) || is_empty (x))
+    return empty_interval ();
+  if (p == 0)
+    return (c.inf <= 1.0 && 1.0 <= c.sup) ? x : empty_interval ();
+  if (p < 0)
+    {
+      // x^p = 1 / x^(-p)
+      const bare_interval one = {1.0, 1.0};
+      c = interval_rdivide (r, one, c);
+      p = -p;
+      if (is_empty (c))
+        return empty_interval ();
+    }
+
+  if (p % 2 == 0)
+    {
+      const bare_interval nonnegative = {0.0, INFINITY};
+      c = interval_intersect (c, nonnegative);
+      if (is_empty (c))
+        return empty_interval ();
+      const bare_interval root = normalize_zero (
+        {r.rootn (c.inf, p, MPFR_RNDD), r.rootn (c.sup, p, MPFR_RNDU)});
+      return interval_hull (interval_intersect (x, root),
+                            interval_intersect (x, interval_uminus (root)));
+    }
+
+  // Odd roots are monotonically increasing
+  const bare_interval root = normalize_zero (
+    {r.rootn (c.inf, p, MPFR_RNDD), r.rootn (c.sup, p, MPFR_RNDU)});
+  return interval_intersect (x, root);
+}
+
+inline bare_interval interval_sqrrev (directed_rounding &r,
+                                      const bare_interval c,
+                                      const bare_interval x)
+{
+  return interval_pownrev (r, c, x, 2);
+}
+
+inline bare_interval interval_realsqrtrev (directed_rounding &r,
+                                           const bare_interval c,
+                                           const bare_interval x)
+{
+  const bare_interval nonnegative = {0.0, INFINITY};
+  return interval_intersect (
+    x, interval_sqr (r, interval_intersect (c, nonnegative)));
+}
+
+inline bare_interval interval_exprev (directed_rounding &r,
+                                      const bare_interval c,
+                                      const bare_interval x)
+{
+  return interval_intersect (x, interval_log (r, c));
+}
+
+inline bare_interval interval_logrev (directed_rounding &r,
+                                      const bare_interval c,
+                                      const bare_interval x)
+{
+  return interval_intersect (x, interval_exp (r, c));
+}
+
+// Two-output division: the components u and v of all x with b * x in C
+// for some b in B, see @infsup/mulrev.  u contains the negative or unique
+// component, v contains the positive component.
+inline void interval_mulrev_pair (directed_rounding &r,
+                                  const bare_interval b,
+                                  const bare_interval c,
+                                  bare_interval &u,
+                                  bare_interval &v)
+{
+  u = v = empty_interval ();
+  if (is_empty (b) || is_empty (c))
+    return;
+  if (b.inf > 0.0 || b.sup < 0.0)
+    {
+      u = interval_rdivide (r, c, b);
+      return;
+    }
+  if (c.inf <= 0.0 && 0.0 <= c.sup)
+    {
+      u = entire_interval ();
+      return;
+    }
+  if (b.inf == 0.0 && b.sup == 0.0)
+    return;
+
+  // The quotient c / b consists of two rays, because 0 is in the interior
+  // of b or at its boundary
+  if (c.inf > 0.0)
+    {
+      if (b.inf < 0.0)
+        u = normalize_zero (
+          {-INFINITY, r.binary (mpfr_div, c.inf, b.inf, MPFR_RNDU)});
+      if (b.sup > 0.0)
+        v = normalize_zero (
+          {r.binary (mpfr_div, c.inf, b.sup, MPFR_RNDD), INFINITY});
+    }
+  else
+    {
+      if (b.sup > 0.0)
+        u = normalize_zero (
+          {-INFINITY, r.binary (mpfr_div, c.sup, b.sup, MPFR_RNDU)});
+      if (b.inf < 0.0)
+        v = normalize_zero (
+          {r.binary (mpfr_div, c.sup, b.inf, MPFR_RNDD), INFINITY});
+    }
+  if (is_empty (u))
+    {
+      u = v;
+      v = empty_interval ();
+    }
+}
+
+// All x in X with b * x in C for some b in B
+inline bare_interval interval_mulrev (directed_rounding &r,
+                                      const bare_interval b,
+                                      const bare_interval c,
+                                      const bare_interval x)
+{
+  bare_interval u, v;
+  interval_mulrev_pair (r, b, c, u, v);
+  return interval_hull (interval_intersect (x, u),
+                        interval_intersect (x, v));
+}
+
+// Branch k of the solutions of sin (x) in c (k pi + (-1)^k asin (c)) or
+// cos (x) in c (k pi + acos (c) for even k and (k + 1) pi - acos (c) for
+// odd k), where a is the enclosure of asin (c) or acos (c)
+inline bare_interval trigonometric_branch (directed_rounding &r,
+                                           const bare_interval a,
+                                           const double k,
+                                           const bool is_cos)
+{
+  const bare_interval pi = {PI_INF, PI_SUP};
+  const bare_interval factor = {k, k};
+  const bool even = std::fmod (k, 2.0) == 0.0;
+  if (even)
+    return interval_plus (r, interval_times (r, factor, pi), a);
+  if (! is_cos)
+    return interval_minus (r, interval_times (r, factor, pi), a);
+  const bare_interval next = {k + 1.0, k + 1.0};
+  return interval_minus (r, interval_times (r, next, pi), a);
+}
+
+// Reverse operation of sin or cos.  The branches of solutions are ordered
+// by k and each branch lies within a period of pi, such that only the
+// branches near the boundaries of x must be searched.
+inline bare_interval interval_trigrev (directed_rounding &r,
+                                       const bare_interval c,
+                                       const bare_interval x,
+                                       const bool is_cos)
+{
+  if (is_empty (c) || is_empty (x))
+    return empty_interval ();
+  const bare_interval range = {-1.0, 1.0};
+  const bare_interval y = interval_intersect (c, range);
+  if (is_empty (y))
+    return empty_interval ();
+  if (y.inf == -1.0 && y.sup == 1.0)
+    return x;
+  const bare_interval a = is_cos
+    ? normalize_zero ({r.unary (mpfr_acos, y.sup, MPFR_RNDD),
+                       r.unary (mpfr_acos, y.inf, MPFR_RNDU)})
+    : normalize_zero ({r.unary (mpfr_asin, y.inf, MPFR_RNDD),
+                       r.unary (mpfr_asin, y.sup, MPFR_RNDU)});
+
+  // Beyond this limit, the branches are not computed accurately enough
+  const double limit = 0x1p50;
+  bare_interval result = x;
+
+  // Search the largest branch, which intersects x, downwards from a branch
+  // above x.  Two consecutive branches below x prove, that there is no
+  // solution.
+  if (std::fabs (x.sup) < limit)
+    {
+      double k = std::ceil (x.sup / M_PI) + 1.0;
+      int below = 0;
+      for (int step = 0; step < 6; step ++, k --)
+        {
+          const bare_interval b = trigonometric_branch (r, a, k, is_cos);
+          if (b.inf > x.sup)
+            continue;
+          if (b.sup >= x.inf)
+            {
+              result.sup = std::min (x.sup, b.sup);
+              break;
+            }
+          if (below ++ > 0)
+            return empty_interval ();
+        }
+    }
+
+  // Search the smallest branch, which intersects x, upwards
+  if (std::fabs (x.inf) < limit)
+    {
+      double k = std::floor (x.inf / M_PI) - 2.0;
+      int above = 0;
+      for (int step = 0; step < 6; step ++, k ++)
+        {
+          const bare_interval b = trigonometric_branch (r, a, k, is_cos);
+          if (b.sup < x.inf)
+            continue;
+          if (b.inf <= x.sup)
+            {
+              result.inf = std::max (x.inf, b.inf);
+              break;
+            }
+          if (above ++ > 0)
+            return empty_interval ();
+        }
+    }
+
+  if (is_empty (result))
+    return empty_interval ();
+  return normalize_zero (result);
+}
+
+inline bare_interval interval_sinrev (directed_rounding &r,
+                                      const bare_interval c,
+                                      const bare_interval x)
+{
+  return interval_trigrev (r, c, x, false);
+}
+
+inline bare_interval interval_cosrev (directed_rounding &r,
+                                      const bare_interval c,
+                                      const bare_interval x)
+{
+  return interval_trigrev (r, c, x, true);
+}
+
+// Width of x, rounded towards positive infinity (NaN for empty intervals)
+inline double interval_wid (directed_rounding &r, const bare_interval x)
+{
+  if (is_empty (x))
+    return NAN;
+  return r.binary (mpfr_sub, x.sup, x.inf, MPFR_RNDU);
+}
+
+// Midpoint of x, see @infsup/mid
+inline double interval_mid (directed_rounding &r, const bare_interval x)
+{
+  if (is_empty (x))
+    return NAN;
+  if (x.inf == -INFINITY && x.sup == INFINITY)
+    return 0.0;
+  if (x.inf == -INFINITY)
+    return -std::numeric_limits <double>::max ();
+  if (x.sup == INFINITY)
+    return std::numeric_limits <double>::max ();
+
+  // First divide by 2 and then add, because this will prevent overflow
+  return r.binary (mpfr_div, x.inf, 2.0, MPFR_RNDD)
+         + r.binary (mpfr_div, x.sup, 2.0, MPFR_RNDU);
+}
+
+// Midpoint of [log2 (l), log2 (u)] for 0 < l <= u < inf
+inline double log2_mid (directed_rounding &r, const double l, const double u)
+{
+  const double log2_l = r.unary (mpfr_log2, l, MPFR_RNDD);
+  const double log2_u = r.unary (mpfr_log2, u, MPFR_RNDU);
+  return r.binary (mpfr_div, log2_l, 2.0, MPFR_RNDD)
+         + r.binary (mpfr_div, log2_u, 2.0, MPFR_RNDU);
+}
+
+// Point, where @infsup/bisect splits the nonempty interval x.  The binary64
+// numbers in x are enumerated and x is split at the number in the middle,
+// such that large intervals are split in a logarithmic manner.
+inline double interval_bisection_point (directed_rounding &r,
+                                        const bare_interval x)
+{
+  const double tiny = std::numeric_limits <double>::denorm_min ();
+  const double huge = std::numeric_limits <double>::max ();
+
+  double m = 0.0;
+  if (x.inf >= 0.0 && x.sup > 0.0)
+    m = std::min (huge, std::pow (2.0, log2_mid (r, std::max (x.inf, tiny),
+                                                 std::min (x.sup, huge))));
+  else if (x.inf < 0.0 && x.sup <= 0.0)
+    m = -std::min (huge, std::pow (2.0, log2_mid (r, -std::min (x.sup, -tiny),
+                                                  -std::max (x.inf, -huge))));
+  else if (x.inf < 0.0 && x.sup > 0.0 && x.sup != -x.inf)
+    {
+      const double p = log2_mid (r, tiny, std::min (x.sup, huge));
+      const double n = log2_mid (r, tiny, -std::max (x.inf, -huge));
+      if (x.sup > -x.inf)
+        m = std::min (huge, std::pow (2.0, p - n - 1074.0));
+      else
+        m = -std::min (huge, std::pow (2.0, n - p - 1074.0));
+    }
+
+  return std::min (std::max (m, x.inf), x.sup);
+}
+
+// Exact sums of intervals and of products of intervals, see
+// exact_interval_dot_product in mpfr_commons.h.  The boundaries are
+// accumulated without rounding errors and rounded only once by result ().
+// Each thread must use its own instance.
+class exact_accumulator
+{
+public:
+  exact_accumulator ()
+  {
+    mpfr_init2 (accu_l, BINARY64_ACCU_PRECISION);
+    mpfr_init2 (accu_u, BINARY64_ACCU_PRECISION);
+    mpfr_init2 (addend_l, 2 * BINARY64_PRECISION + 1);
+    mpfr_init2 (addend_u, 2 * BINARY64_PRECISION + 1);
+    mpfr_init2 (temp, 2 * BINARY64_PRECISION + 1);
+    reset ();
+  }
+
+  ~exact_accumulator ()
+  {
+    mpfr_clear (accu_l);
+    mpfr_clear (accu_u);
+    mpfr_clear (addend_l);
+    mpfr_clear (addend_u);
+    mpfr_clear (temp);
+  }
+
+  void reset ()
+  {
+    mpfr_set_zero (accu_l, 0);
+    mpfr_set_zero (accu_u, 0);
+    empty = false;
+  }
+
+  void add (const bare_interval x)
+  {
+    if (is_empty (x))
+      {
+        empty = true;
+        return;
+      }
+    const mpfr_exp_t emin = widen_exponent_range ();
+    mpfr_add_d (accu_l, accu_l, x.inf, MPFR_RNDD);
+    mpfr_add_d (accu_u, accu_u, x.sup, MPFR_RNDU);
+    mpfr_set_emin (emin);
+  }
+
+  void add_product (const bare_interval x, const bare_interval y)
+  {
+    if (is_empty (x) || is_empty (y))
+      {
+        empty = true;
+        return;
+      }
+    if ((x.inf == 0.0 && x.sup == 0.0) || (y.inf == 0.0 && y.sup == 0.0))
+      return;
+
+    // Both factors can be multiplied within 107 bits exactly.  Products
+    // 0 × ∞ are NaN and ignored by mpfr_min and mpfr_max.
+    const mpfr_exp_t emin = widen_exponent_range ();
+    product (x.inf, y.inf);
+    mpfr_set (addend_l, temp, MPFR_RNDZ);
+    mpfr_set (addend_u, temp, MPFR_RNDZ);
+    product (x.inf, y.sup);
+    mpfr_min (addend_l, addend_l, temp, MPFR_RNDZ);
+    mpfr_max (addend_u, addend_u, temp, MPFR_RNDZ);
+    product (x.sup, y.inf);
+    mpfr_min (addend_l, addend_l, temp, MPFR_RNDZ);
+    mpfr_max (addend_u, addend_u, temp, MPFR_RNDZ);
+    product (x.sup, y.sup);
+    mpfr_min (addend_l, addend_l, temp, MPFR_RNDZ);
+    mpfr_max (addend_u, addend_u, temp, MPFR_RNDZ);
+    mpfr_add (accu_l, accu_l, addend_l, MPFR_RNDD);
+    mpfr_add (accu_u, accu_u, addend_u, MPFR_RNDU);
+    mpfr_set_emin (emin);
+  }
+
+  // Add the tight square [mig (x)^2, mag (x)^2]
+  void add_square (const bare_interval x)
+  {
+    if (is_empty (x))
+      {
+        empty = true;
+        return;
+      }
+    const mpfr_exp_t emin = widen_exponent_range ();
+    product (mig (x), mig (x));
+    mpfr_add (accu_l, accu_l, temp, MPFR_RNDD);
+    product (mag (x), mag (x));
+    mpfr_add (accu_u, accu_u, temp, MPFR_RNDU);
+    mpfr_set_emin (emin);
+  }
+
+  bare_interval result ()
+  {
+    if (empty)
+      return empty_interval ();
+    const mpfr_exp_t emin = widen_exponent_range ();
+    const bare_interval result = {mpfr_get_d (accu_l, MPFR_RNDD),
+                                  mpfr_get_d (accu_u, MPFR_RNDU)};
+    mpfr_set_emin (emin);
+    return normalize_zero (result);
+  }
+
+private:
+  mpfr_t accu_l, accu_u, addend_l, addend_u, temp;
+  bool empty;
+
+  // Products of subnormal numbers are below the exponent range of
+  // directed_rounding
+  static mpfr_exp_t widen_exponent_range ()
+  {
+    const mpfr_exp_t emin = mpfr_get_emin ();
+    mpfr_set_emin (mpfr_get_emin_min ());
+    return emin;
+  }
+
+  void product (const double x, const double y)
+  {
+    mpfr_set_d (temp, x, MPFR_RNDZ);
+    mpfr_mul_d (temp, temp, y, MPFR_RNDZ);
+  }
+};
+
+#endif
@@ -0,0 +1,150 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <octave/oct.h>
+#include <octave/oct-map.h>
+#include "interval_interchange.h"
+
+DEFUN_DLD (interval_pack, args, nargout,
+  "-*- texinfo -*-\n"
+  "@documentencoding UTF-8\n"
+  "@deftypefun {@var{B} =} interval_pack (@var{X})\n"
+  "@deftypefunx {@var{B} =} interval_pack (@var{X}, @var{ARCH})\n"
+  "\n"
+  "Encode interval array @var{X} in the interchange format of "
+  "IEEE Std 1788-2015."
+  "\n\n"
+  "The result is a column vector of type uint8 with 16 octets per bare "
+  "interval, or 17 octets per decorated interval.  Each interval is encoded "
+  "by its lower boundary, its upper boundary, and, for decorated intervals, "
+  "the decoration.  The intervals are encoded in column-major order, the "
+  "size of @var{X} is not encoded."
+  "\n\n"
+  "The byte order of the interval boundaries can be selected with @var{ARCH}, "
+  "which defaults to @code{\"native\"}.  Other possible values are "
+  "@code{\"ieee-le\"} for little-endian and @code{\"ieee-be\"} for "
+  "big-endian byte order."
+  "\n\n"
+  "Empty intervals are encoded as (+inf, -inf) and NaI is encoded as "
+  "(NaN, NaN, ill).  The result can be written to a file with "
+  "@command{fwrite} and decoded with @command{interval_unpack}."
+  "\n\n"
+  "@example\n"
+  "@group\n"
+  "reshape (interval_pack (infsup (3, 4), \"ieee-be\"), 8, 2)'\n"
+  "  @result{} ans =\n"
+  "     64    8    0    0    0    0    0    0\n"
+  "     64   16    0    0    0    0    0    0\n"
+  "@end group\n"
+  "@end example\n"
+  "@seealso{interval_unpack, @@infsup/bitunpack}\n"
+  "@end deftypefun"
+  )
+{
+  // Check call syntax
+  int nargin = args.length ();
+  if (nargin < 1 || nargin > 2)
+    {
+      print_usage ();
+      return octave_value_list ();
+    }
+
+  if (! args (0).is_instance_of ("infsup"))
+    {
+      error ("interval_pack: arg1 must be an interval");
+      return octave_value_list ();
+    }
+
+  if (nargin >= 2 && ! args (1).is_string ())
+    {
+      error ("interval_pack: arg2 must be a string");
+      return octave_value_list ();
+    }
+
+  const bool
+  big_endian = parse_byte_order (nargin >= 2
+                                 ? args (1).string_value ()
+                                 : "native");
+
+  const bool
+  decorated = args (0).is_instance_of ("infsupdec");
+
+  const octave_scalar_map
+  x = args (0).scalar_map_value ();
+
+  const octave_scalar_map
+  bare = (!decorated)
+      ? x
+      : x.getfield ("infsup").scalar_map_value ();
+
+  const uint8NDArray
+  dec = (!decorated)
+      ? uint8NDArray ()
+      : x.getfield ("dec").uint8_array_value ();
+
+  const NDArray
+  inf = bare.getfield ("inf").array_value ();
+
+  const NDArray
+  sup = bare.getfield ("sup").array_value ();
+
+  const octave_idx_type n = inf.numel ();
+  const octave_idx_type octets = decorated
+                                 ? DECORATED_INTERCHANGE_OCTETS
+                                 : BARE_INTERCHANGE_OCTETS;
+
+  uint8NDArray result (dim_vector (n * octets, 1));
+  uint8_t *target = reinterpret_cast <uint8_t *> (result.fortran_vec ());
+  const double *l = inf.data ();
+  const double *u = sup.data ();
+  const octave_uint8 *d = decorated ? dec.data () : NULL;
+  for (octave_idx_type i = 0; i < n; i ++)
+    {
+      if (decorated && d[i].value () == 0)
+        {
+          // NaI is stored as an empty interval with decoration ill
+          store_binary64 (target, NAN, big_endian);
+          store_binary64 (target + 8, NAN, big_endian);
+        }
+      else
+        {
+          store_binary64 (target, l[i], big_endian);
+          store_binary64 (target + 8, u[i], big_endian);
+        }
+      if (decorated)
+        target[16] = d[i].value ();
+      target += octets;
+    }
+
+  return octave_value (result);
+}
+
+/*
+%!assert (interval_pack (infsup (3, 4), "ieee-be"), uint8 ([64; 8; zeros(6, 1); 64; 16; zeros(6, 1)]));
+%!assert (interval_pack (infsup (3, 4), "ieee-le"), uint8 ([zeros(6, 1); 8; 64; zeros(6, 1); 16; 64]));
+%!assert (interval_pack (infsupdec (3, 4), "ieee-be"), uint8 ([64; 8; zeros(6, 1); 64; 16; zeros(6, 1); 16]));
+%!assert (numel (interval_pack (infsup (zeros (3, 4)))), 3 * 4 * 16);
+%!assert (numel (interval_pack (infsupdec (zeros (3, 4)))), 3 * 4 * 17);
+%!assert (interval_pack (infsup (3, 4)), bitpack (bitunpack ([3; 4]), "uint8"));
+%!test
+%! b = interval_pack (nai (), "ieee-be");
+%! assert (b(1 : 2), uint8 ([127; 248]));
+%! assert (b(9 : 10), uint8 ([127; 248]));
+%! assert (b(17), uint8 (0));
+%!error interval_pack (3)
+%!error interval_pack (infsup (3), "middle-endian")
+*/
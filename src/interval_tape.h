@@ -0,0 +1,596 @@
+/*
+  Copyright 2026 Oliver Heimlich
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Expression graphs of the intervaltape class (inst/@intervaltape), which
+// are evaluated element by element with the kernels of interval_kernels.h
+
+#ifndef INTERVAL_TAPE_H
+#define INTERVAL_TAPE_H
+
+#include <octave/oct.h>
+#include <string>
+#include <vector>
+#include "interval_kernels.h"
+
+enum tape_operation
+{
+  TAPE_INPUT,
+  TAPE_VARIABLE,
+  TAPE_UMINUS,
+  TAPE_ABS,
+  TAPE_SQR,
+  TAPE_POWN,
+  TAPE_REALSQRT,
+  TAPE_EXP,
+  TAPE_LOG,
+  TAPE_SIN,
+  TAPE_COS,
+  TAPE_PLUS,
+  TAPE_MINUS,
+  TAPE_TIMES,
+  TAPE_RDIVIDE
+};
+
+// One node of the tape, the arguments are indices of previous nodes
+struct tape_node
+{
+  tape_operation op;
+  octave_idx_type arg1;
+  octave_idx_type arg2;
+  long param;
+  bool needed;
+  octave_idx_type derivative;  // index of the seeded derivative or -1
+  bool active;          // depends on a seeded node
+  bool scalar;          // input with a single element
+  const double *inf;    // input data
+  const double *sup;
+};
+
+// Interval expression graph in topological order
+class interval_tape
+{
+public:
+  std::vector <tape_node> nodes;
+  dim_vector dims;      // common size of all array inputs
+  octave_idx_type variables;
+  octave_idx_type derivatives;
+
+  interval_tape () : dims (1, 1), variables (0), derivatives (0) { }
+
+  // Read the tape from the arguments OP, ARG, PARAM, INF, SUP, which start
+  // at args (offset).  Returns false after an error.
+  bool read (const std::string &fname, const octave_value_list &args,
+             const int offset);
+
+  // Mark the nodes, which are needed to compute the roots (one-based
+  // indices).  Returns false after an error.
+  bool mark (const std::string &fname,
+             const Array <octave_idx_type> &root);
+
+  // Evaluate all needed nodes for element i of the inputs, the values of
+  // variable nodes are taken from variable[param - 1]
+  void evaluate (directed_rounding &r, std::vector <bare_interval> &value,
+                 const octave_idx_type i,
+                 const bare_interval *variable = NULL) const;
+
+  // Seed the derivatives with respect to the input or variable nodes WRT
+  // (one-based indices), node WRT(j) is the j-th independent variable.
+  // Returns false after an error.
+  bool seed (const std::string &fname, const Array <octave_idx_type> &wrt);
+
+  // Seed the derivatives with respect to the variables of the tape
+  void seed_variables ();
+
+  // Evaluate all needed nodes like evaluate and compute their gradients in
+  // forward mode.  The gradient of node k is stored in
+  // gradient[k * derivatives], ..., gradient[(k + 1) * derivatives - 1].
+  void evaluate_gradient (directed_rounding &r,
+                          std::vector <bare_interval> &value,
+                          std::vector <bare_interval> &gradient,
+                          const octave_idx_type i,
+                          const bare_interval *variable = NULL) const;
+
+  // Contract the box of variables to the solutions of value (root(j)) in
+  // y[j] (one-based indices, y has either one element or one element per
+  // root) with a single forward-backward pass (HC4Revise).  Returns false
+  // if the box certainly contains no solution.
+  bool contract (directed_rounding &r, std::vector <bare_interval> &value,
+                 const Array <octave_idx_type> &root,
+                 const std::vector <bare_interval> &y,
+                 bare_interval *variable) const;
+
+private:
+  // Keep the input data alive while the tape is evaluated
+  std::vector <NDArray> inf_data;
+  std::vector <NDArray> sup_data;
+
+  // Mark the nodes, which depend on seeded nodes
+  void activate ();
+};
+
+inline bool parse_tape_operation (const std::string &fname,
+                                  const std::string &name,
+                                  tape_operation &op)
+{
+  static const char *names[] = {"input", "variable", "uminus", "abs", "sqr",
+                                "pown", "realsqrt", "exp", "log", "sin",
+                                "cos", "plus", "minus", "times", "rdivide"};
+  for (int k = 0; k <= TAPE_RDIVIDE; k ++)
+    if (name == names[k])
+      {
+        op = static_cast <tape_operation> (k);
+        return true;
+      }
+
+  error ("%s: unsupported operation '%s'", fname.c_str (), name.c_str ());
+  return false;
+}
+
+inline bool interval_tape::read (const std::string &fname,
+                                 const octave_value_list &args,
+                                 const int offset)
+{
+  const Cell op = args (offset).cell_value ();
+  const Matrix arg = args (offset + 1).matrix_value ();
+  const ColumnVector param = args (offset + 2).column_vector_value ();
+  const Cell inf_cell = args (offset + 3).cell_value ();
+  const Cell sup_cell = args (offset + 4).cell_value ();
+
+  const octave_idx_type n = op.numel ();
+  if (arg.rows () != n || arg.columns () != 2 || param.numel () != n
+      || inf_cell.numel () != n || sup_cell.numel () != n)
+    {
+      error ("%s: inconsistent tape", fname.c_str ());
+      return false;
+    }
+
+  nodes.resize (n);
+  inf_data.resize (n);
+  sup_data.resize (n);
+  bool has_array_input = false;
+  for (octave_idx_type k = 0; k < n; k ++)
+    {
+      tape_node &node = nodes[k];
+      if (! parse_tape_operation (fname, op(k).string_value (), node.op))
+        return false;
+      node.arg1 = static_cast <octave_idx_type> (arg(k, 0)) - 1;
+      node.arg2 = static_cast <octave_idx_type> (arg(k, 1)) - 1;
+      node.param = static_cast <long> (param(k));
+      node.needed = false;
+      node.derivative = -1;
+      node.active = false;
+      node.scalar = true;
+      node.inf = node.sup = NULL;
+      if (node.arg1 >= k || node.arg2 >= k)
+        {
+          error ("%s: tape is not in topological order", fname.c_str ());
+          return false;
+        }
+
+      if (node.op == TAPE_VARIABLE)
+        {
+          if (node.param < 1)
+            {
+              error ("%s: invalid variable number", fname.c_str ());
+              return false;
+            }
+          variables = std::max (variables,
+                                static_cast <octave_idx_type> (node.param));
+        }
+      if (node.op != TAPE_INPUT)
+        continue;
+
+      inf_data[k] = inf_cell(k).array_value ();
+      sup_data[k] = sup_cell(k).array_value ();
+      if (inf_data[k].dims () != sup_data[k].dims ())
+        {
+          error ("%s: inconsistent input boundaries", fname.c_str ());
+          return false;
+        }
+      node.inf = inf_data[k].data ();
+      node.sup = sup_data[k].data ();
+      node.scalar = inf_data[k].numel () == 1;
+      if (node.scalar)
+        continue;
+      if (! has_array_input)
+        {
+          dims = inf_data[k].dims ();
+          has_array_input = true;
+        }
+      else if (inf_data[k].dims () != dims)
+        {
+          error ("%s: nonconformant arguments", fname.c_str ());
+          return false;
+        }
+    }
+
+  return true;
+}
+
+inline bool interval_tape::mark (const std::string &fname,
+                                 const Array <octave_idx_type> &root)
+{
+  const octave_idx_type n = nodes.size ();
+  for (octave_idx_type j = 0; j < root.numel (); j ++)
+    {
+      if (root(j) < 1 || root(j) > n)
+        {
+          error ("%s: root index out of bound", fname.c_str ());
+          return false;
+        }
+      nodes[root(j) - 1].needed = true;
+    }
+  for (octave_idx_type k = n - 1; k >= 0; k --)
+    {
+      if (! nodes[k].needed)
+        continue;
+      if (nodes[k].arg1 >= 0)
+        nodes[nodes[k].arg1].needed = true;
+      if (nodes[k].arg2 >= 0)
+        nodes[nodes[k].arg2].needed = true;
+    }
+  return true;
+}
+
+inline void interval_tape::evaluate (directed_rounding &r,
+                                     std::vector <bare_interval> &value,
+                                     const octave_idx_type i,
+                                     const bare_interval *variable) const
+{
+  for (std::size_t k = 0; k < nodes.size (); k ++)
+    {
+      const tape_node &node = nodes[k];
+      if (! node.needed)
+        continue;
+
+      const bare_interval x = node.arg1 >= 0
+                              ? value[node.arg1]
+                              : empty_interval ();
+      const bare_interval y = node.arg2 >= 0
+                              ? value[node.arg2]
+                              : empty_interval ();
+      switch (node.op)
+        {
+          case TAPE_INPUT:
+            {
+              const octave_idx_type idx = node.scalar ? 0 : i;
+              value[k].inf = node.inf[idx];
+              value[k].sup = node.sup[idx];
+              break;
+            }
+          case TAPE_VARIABLE:
+            value[k] = variable != NULL
+                       ? variable[node.param - 1]
+                       : empty_interval ();
+            break;
+          case TAPE_UMINUS:
+            value[k] = interval_uminus (x);
+            break;
+          case TAPE_ABS:
+            value[k] = interval_abs (x);
+            break;
+          case TAPE_SQR:
+            value[k] = interval_sqr (r, x);
+            break;
+          case TAPE_POWN:
+            value[k] = interval_pown (r, x, node.param);
+            break;
+          case TAPE_REALSQRT:
+            value[k] = interval_realsqrt (r, x);
+            break;
+          case TAPE_EXP:
+            value[k] = interval_exp (r, x);
+            break;
+          case TAPE_LOG:
+            value[k] = interval_log (r, x);
+            break;
+          case TAPE_SIN:
+            value[k] = interval_sin (r, x);
+            break;
+          case TAPE_COS:
+            value[k] = interval_cos (r, x);
+            break;
+          case TAPE_PLUS:
+            value[k] = interval_plus (r, x, y);
+            break;
+          case TAPE_MINUS:
+            value[k] = interval_minus (r, x, y);
+            break;
+          case TAPE_TIMES:
+            value[k] = interval_times (r, x, y);
+            break;
+          case TAPE_RDIVIDE:
+            value[k] = interval_rdivide (r, x, y);
+            break;
+        }
+    }
+}
+
+inline bool interval_tape::seed (const std::string &fname,
+                                 const Array <octave_idx_type> &wrt)
+{
+  const octave_idx_type n = nodes.size ();
+  for (octave_idx_type k = 0; k < n; k ++)
+    nodes[k].derivative = -1;
+  derivatives = wrt.numel ();
+  for (octave_idx_type j = 0; j < derivatives; j ++)
+    {
+      const octave_idx_type k = wrt(j) - 1;
+      if (k < 0 || k >= n
+          || (nodes[k].op != TAPE_INPUT && nodes[k].op != TAPE_VARIABLE))
+        {
+          error ("%s: derivatives are only possible with respect to inputs",
+                 fname.c_str ());
+          return false;
+        }
+      nodes[k].derivative = j;
+    }
+  activate ();
+  return true;
+}
+
+inline void interval_tape::seed_variables ()
+{
+  derivatives = variables;
+  for (std::size_t k = 0; k < nodes.size (); k ++)
+    nodes[k].derivative = nodes[k].op == TAPE_VARIABLE
+                          ? nodes[k].param - 1
+                          : -1;
+  activate ();
+}
+
+inline void interval_tape::activate ()
+{
+  for (std::size_t k = 0; k < nodes.size (); k ++)
+    {
+      tape_node &node = nodes[k];
+      node.active = node.derivative >= 0
+                    || (node.arg1 >= 0 && nodes[node.arg1].active)
+                    || (node.arg2 >= 0 && nodes[node.arg2].active);
+    }
+}
+
+// Derivative of a unary operation at x with function value fx.  Outside of
+// the domain of the function, the derivative is unbounded, such that mean
+// value forms and monotonicity tests, which would be invalid, have no
+// effect.
+inline bare_interval unary_derivative (directed_rounding &r,
+                                       const tape_node &node,
+                                       const bare_interval x,
+                                       const bare_interval fx)
+{
+  const bare_interval one = {1.0, 1.0};
+  const bare_interval minus_one = {-1.0, -1.0};
+  const bare_interval two = {2.0, 2.0};
+  switch (node.op)
+    {
+      case TAPE_UMINUS:
+        return minus_one;
+      case TAPE_ABS:
+        {
+          if (is_empty (x))
+            return x;
+          // Generalized gradient at zero
+          if (x.inf > 0.0)
+            return one;
+          if (x.sup < 0.0)
+            return minus_one;
+          const bare_interval sign = {-1.0, 1.0};
+          return sign;
+        }
+      case TAPE_SQR:
+        return interval_times (r, two, x);
+      case TAPE_POWN:
+        {
+          if (node.param == 0)
+            {
+              const bare_interval zero = {-0.0, +0.0};
+              return zero;
+            }
+          const double p = node.param;
+          const bare_interval factor = {p, p};
+          return interval_times (r, factor,
+                                 interval_pown (r, x, node.param - 1));
+        }
+      case TAPE_REALSQRT:
+        if (x.inf <= 0.0)
+          return entire_interval ();
+        return interval_rdivide (r, one, interval_times (r, two, fx));
+      case TAPE_EXP:
+        return fx;
+      case TAPE_LOG:
+        if (x.inf <= 0.0)
+          return entire_interval ();
+        return interval_rdivide (r, one, x);
+      case TAPE_SIN:
+        return interval_cos (r, x);
+      case TAPE_COS:
+        return interval_uminus (interval_sin (r, x));
+      default:
+        return entire_interval ();
+    }
+}
+
+inline void interval_tape::evaluate_gradient (directed_rounding &r,
+                                              std::vector <bare_interval>
+                                                &value,
+                                              std::vector <bare_interval>
+                                                &gradient,
+                                              const octave_idx_type i,
+                                              const bare_interval *variable)
+                                              const
+{
+  evaluate (r, value, i, variable);
+
+  const octave_idx_type d = derivatives;
+  const bare_interval zero = {-0.0, +0.0};
+  const bare_interval one = {1.0, 1.0};
+  for (std::size_t k = 0; k < nodes.size (); k ++)
+    {
+      const tape_node &node = nodes[k];
+      if (! node.needed)
+        continue;
+
+      bare_interval *g = &gradient[k * d];
+      if (! node.active || node.derivative >= 0)
+        {
+          std::fill (g, g + d, zero);
+          if (node.derivative >= 0)
+            g[node.derivative] = one;
+          continue;
+        }
+
+      const bare_interval *gx = &gradient[node.arg1 * d];
+      const bare_interval x = value[node.arg1];
+      switch (node.op)
+        {
+          case TAPE_PLUS:
+          case TAPE_MINUS:
+          case TAPE_TIMES:
+          case TAPE_RDIVIDE:
+            {
+              const bare_interval *gy = &gradient[node.arg2 * d];
+              const bare_interval y = value[node.arg2];
+              for (octave_idx_type j = 0; j < d; j ++)
+                switch (node.op)
+                  {
+                    case TAPE_PLUS:
+                      g[j] = interval_plus (r, gx[j], gy[j]);
+                      break;
+                    case TAPE_MINUS:
+                      g[j] = interval_minus (r, gx[j], gy[j]);
+                      break;
+                    case TAPE_TIMES:
+                      g[j] = interval_plus (r, interval_times (r, gx[j], y),
+                                               interval_times (r, x, gy[j]));
+                      break;
+                    default:
+                      // (x / y)' = (x' - (x / y) y') / y
+                      g[j] = interval_rdivide (
+                               r,
+                               interval_minus (r, gx[j],
+                                               interval_times (r, value[k],
+                                                               gy[j])),
+                               y);
+                      break;
+                  }
+              break;
+            }
+          default:
+            {
+              const bare_interval factor =
+                unary_derivative (r, node, x, value[k]);
+              for (octave_idx_type j = 0; j < d; j ++)
+                g[j] = interval_times (r, factor, gx[j]);
+              break;
+            }
+        }
+    }
+}
+
+inline bool interval_tape::contract (directed_rounding &r,
+                                     std::vector <bare_interval> &value,
+                                     const Array <octave_idx_type> &root,
+                                     const std::vector <bare_interval> &y,
+                                     bare_interval *variable) const
+{
+  // Forward pass
+  evaluate (r, value, 0, variable);
+
+  for (octave_idx_type j = 0; j < root.numel (); j ++)
+    {
+      bare_interval &z = value[root(j) - 1];
+      z = interval_intersect (z, y[y.size () == 1 ? 0 : j]);
+      if (is_empty (z))
+        return false;
+    }
+
+  // Backward pass, each node is contracted before its arguments
+  for (std::size_t k = nodes.size (); k -- > 0; )
+    {
+      const tape_node &node = nodes[k];
+      if (! node.needed || node.arg1 < 0)
+        continue;
+
+      const bare_interval z = value[k];
+      bare_interval &x = value[node.arg1];
+      bare_interval &w = value[node.arg2 >= 0 ? node.arg2 : node.arg1];
+      switch (node.op)
+        {
+          case TAPE_UMINUS:
+            x = interval_intersect (x, interval_uminus (z));
+            break;
+          case TAPE_ABS:
+            x = interval_absrev (z, x);
+            break;
+          case TAPE_SQR:
+            x = interval_sqrrev (r, z, x);
+            break;
+          case TAPE_POWN:
+            x = interval_pownrev (r, z, x, node.param);
+            break;
+          case TAPE_REALSQRT:
+            x = interval_realsqrtrev (r, z, x);
+            break;
+          case TAPE_EXP:
+            x = interval_exprev (r, z, x);
+            break;
+          case TAPE_LOG:
+            x = interval_logrev (r, z, x);
+            break;
+          case TAPE_SIN:
+            x = interval_sinrev (r, z, x);
+            break;
+          case TAPE_COS:
+            x = interval_cosrev (r, z, x);
+            break;
+          case TAPE_PLUS:
+            x = interval_intersect (x, interval_minus (r, z, w));
+            w = interval_intersect (w, interval_minus (r, z, x));
+            break;
+          case TAPE_MINUS:
+            x = interval_intersect (x, interval_plus (r, z, w));
+            w = interval_intersect (w, interval_minus (r, x, z));
+            break;
+          case TAPE_TIMES:
+            x = interval_mulrev (r, w, z, x);
+            w = interval_mulrev (r, x, z, w);
+            break;
+          case TAPE_RDIVIDE:
+            // x / w = z implies x = z w and z w = x
+            x = interval_intersect (x, interval_times (r, z, w));
+            w = interval_mulrev (r, z, x, w);
+            break;
+          default:
+            break;
+        }
+      if (is_empty (x) || is_empty (w))
+        return false;
+    }
+
+  for (std::size_t k = 0; k < nodes.size (); k ++)
+    if (nodes[k].needed && nodes[k].op == TAPE_VARIABLE)
+      {
+        bare_interval &v = variable[nodes[k].param - 1];
+        v = interval_intersect (v, value[k]);
+        if (is_empty (v))
+          return false;
+      }
+  return true;
+}
+
+#endif
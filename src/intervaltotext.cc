@@ -590,6 +590,119 @@ double_to_exact_hex_string
   return retval;
 }
 
+inline
+bool
+is_plain_decimal (const interval_format &layout)
+{
+  // The default layouts for decimal output, e. g., [.16g] or [.17g], do not
+  // need the full printf machinery of MPFR and can be formatted from the
+  // (correctly rounded) significant digits directly.
+  if (layout.number_format == 'g' || layout.number_format == 'G')
+    if (layout.number_width == 0
+        && layout.number_precision >= 2
+        && layout.number_precision <= std::numeric_limits <double>::max_digits10)
+      return true;
+
+  return false;
+}
+
+// Convert a finite scalar double to string in %g format with directed
+// rounding.  The result is identical to mpfr_to_string_d, but only a single
+// digit generation is used and no format string has to be parsed.
+std::string
+double_to_decimal_string
+(
+  const interval_format &layout,
+  shared_conversion_resources &stat,
+  const bool &force_sign,
+  const double &x,
+  const mpfr_rnd_t &rnd
+)
+{
+  const int precision = layout.number_precision;
+
+  if (x == 0.0)
+    return force_sign ? "+0" : "0";
+
+  mpfr_set_d (stat.mp, x, MPFR_RNDZ);
+
+  // Significant digits d1 d2 … dp with value 0.d1d2…dp × 10^exp10
+  // (and leading minus sign for negative numbers)
+  mpfr_exp_t exp10;
+  char *digits = stat.buf;
+  mpfr_get_str (digits, &exp10, 10, precision, stat.mp, rnd);
+
+  if (stat.is_exact)
+    {
+      mpfr_rnd_t complementary_rnd;
+      switch (rnd)
+        {
+          case MPFR_RNDD: complementary_rnd = MPFR_RNDU; break;
+          case MPFR_RNDU: complementary_rnd = MPFR_RNDD; break;
+          case MPFR_RNDZ: complementary_rnd = MPFR_RNDA; break;
+          case MPFR_RNDA: complementary_rnd = MPFR_RNDZ; break;
+          default: complementary_rnd = MPFR_RNDN;
+        }
+
+      mpfr_exp_t complementary_exp10;
+      char *complementary_digits = stat.buf + precision + 2;
+      mpfr_get_str (complementary_digits, &complementary_exp10, 10, precision,
+                    stat.mp, complementary_rnd);
+      stat.is_exact = (exp10 == complementary_exp10
+                       && std::strcmp (digits, complementary_digits) == 0);
+    }
+
+  std::string retval;
+  retval.reserve (precision + 8);
+
+  if (digits[0] == '-')
+    {
+      retval.push_back ('-');
+      digits ++;
+    }
+  else if (force_sign)
+    retval.push_back ('+');
+
+  // Trailing zeros are not displayed in %g format
+  int significant = precision;
+  while (significant > 1 && digits[significant - 1] == '0')
+    significant --;
+
+  // Decimal exponent of the first digit, which decides between fixed
+  // notation and scientific notation, see ISO C99 7.19.6.1
+  const long exponent = static_cast <long> (exp10) - 1;
+  if (exponent < -4 || exponent >= precision)
+    {
+      retval.push_back (digits[0]);
+      if (significant > 1)
+        {
+          retval.push_back ('.');
+          retval.append (digits + 1, significant - 1);
+        }
+      std::sprintf (stat.buf + 2 * (precision + 2),
+                    layout.number_format == 'G' ? "E%+03ld" : "e%+03ld",
+                    exponent);
+      retval.append (stat.buf + 2 * (precision + 2));
+    }
+  else if (exponent < 0)
+    {
+      retval.append ("0.");
+      retval.append (-exponent - 1, '0');
+      retval.append (digits, significant);
+    }
+  else
+    {
+      retval.append (digits, exponent + 1);
+      if (significant > exponent + 1)
+        {
+          retval.push_back ('.');
+          retval.append (digits + exponent + 1, significant - exponent - 1);
+        }
+    }
+
+  return retval;
+}
+
 // Convert a scalar double to string with directed rouding
 std::string
 double_to_string
@@ -605,6 +718,8 @@ double_to_string
 
   if (is_exact_hexadecimal (layout))
     retval = double_to_exact_hex_string (layout, stat, force_sign, x);
+  else if (is_plain_decimal (layout) && std::isfinite (x))
+    retval = double_to_decimal_string (layout, stat, force_sign, x, rnd);
   else
     retval = mpfr_to_string_d (layout, stat, force_sign, x, rnd);
 
@@ -1005,45 +1120,65 @@ interval_to_text
     radius_template = new char [s.length () + 1];
     std::strcpy (radius_template, s.c_str ());
   }
-  shared_conversion_resources stat =
-    {
-      .signed_template = signed_template,
-      .unsigned_template = unsigned_template,
-      .radius_template = radius_template,
-      .buf = new char[768],
-      .mp = {},
-      .is_exact = true
-    };
-  mpfr_init2 (stat.mp, BINARY64_PRECISION);
 
   Array <std::string> interval_literals (inf.dims ());
 
+  // Shared memory is only accessed through raw pointers within the parallel
+  // region.  Each result element is written by exactly one thread.
+  std::string *literals = interval_literals.fortran_vec ();
+  const double *inf_data = inf.data ();
+  const double *sup_data = sup.data ();
+  const octave_uint8 *dec_data = (dec == NULL) ? NULL : (*dec).data ();
+
+  bool is_exact = true;
   const octave_idx_type n = inf.numel ();
-  for (octave_idx_type i = 0; i < n; i ++)
-    {
-      const double l = inf.elem (i);
-      const double u = sup.elem (i);
 
-      std::string s;
-      if (dec == NULL)
-        s = interval_to_text (layout, stat, l, u);
-      else
-        {
-          const uint8_t d = (*dec).elem (i);
-          s = interval_to_text (layout, stat, l, u, &d);
-        }
+#if defined (_OPENMP)
+  #pragma omp parallel if (n >= 1000) reduction (&& : is_exact)
+#endif
+  {
+    // Each thread uses its own conversion buffers, which are reused for all
+    // intervals that are processed by the thread.
+    shared_conversion_resources stat =
+      {
+        .signed_template = signed_template,
+        .unsigned_template = unsigned_template,
+        .radius_template = radius_template,
+        .buf = new char[768],
+        .mp = {},
+        .is_exact = true
+      };
+    mpfr_init2 (stat.mp, BINARY64_PRECISION);
+
+#if defined (_OPENMP)
+    #pragma omp for schedule (static)
+#endif
+    for (octave_idx_type i = 0; i < n; i ++)
+      {
+        const double l = inf_data[i];
+        const double u = sup_data[i];
 
-      interval_literals(i) = s;
-    }
+        if (dec_data == NULL)
+          literals[i] = interval_to_text (layout, stat, l, u);
+        else
+          {
+            const uint8_t d = dec_data[i].value ();
+            literals[i] = interval_to_text (layout, stat, l, u, &d);
+          }
+      }
+
+    is_exact = is_exact && stat.is_exact;
+
+    mpfr_clear (stat.mp);
+    delete[] stat.buf;
+  }
 
-  mpfr_clear (stat.mp);
-  delete[] stat.buf;
   delete[] signed_template;
   delete[] unsigned_template;
   delete[] radius_template;
 
   return std::pair <Array <std::string>, bool>
-    (interval_literals, stat.is_exact);
+    (interval_literals, is_exact);
 }
 
 DEFUN_DLD (intervaltotext, args, nargout, 
@@ -1292,6 +1427,20 @@ DEFUN_DLD (intervaltotext, args, nargout,
 %!assert (intervaltotext (infsup (pi), "[.3g]"), "[3.14, 3.15]");
 %!assert (intervaltotext (infsup (pi), "[.4g]"), "[3.141, 3.142]");
 
+%!assert (intervaltotext (infsup ("0.1"), "[.16g]"), "[0.09999999999999999, 0.1000000000000001]");
+%!assert (intervaltotext (infsup ("0.1"), "[.17g]"), "[0.099999999999999991, 0.10000000000000001]");
+%!assert (intervaltotext (infsup (-1e100, 1e-100), "[.17G]"), "[-1.0000000000000001E+100, +1.0000000000000001E-100]");
+%!test
+%! [~, isexact] = intervaltotext (infsup (1 : 3000), "[.16g]");
+%! assert (isexact, true);
+%! [~, isexact] = intervaltotext (infsup ([1 : 3000, 0.1]), "[.16g]");
+%! assert (isexact, false);
+%!test
+%! # Parallel conversion of large arrays
+%! x = infsup (linspace (-100, 100, 5001), linspace (-99, 101, 5001));
+%! s = intervaltotext (x, "[.17g]");
+%! assert (s([1, 2500, 5001]), {intervaltotext(x(1), "[.17g]"), intervaltotext(x(2500), "[.17g]"), intervaltotext(x(5001), "[.17g]")});
+
 %!assert (intervaltotext (infsup (1 + eps)), "[1, 1.00001]");
 %!assert (intervaltotext (infsup (1)), "[1]");
 